@@ -0,0 +1,215 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef DOLBY_TCUTILS_ABSOLUTEFRAMES_H
+#define DOLBY_TCUTILS_ABSOLUTEFRAMES_H
+
+#include <cstdint>
+#include <stdexcept>
+#include <tcutils/Framerate.h>
+#include <tcutils/Timecode.h>
+#include <tcutils/Types.h>
+
+namespace Dolby
+{
+    namespace TcUtils
+    {
+        class AbsoluteFrames;
+    }
+}
+
+/**
+ * @brief Class representing a position on a continuous 64-bit frame timeline.
+ * @details Unlike Timecode, which is limited to 99 hours and to 32-bit frame counts, an
+ * AbsoluteFrames value counts frames from an arbitrary origin over any practical duration, e.g.
+ * for 24/7 channels and long-running recorders. Frame 0 corresponds with sample 0 and with timecode
+ * 00:00:00:00 of day 0. Values may be negative (before the origin).
+ *
+ * Timecode is derived as a label: the timecode wraps every 24 hours of timecode, and GetDay counts
+ * the number of wraps. For drop-frame framerates a day has 2589408 frames, for other framerates
+ * 24 * 3600 * GetFrameCount() frames (note that for 1000/1001 framerates this is not a real-time
+ * day).
+ *
+ * Sample and tick conversions are done in exact integer arithmetic. Frame boundaries in samples are
+ * rounded to the nearest sample, as with Timecode::ToSamples, and frame boundaries in ticks are the
+ * first tick at or after the frame start, as with Timecode::ToTicks.
+ */
+class Dolby::TcUtils::AbsoluteFrames
+{
+    Framerate mFramerate;
+    int64_t mValue;
+
+public:
+    /** @brief Exception thrown when constructing with an undefined framerate. */
+    struct UndefinedFramerate : std::exception
+    {
+    };
+
+    /** @brief Construct from a frame count. */
+    AbsoluteFrames(Framerate framerate, int64_t frames);
+
+    /**
+     * @brief Construct from a sample position.
+     * @details With RoundingMode::TRUNCATE the frame that contains the sample is used, with
+     * RoundingMode::NEAREST the frame whose start is nearest to the sample.
+     */
+    AbsoluteFrames(Framerate framerate,
+                   Samples samples,
+                   Samplerate samplerate,
+                   RoundingMode roundingMode = RoundingMode::DEFAULT);
+
+    /**
+     * @brief Construct from integer time in ticks, e.g. Nanoseconds, as the corresponding Timecode
+     * constructor.
+     */
+    template <int64_t Rate>
+    AbsoluteFrames(Framerate framerate,
+                   Ticks<Rate> ticks,
+                   RoundingMode roundingMode = RoundingMode::DEFAULT)
+    : AbsoluteFrames(framerate, FromTicks(framerate, ticks.GetValue(), Rate, roundingMode))
+    {
+    }
+
+    /**
+     * @brief Construct from a timecode label and the day it belongs to.
+     * @details Timecodes past 24 hours (WrapMode::CONTINUE) continue into the next day.
+     */
+    explicit AbsoluteFrames(const Timecode& timecode, int64_t day = 0);
+
+    /** @brief Get the framerate. */
+    Framerate GetFramerate() const
+    {
+        return mFramerate;
+    }
+
+    /** @brief Get the frame count. */
+    int64_t GetValue() const
+    {
+        return mValue;
+    }
+
+    /** @brief Get the number of frames in a 24 hour timecode day for the given framerate. */
+    static int64_t FramesPerDay(Framerate framerate);
+
+    /** @brief Get the day counter: the number of times the timecode label wrapped at midnight. */
+    int64_t GetDay() const;
+
+    /** @brief Get the frame count within the day, in [0, FramesPerDay). */
+    int64_t GetFrameOfDay() const;
+
+    /** @brief Get the timecode label, wrapped at midnight. */
+    Timecode ToTimecode() const;
+
+    /** @brief Get the sample position of the start of the frame. */
+    Samples ToSamples(Samplerate samplerate) const;
+
+    /** @brief Get the first tick at or after the start of the frame, e.g. ToTicks<1000000000>(). */
+    template <int64_t Rate>
+    Ticks<Rate> ToTicks() const
+    {
+        return Ticks<Rate>(ToTickCount(Rate));
+    }
+
+    /** @brief Add a number of frames. */
+    AbsoluteFrames& operator+=(int64_t frames)
+    {
+        mValue += frames;
+        return *this;
+    }
+
+    /** @brief Subtract a number of frames. */
+    AbsoluteFrames& operator-=(int64_t frames)
+    {
+        mValue -= frames;
+        return *this;
+    }
+
+    /** @brief Increase to the next frame. */
+    AbsoluteFrames& operator++()
+    {
+        ++mValue;
+        return *this;
+    }
+
+    /** @brief Decrease to the previous frame. */
+    AbsoluteFrames& operator--()
+    {
+        --mValue;
+        return *this;
+    }
+
+    /** @brief Get the number of frames from other to this; requires matching framerates. */
+    int64_t operator-(const AbsoluteFrames& other) const;
+
+    /** @brief Compare with another position (equals). */
+    bool operator==(const AbsoluteFrames& other) const
+    {
+        return mFramerate == other.mFramerate && mValue == other.mValue;
+    }
+    /** @brief Compare with another position (not equals). */
+    bool operator!=(const AbsoluteFrames& other) const
+    {
+        return !(*this == other);
+    }
+    /** @brief Compare with another position (less than); requires matching framerates. */
+    bool operator<(const AbsoluteFrames& other) const;
+    /** @brief Compare with another position (greater than); requires matching framerates. */
+    bool operator>(const AbsoluteFrames& other) const;
+    /** @brief Compare with another position (less or equal); requires matching framerates. */
+    bool operator<=(const AbsoluteFrames& other) const;
+    /** @brief Compare with another position (greater or equal); requires matching framerates. */
+    bool operator>=(const AbsoluteFrames& other) const;
+
+private:
+    static int64_t FromTicks(Framerate framerate,
+                             int64_t ticks,
+                             int64_t rate,
+                             RoundingMode roundingMode);
+    int64_t ToTickCount(int64_t rate) const;
+
+    /** @brief Helper function to ensure the comparison operators are used on positions with the
+     * same frame rate. */
+    void RequireMatchingFramerate(const AbsoluteFrames& other) const;
+};
+
+namespace Dolby
+{
+    namespace TcUtils
+    {
+        inline AbsoluteFrames operator+(AbsoluteFrames position, int64_t frames)
+        {
+            return position += frames;
+        }
+
+        inline AbsoluteFrames operator-(AbsoluteFrames position, int64_t frames)
+        {
+            return position -= frames;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,123 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef DOLBY_TCUTILS_CHUNKPLANNER_H
+#define DOLBY_TCUTILS_CHUNKPLANNER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include <tcutils/Timecode.h>
+#include <tcutils/TimecodeDuration.h>
+#include <tcutils/Types.h>
+
+namespace Dolby
+{
+    namespace TcUtils
+    {
+        class ChunkPlanner;
+    }
+}
+
+/**
+ * @brief Planner that splits a program into frame-aligned chunks, e.g. to render or transcode
+ * the chunks on different cores or nodes.
+ * @details The program is a number of samples of which sample 0 is at a start timecode. Chunk
+ * edges are on the frame boundaries of the program, the frame starts rounded to the nearest
+ * sample as with Timecode::ToSamples and FrameBoundary, so that the cadence of the frame lengths
+ * (e.g. 1601 and 1602 samples for 29.97 fps at 48 kHz) is kept: the chunks are consecutive, and
+ * no sample is processed twice or skipped. The last chunk ends at the end of the program, which
+ * may be within a frame.
+ *
+ * Chunks are balanced to within one frame. Optional handles extend the range that is processed
+ * by a number of frames on both sides (within the program), so that the overlapping parts of
+ * neighbouring chunks can be crossfaded when stitching them.
+ */
+class Dolby::TcUtils::ChunkPlanner
+{
+public:
+    /**
+     * @brief Exception thrown for a start timecode that is not set, a samplerate that is not
+     * positive, a negative length, or plans for no chunks, chunks of no frames or negative
+     * handles.
+     */
+    struct InvalidParameter : std::exception
+    {
+    };
+
+    /** @brief A chunk: the samples [start, end) and the samples to process with the handles. */
+    struct Chunk
+    {
+        Samples start;
+        Samples end;
+        Samples handleStart;
+        Samples handleEnd;
+        Timecode timecode; // the timecode of the frame at start
+    };
+
+    /**
+     * @brief Construct a planner for a program of the given number of samples, of which sample 0
+     * is at the start timecode.
+     */
+    ChunkPlanner(const Timecode& start, Samplerate samplerate, Samples length);
+
+    /** @brief Get the number of frames of the program, including a last partial frame. */
+    int64_t GetFrameCount() const
+    {
+        return mFrameCount;
+    }
+
+    /**
+     * @brief Split the program into the given number of chunks, or into one chunk per frame for
+     * programs of fewer frames. Returns no chunks for an empty program.
+     */
+    std::vector<Chunk> PlanCount(size_t count, Frames handles = Frames(0)) const;
+
+    /**
+     * @brief Split the program into the fewest chunks of at most the given duration; the chunks
+     * are then balanced, so may be shorter. Requires a matching framerate.
+     */
+    std::vector<Chunk> PlanDuration(const TimecodeDuration& duration,
+                                    Frames handles = Frames(0)) const;
+
+private:
+    Timecode mStart;
+    int64_t mLength;
+    // frame starts are at frame * mA / mB samples from 00:00:00:00, rounded to nearest
+    int64_t mA;
+    int64_t mB;
+    int64_t mStartFrame;
+    // the position of the start timecode from 00:00:00:00
+    int64_t mOrigin;
+    int64_t mFrameCount;
+
+    int64_t FrameStart(int64_t frame) const;
+    Timecode TimecodeOf(int64_t frame) const;
+};
+
+#endif
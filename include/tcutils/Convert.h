@@ -28,8 +28,10 @@
 #ifndef DOLBY_TCUTILS_CONVERT_H
 #define DOLBY_TCUTILS_CONVERT_H
 
+#include <chrono>
 #include <tcutils/Framerate.h>
 #include <tcutils/Types.h>
+#include <type_traits>
 
 namespace Dolby
 {
@@ -72,6 +74,56 @@ public:
      * @brief Convert DAMF-time in seconds to samples using the given framerate and samplerate.
      */
     static Samples ToSamples(Framerate framerate, DAMFSeconds damfSeconds, Samplerate sr);
+
+    /**
+     * @brief Convert integer time in ticks to samples, rounded to the nearest sample (half way
+     * rounds up), using exact integer arithmetic.
+     * @details The samplerate is exact when it is an integer or an integer with the 1000/1001
+     * ratio applied, otherwise it is rounded to 1/1000 Hz.
+     */
+    template <int64_t Rate>
+    static Samples ToSamples(Ticks<Rate> ticks, Samplerate sr)
+    {
+        return Samples(TicksToSamples(ticks.GetValue(), 1, Rate, sr));
+    }
+
+    /** @brief Convert an integer std::chrono duration to samples, as the Ticks version. */
+    template <class Rep, class Period>
+    static Samples ToSamples(std::chrono::duration<Rep, Period> duration, Samplerate sr)
+    {
+        static_assert(std::is_integral<Rep>::value, "use an integer duration, or Seconds");
+        return Samples(
+            TicksToSamples(static_cast<int64_t>(duration.count()), Period::num, Period::den, sr));
+    }
+
+    /**
+     * @brief Convert samples to integer time in ticks, rounded to the nearest tick (half way
+     * rounds up), using exact integer arithmetic. E.g. ToTicks<1000000000>(samples, sr).
+     */
+    template <int64_t Rate>
+    static Ticks<Rate> ToTicks(Samples samples, Samplerate sr)
+    {
+        return Ticks<Rate>(SamplesToTicks(samples.GetValue(), 1, Rate, sr));
+    }
+
+    /** @brief Convert samples to an integer std::chrono duration, as ToTicks. */
+    template <class Duration>
+    static Duration ToDuration(Samples samples, Samplerate sr)
+    {
+        static_assert(std::is_integral<typename Duration::rep>::value, "use an integer duration");
+        return Duration(static_cast<typename Duration::rep>(SamplesToTicks(
+            samples.GetValue(), Duration::period::num, Duration::period::den, sr)));
+    }
+
+private:
+    static int64_t TicksToSamples(int64_t ticks,
+                                  int64_t numerator,
+                                  int64_t denominator,
+                                  Samplerate sr);
+    static int64_t SamplesToTicks(int64_t samples,
+                                  int64_t numerator,
+                                  int64_t denominator,
+                                  Samplerate sr);
 };
 
 #endif
@@ -28,8 +28,10 @@
 #ifndef DOLBY_TCUTILS_FRAMEBOUNDARY_H
 #define DOLBY_TCUTILS_FRAMEBOUNDARY_H
 
+#include <chrono>
 #include <tcutils/Framerate.h>
 #include <tcutils/Types.h>
+#include <type_traits>
 
 namespace Dolby
 {
@@ -67,6 +69,90 @@ public:
      * @brief Check if the sample position corresponds with a frame boundary.
      */
     static bool IsOnBoundary(Framerate framerate, Samples samples, Samplerate sr);
+
+    /**
+     * @brief Integer time versions of the functions above.
+     * @details The frame boundary of a frame is the first tick at or after the exact start of
+     * the frame (as returned by Timecode::ToTicks). Computed with exact integer arithmetic.
+     */
+    template <int64_t Rate>
+    static Ticks<Rate> Floor(Framerate framerate, Ticks<Rate> ticks)
+    {
+        return Ticks<Rate>(Calculate(Mode::FLOOR, framerate, ticks.GetValue(), 1, Rate));
+    }
+
+    template <int64_t Rate>
+    static Ticks<Rate> Round(Framerate framerate, Ticks<Rate> ticks)
+    {
+        return Ticks<Rate>(Calculate(Mode::ROUND, framerate, ticks.GetValue(), 1, Rate));
+    }
+
+    template <int64_t Rate>
+    static Ticks<Rate> Ceiling(Framerate framerate, Ticks<Rate> ticks)
+    {
+        return Ticks<Rate>(Calculate(Mode::CEILING, framerate, ticks.GetValue(), 1, Rate));
+    }
+
+    template <int64_t Rate>
+    static bool IsOnBoundary(Framerate framerate, Ticks<Rate> ticks)
+    {
+        return Floor(framerate, ticks).GetValue() == ticks.GetValue();
+    }
+
+    /**
+     * @brief Integer std::chrono duration versions of the functions above, with the period of
+     * the duration as tick.
+     */
+    template <class Rep, class Period>
+    static std::chrono::duration<Rep, Period> Floor(Framerate framerate,
+                                                    std::chrono::duration<Rep, Period> duration)
+    {
+        return Calculate(Mode::FLOOR, framerate, duration);
+    }
+
+    template <class Rep, class Period>
+    static std::chrono::duration<Rep, Period> Round(Framerate framerate,
+                                                    std::chrono::duration<Rep, Period> duration)
+    {
+        return Calculate(Mode::ROUND, framerate, duration);
+    }
+
+    template <class Rep, class Period>
+    static std::chrono::duration<Rep, Period> Ceiling(Framerate framerate,
+                                                      std::chrono::duration<Rep, Period> duration)
+    {
+        return Calculate(Mode::CEILING, framerate, duration);
+    }
+
+    template <class Rep, class Period>
+    static bool IsOnBoundary(Framerate framerate, std::chrono::duration<Rep, Period> duration)
+    {
+        return Floor(framerate, duration) == duration;
+    }
+
+private:
+    enum class Mode
+    {
+        FLOOR,
+        ROUND,
+        CEILING
+    };
+
+    static int64_t Calculate(Mode mode,
+                             Framerate framerate,
+                             int64_t ticks,
+                             int64_t numerator,
+                             int64_t denominator);
+
+    template <class Rep, class Period>
+    static std::chrono::duration<Rep, Period> Calculate(Mode mode,
+                                                        Framerate framerate,
+                                                        std::chrono::duration<Rep, Period> duration)
+    {
+        static_assert(std::is_integral<Rep>::value, "use an integer duration");
+        return std::chrono::duration<Rep, Period>(static_cast<Rep>(Calculate(
+            mode, framerate, static_cast<int64_t>(duration.count()), Period::num, Period::den)));
+    }
 };
 
 #endif
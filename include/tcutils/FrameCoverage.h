@@ -0,0 +1,161 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef DOLBY_TCUTILS_FRAMECOVERAGE_H
+#define DOLBY_TCUTILS_FRAMECOVERAGE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <tcutils/Framerate.h>
+#include <tcutils/Timecode.h>
+
+namespace Dolby
+{
+    namespace TcUtils
+    {
+        class FrameCoverage;
+    }
+}
+
+/**
+ * @brief Compressed bitmap of the frames that are present, e.g. in a capture, render or QC pass,
+ * keyed by Timecode::ToFrames().
+ * @details As in roaring bitmaps, the frames are split in chunks of 65536 frames: chunks without
+ * frames take no memory, chunks with all frames present take no memory for their bits (so ranges
+ * are stored compactly), and other chunks hold a bitmap of 1024 64-bit words. Set algebra works
+ * chunk by chunk, with SSE2 for the bitmap words where available. A day at 120 fps takes at most
+ * 1.3 MB.
+ *
+ * Ranges of frames are half open: [in, out) contains the frames from in up to, but not including,
+ * out, and is empty when out is not after in. Runs and gaps are returned as timecodes with
+ * WrapMode::CONTINUE, so that a run up to the end of the day has out point 24:00:00:00.
+ */
+class Dolby::TcUtils::FrameCoverage
+{
+public:
+    /** @brief A range of frames [in, out). */
+    struct Run
+    {
+        Timecode in;
+        Timecode out;
+    };
+
+    /** @brief Construct an empty coverage for the given framerate. */
+    explicit FrameCoverage(Framerate framerate);
+
+    /** @brief Get the framerate. */
+    Framerate GetFramerate() const
+    {
+        return mFramerate;
+    }
+
+    /** @brief Add a frame; requires a matching framerate and a set timecode. */
+    void Add(const Timecode& timecode);
+    /** @brief Add the frames of the range [in, out), as Add. */
+    void Add(const Timecode& in, const Timecode& out);
+    /** @brief Add the frames of an array of ranges [in[i], out[i]), as Add. */
+    void Add(const Timecode* in, const Timecode* out, size_t count);
+    /** @brief Remove the frames of the range [in, out), as Add. */
+    void Remove(const Timecode& in, const Timecode& out);
+
+    /** @brief Whether the frame is present; requires a matching framerate and a set timecode. */
+    bool Contains(const Timecode& timecode) const;
+
+    /** @brief Get the number of frames present. */
+    int64_t Count() const;
+
+    /** @brief Whether no frames are present. */
+    bool IsEmpty() const
+    {
+        return mChunks.empty();
+    }
+
+    /** @brief Get the runs of consecutive frames that are present, in order. */
+    std::vector<Run> GetRuns() const;
+
+    /** @brief Get the runs of consecutive frames in [begin, end) that are not present, in order. */
+    std::vector<Run> GetGaps(const Timecode& begin, const Timecode& end) const;
+
+    /** @brief Add the frames of another coverage (union); requires matching framerates. */
+    FrameCoverage& operator|=(const FrameCoverage& other);
+    /** @brief Keep the frames present in both (intersection); requires matching framerates. */
+    FrameCoverage& operator&=(const FrameCoverage& other);
+    /** @brief Remove the frames of another coverage (difference); requires matching framerates. */
+    FrameCoverage& operator-=(const FrameCoverage& other);
+
+    /** @brief Whether the same frames are present, at the same framerate. */
+    bool operator==(const FrameCoverage& other) const;
+    /** @brief Whether different frames are present, or at a different framerate. */
+    bool operator!=(const FrameCoverage& other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    struct Chunk
+    {
+        uint32_t key;                // the frames of the chunk are key * 65536 + [0, 65536)
+        int64_t count;               // the number of frames present, in [1, 65536]
+        std::vector<uint64_t> words; // the bitmap, or empty if all frames are present
+    };
+
+    Framerate mFramerate;
+    // the chunks that have frames, ordered by key
+    std::vector<Chunk> mChunks;
+
+    static bool KeyLess(const Chunk& chunk, uint32_t key);
+    int64_t ToKey(const Timecode& timecode) const;
+    void RequireMatchingFramerate(const FrameCoverage& other) const;
+    void SetRange(int64_t begin, int64_t end, bool present);
+
+    template <class Visitor>
+    void VisitRuns(int64_t from, Visitor& visitor) const;
+};
+
+namespace Dolby
+{
+    namespace TcUtils
+    {
+        inline FrameCoverage operator|(FrameCoverage a, const FrameCoverage& b)
+        {
+            return a |= b;
+        }
+
+        inline FrameCoverage operator&(FrameCoverage a, const FrameCoverage& b)
+        {
+            return a &= b;
+        }
+
+        inline FrameCoverage operator-(FrameCoverage a, const FrameCoverage& b)
+        {
+            return a -= b;
+        }
+    }
+}
+
+#endif
@@ -32,6 +32,7 @@
 #include <iosfwd>
 #include <stdexcept>
 #include <string>
+#include <tcutils/Types.h>
 
 namespace Dolby
 {
@@ -44,7 +45,9 @@ namespace Dolby
 /**
  * @brief Class to encapsulates an enum representing common framerates and related functionality.
  * @details Provides functions to access inherent properties of the various framerates and to apply
- * ratio conversion.
+ * ratio conversion. Framerates that are not in the enum (e.g. 47.952, 59.94, 72 or 144 fps) can be
+ * constructed from a Rational and have enum value CUSTOM. The properties of both are computed once
+ * at construction, so the accessors are equally fast for all framerates.
  */
 class Dolby::TcUtils::Framerate
 {
@@ -65,7 +68,8 @@ public:
         FPS_96,
         FPS_100,
         FPS_120,
-        COUNT
+        COUNT,
+        CUSTOM /// A framerate not in the list above, constructed from a Rational
     };
 
     /** @brief Exception thrown when trying to construct a Framerate from an invalid string */
@@ -73,9 +77,36 @@ public:
     {
     };
 
+    /** @brief Exception thrown when trying to construct a Framerate from an unsupported Rational */
+    struct UnsupportedFramerate : std::exception
+    {
+    };
+
+    /** @brief The largest frame count supported for custom framerates */
+    static const int MAX_FRAME_COUNT = 999;
+
 private:
     /** @brief The encapsulated enum value */
     Enum mValue{UNDEFINED};
+    /** @brief Precomputed properties, see GetFrameCount, IsRatio1001 and IsDrop */
+    int mFrameCount{0};
+    bool mRatio1001{false};
+    bool mDrop{false};
+
+    static constexpr int FrameCountOf(Enum value)
+    {
+        return value == FPS_23976 || value == FPS_24 ? 24
+               : value == FPS_25                     ? 25
+               : value == FPS_2997 || value == FPS_2997DF || value == FPS_30 || value == FPS_30DF
+                   ? 30
+               : value == FPS_48  ? 48
+               : value == FPS_50  ? 50
+               : value == FPS_60  ? 60
+               : value == FPS_96  ? 96
+               : value == FPS_100 ? 100
+               : value == FPS_120 ? 120
+                                  : 0;
+    }
 
 public:
     /**
@@ -87,9 +118,21 @@ public:
      */
     constexpr Framerate(Enum value)
     : mValue(value)
+    , mFrameCount(FrameCountOf(value))
+    , mRatio1001(value == FPS_23976 || value == FPS_2997 || value == FPS_2997DF)
+    , mDrop(value == FPS_2997DF || value == FPS_30DF)
     {
     }
 
+    /**
+     * @brief Construct from an exact rational value in FPS and drop-frame indicator.
+     * @details Supported are integer framerates and 1000/1001 ratios of them (e.g. 60000/1001 for
+     * 59.94), up to MAX_FRAME_COUNT frames per timecode second. Drop-frame is supported for 29.97
+     * and 30 only. Framerates in the enum get their enum value, others CUSTOM. Throws
+     * UnsupportedFramerate for other values.
+     */
+    explicit Framerate(Rational fps, bool drop = false);
+
     /**
      * @brief Construct from std::string.
      * @param str String representing the framerate value, with optional df or DF suffix for
@@ -118,13 +161,14 @@ public:
     /** @brief Compare framerate with another framerate (equals). */
     bool operator==(const Framerate& other) const
     {
-        return GetEnum() == other.GetEnum();
+        return mValue == other.mValue && mFrameCount == other.mFrameCount &&
+               mRatio1001 == other.mRatio1001;
     }
 
     /** @brief Compare framerate with another framerate (not equals). */
     bool operator!=(const Framerate& other) const
     {
-        return GetEnum() != other.GetEnum();
+        return !(*this == other);
     }
 
     /** @brief Get the encapsulated enum value. */
@@ -135,20 +179,41 @@ public:
 
     /** @brief Get the integer frame count. This is the frame count without applying the 1.001
      * ratio, e.g. 30 for FPS_2997.*/
-    int GetFrameCount() const;
+    int GetFrameCount() const
+    {
+        return mFrameCount;
+    }
+
+    /** @brief Get the exact framerate in FPS, e.g. 30000 / 1001 for FPS_2997. */
+    Rational ToRational() const
+    {
+        return Rational(mRatio1001 ? mFrameCount * 1000 : mFrameCount, mRatio1001 ? 1001 : 1);
+    }
 
     /** @brief Convert to string. */
     const char* ToString() const;
 
     /** @brief Whether this framerate is valid or undefined */
-    bool IsDefined() const;
+    bool IsDefined() const
+    {
+        return mValue != UNDEFINED;
+    }
 
     /** @brief Whether this framerate is a drop-frame framerate. */
-    bool IsDrop() const;
-    /** @brief Whether this framerate is an NTSC 1000/1001 framerate (23.976 and 29.97) */
-    bool IsRatio1001() const;
-    /** @brief Whether this framerate is a high framerate (double and quadruple of 24,25,30 fps) */
-    bool IsHighFramerate() const;
+    bool IsDrop() const
+    {
+        return mDrop;
+    }
+    /** @brief Whether this framerate is an NTSC 1000/1001 framerate (e.g. 23.976 and 29.97) */
+    bool IsRatio1001() const
+    {
+        return mRatio1001;
+    }
+    /** @brief Whether this framerate is a high framerate (over 30 frames per timecode second) */
+    bool IsHighFramerate() const
+    {
+        return mFrameCount > 30;
+    }
 
     /** @brief Multiply value with 1000/1001 for NTSC 1000/1001 framerates, else leave untouched.
      */
@@ -0,0 +1,152 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef DOLBY_TCUTILS_MEDIACLOCK_H
+#define DOLBY_TCUTILS_MEDIACLOCK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <tcutils/Framerate.h>
+#include <tcutils/Timecode.h>
+
+namespace Dolby
+{
+    namespace TcUtils
+    {
+        class MediaClock;
+    }
+}
+
+/**
+ * @brief Class to derive time-of-day timecode from PTP time and RTP media-clock timestamps, as
+ * used in SMPTE ST 2059 / ST 2110 systems.
+ * @details PTP time is given as TAI nanoseconds since the PTP epoch (1970-01-01 00:00:00 TAI).
+ * Following ST 2059-1, frames are aligned to the epoch: frame N starts at N / framerate seconds.
+ * The timecode counter is jammed daily to 00:00:00:00 at the first frame that starts at or after
+ * the jam time in local time, and counts frames (including drop-frame counting) from there. Local
+ * time is TAI minus the UTC offset (37 seconds since 2017) plus the local time offset.
+ *
+ * A time given in ticks (nanoseconds or RTP clock ticks) belongs to the frame of which the start
+ * time, truncated to the tick grid, is the last one not after it. This makes the RTP timestamp of
+ * a video frame (its start time truncated to the media clock) map to that frame.
+ *
+ * All calculations are done in exact integer arithmetic.
+ */
+class Dolby::TcUtils::MediaClock
+{
+public:
+    /** @brief The UTC offset of TAI in seconds, valid since 2017-01-01. */
+    static const int32_t DEFAULT_UTC_OFFSET = 37;
+
+    /** @brief Exception thrown for an undefined framerate or a zero RTP clock rate. */
+    struct InvalidParameter : std::exception
+    {
+    };
+
+    /**
+     * @brief Constructor.
+     * @param utcOffset TAI - UTC in seconds, as announced by the PTP grandmaster.
+     * @param localOffset Local time - UTC in seconds (e.g. 3600 for CET).
+     * @param jamTime The time of the daily jam in seconds after local midnight.
+     */
+    explicit MediaClock(Framerate framerate,
+                        int32_t utcOffset   = DEFAULT_UTC_OFFSET,
+                        int32_t localOffset = 0,
+                        int32_t jamTime     = 0);
+
+    /** @brief Get the framerate. */
+    Framerate GetFramerate() const
+    {
+        return mFramerate;
+    }
+
+    /** @brief Get the index of the frame containing the given time, counted from the epoch. */
+    int64_t ToFrameCount(int64_t taiNanoseconds) const;
+
+    /** @brief Get the start time of the given frame, truncated to nanoseconds. */
+    int64_t ToNanoseconds(int64_t frameCount) const;
+
+    /** @brief Get the index of the frame at which the timecode was jammed for the given frame. */
+    int64_t GetJamFrameCount(int64_t frameCount) const;
+
+    /** @brief Get the time-of-day timecode for the given time. */
+    Timecode ToTimecode(int64_t taiNanoseconds) const;
+
+    /**
+     * @brief Get the time-of-day timecode for an RTP timestamp.
+     * @param clockRate The RTP clock rate in Hz (e.g. 48000 for audio, 90000 for video).
+     * @param referenceNanoseconds A PTP time within 2^31 RTP ticks of the RTP timestamp (e.g. the
+     * packet arrival time), used to unwrap the timestamp.
+     */
+    Timecode ToTimecode(uint32_t rtpTimestamp,
+                        uint32_t clockRate,
+                        int64_t referenceNanoseconds) const;
+
+    /** @brief Get the time-of-day timecodes for an array of PTP times. */
+    void ToTimecodes(const int64_t* taiNanoseconds, size_t count, Timecode* timecodes) const;
+
+    /**
+     * @brief Get the time-of-day timecodes for an array of RTP timestamps.
+     * @details The first timestamp is unwrapped using the reference time, each next timestamp is
+     * unwrapped using the previous one, so the reference only needs to be close to the first.
+     */
+    void ToTimecodes(const uint32_t* rtpTimestamps,
+                     size_t count,
+                     uint32_t clockRate,
+                     int64_t referenceNanoseconds,
+                     Timecode* timecodes) const;
+
+    /** @brief Get the RTP timestamp for a PTP time: the time in clock ticks, modulo 2^32. */
+    static uint32_t ToRtpTimestamp(int64_t taiNanoseconds, uint32_t clockRate);
+
+    /**
+     * @brief Unwrap an RTP timestamp to the number of clock ticks since the epoch.
+     * @details Returns the tick count that equals the timestamp modulo 2^32 and is nearest to the
+     * tick count of the reference time.
+     */
+    static int64_t UnwrapRtpTimestamp(uint32_t rtpTimestamp,
+                                      uint32_t clockRate,
+                                      int64_t referenceNanoseconds);
+
+private:
+    Framerate mFramerate;
+    /// Nanoseconds from the start of a TAI day to the jam time
+    int64_t mJamOffset;
+
+    /// Range of frames [start, end) of the most recently used day, for the array conversions
+    struct DayCache
+    {
+        int64_t start{0};
+        int64_t end{0};
+    };
+
+    int64_t JamFrameCountForDay(int64_t day) const;
+    int64_t DayForFrame(int64_t frameCount) const;
+    Timecode ToTimecode(DayCache& cache, int64_t frameCount) const;
+};
+
+#endif
@@ -0,0 +1,245 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef DOLBY_TCUTILS_MIDITIMECODE_H
+#define DOLBY_TCUTILS_MIDITIMECODE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <tcutils/Framerate.h>
+#include <tcutils/Timecode.h>
+#include <tcutils/Types.h>
+
+namespace Dolby
+{
+    namespace TcUtils
+    {
+        class MidiTimecode;
+    }
+}
+
+/**
+ * @brief Class to generate and parse MIDI Time Code (MTC) byte streams.
+ * @details MTC carries timecode as quarter-frame messages (F1 0nnndddd), of which a sequence of
+ * eight spans two frames, and as full-frame SysEx messages (F0 7F dd 01 01 hh mm ss ff F7) used
+ * when locating. MTC distinguishes four rate codes: 24, 25, 29.97 drop-frame and 30 fps. The
+ * 23.976 and 29.97 non-drop framerates are transmitted with the 24 and 30 fps rate codes.
+ *
+ * The Parser and Generator classes work on caller-provided byte buffers and never allocate.
+ */
+class Dolby::TcUtils::MidiTimecode
+{
+public:
+    /** @brief The MTC rate codes, as found in bits 5-6 of the hours byte. */
+    enum RateCode : uint8_t
+    {
+        RATE_24     = 0,
+        RATE_25     = 1,
+        RATE_2997DF = 2,
+        RATE_30     = 3
+    };
+
+    /** @brief Exception thrown when using a framerate that can't be represented in MTC. */
+    struct UnsupportedFramerate : std::exception
+    {
+    };
+
+    /** @brief Size in bytes of a quarter-frame message. */
+    static const size_t QUARTER_FRAME_SIZE = 2;
+    /** @brief Size in bytes of a full-frame message. */
+    static const size_t FULL_FRAME_SIZE = 10;
+
+    /**
+     * @brief Get the rate code for the given framerate.
+     * @details Throws UnsupportedFramerate for framerates other than 23.976, 24, 25, 29.97,
+     * 29.97DF and 30.
+     */
+    static RateCode ToRateCode(Framerate framerate);
+
+    /**
+     * @brief Write the quarter-frame message for the given piece (0 to 7) of the timecode.
+     * @return The number of bytes written (QUARTER_FRAME_SIZE), or 0 when size is too small.
+     */
+    static size_t WriteQuarterFrame(const Timecode& timecode,
+                                    int piece,
+                                    uint8_t* buffer,
+                                    size_t size);
+
+    /**
+     * @brief Write a full-frame SysEx message for the timecode.
+     * @param deviceId The SysEx device id, 0x7F addresses all devices.
+     * @return The number of bytes written (FULL_FRAME_SIZE), or 0 when size is too small.
+     */
+    static size_t WriteFullFrame(const Timecode& timecode,
+                                 uint8_t* buffer,
+                                 size_t size,
+                                 uint8_t deviceId = 0x7F);
+
+    class Parser;
+    class Generator;
+};
+
+/**
+ * @brief Parser reassembling timecodes from an MTC byte stream.
+ * @details Quarter-frame messages are assembled when all eight pieces arrive in forward order.
+ * Because the pieces of a sequence are sent over two frames, the assembled timecode is compensated
+ * by two frames, so it represents the frame that starts when the last piece is received. Once
+ * locked, the timecode is also advanced by one frame halfway through the next sequence, giving one
+ * update per frame. Full-frame messages update the timecode without compensation. System real-time
+ * bytes (F8-FF) may be interleaved anywhere and are ignored. Sequences in reverse order (when the
+ * sender is rewinding) are not assembled.
+ */
+class Dolby::TcUtils::MidiTimecode::Parser
+{
+    Framerate mFramerate24;
+    Framerate mFramerate30;
+
+    Timecode mTimecode;
+    bool mFullFrame{false};
+    bool mUpdated{false};
+
+    // quarter-frame state
+    bool mExpectQuarterFrame{false};
+    bool mLocked{false};
+    uint8_t mPieces[8];
+    uint8_t mReceivedPieces{0};
+    int mLastPiece{-1};
+
+    // SysEx state
+    bool mInSysEx{false};
+    uint8_t mSysEx[9];
+    size_t mSysExLength{0};
+
+public:
+    /**
+     * @brief Constructor.
+     * @param framerate24 The framerate used for rate code 24 (FPS_24 or FPS_23976).
+     * @param framerate30 The framerate used for rate code 30 (FPS_30 or FPS_2997).
+     */
+    explicit Parser(Framerate framerate24 = Framerate::FPS_24,
+                    Framerate framerate30 = Framerate::FPS_30);
+
+    /** @brief Discard any partially received message and the lock state. */
+    void Reset();
+
+    /**
+     * @brief Parse a single byte.
+     * @return True when this byte completed a new timecode, available from GetTimecode.
+     */
+    bool Parse(uint8_t byte);
+
+    /**
+     * @brief Parse bytes until a new timecode is available or all bytes are consumed.
+     * @return The number of bytes consumed. When a new timecode became available (see IsUpdated),
+     * the byte that completed it is the last consumed byte.
+     */
+    size_t Parse(const uint8_t* data, size_t size);
+
+    /** @brief The most recent timecode. Not valid until the first timecode is received. */
+    const Timecode& GetTimecode() const
+    {
+        return mTimecode;
+    }
+
+    /** @brief Whether the most recent timecode came from a full-frame message. */
+    bool IsFullFrame() const
+    {
+        return mFullFrame;
+    }
+
+    /** @brief Whether the most recent call to Parse produced a new timecode. */
+    bool IsUpdated() const
+    {
+        return mUpdated;
+    }
+
+private:
+    Framerate ToFramerate(int rateCode) const;
+    bool ParseQuarterFrame(uint8_t data);
+    bool ParseFullFrame();
+};
+
+/**
+ * @brief Generator for quarter-frame messages at exact sample positions.
+ * @details Sample position 0 corresponds with the start of the frame of the start timecode.
+ * Frame boundaries are computed as with Timecode::ToSamples, and each frame is divided in four
+ * quarter frames, rounded to the nearest sample. The first sequence starts at the start timecode,
+ * each sequence encodes the timecode of the frame at which it starts. Timecodes wrap at midnight;
+ * sample positions are limited to 99 hours from the start of the day of the start timecode.
+ */
+class Dolby::TcUtils::MidiTimecode::Generator
+{
+public:
+    /** @brief A quarter-frame message and its position in a block. */
+    struct Message
+    {
+        int64_t sampleOffset; /// Offset relative to the start of the block
+        uint8_t bytes[QUARTER_FRAME_SIZE];
+    };
+
+    /**
+     * @brief Constructor.
+     * @details Throws UnsupportedFramerate when the framerate of the start timecode can't be
+     * represented in MTC, and Timecode::ValueOutOfRange when it is not set.
+     */
+    explicit Generator(const Timecode& start, Samplerate samplerate);
+
+    /**
+     * @brief Generate the quarter-frame messages that fall within the given block.
+     * @details Consecutive blocks are generated in constant time per message. Any other block
+     * start costs one sample-to-frame conversion to find the next message. At most four messages
+     * are generated per frame. When maxMessages is reached, generation continues from the next
+     * message when blockStart is the sample after the last written message.
+     * @return The number of messages written, which is limited by maxMessages.
+     */
+    size_t Generate(Samples blockStart,
+                    int64_t blockLength,
+                    Message* messages,
+                    size_t maxMessages);
+
+private:
+    Framerate mFramerate;
+    RateCode mRateCode;
+    Samplerate mSamplerate;
+    int32_t mStartFrames;
+    int64_t mStartSamples;
+
+    // position of the next message
+    int64_t mQuarterFrame{0};
+    int64_t mFrameStart{0};
+    int64_t mFrameEnd{0};
+    int64_t mNextBlockStart{0};
+    Timecode mSequenceTimecode;
+
+    int64_t FrameBoundary(int64_t frame) const;
+    void Seek(int64_t position);
+    int64_t Position() const;
+    void Advance();
+};
+
+#endif
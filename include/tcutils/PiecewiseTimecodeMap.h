@@ -0,0 +1,155 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef DOLBY_TCUTILS_PIECEWISETIMECODEMAP_H
+#define DOLBY_TCUTILS_PIECEWISETIMECODEMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include <tcutils/Framerate.h>
+#include <tcutils/Timecode.h>
+#include <tcutils/Types.h>
+
+namespace Dolby
+{
+    namespace TcUtils
+    {
+        class PiecewiseTimecodeMap;
+    }
+}
+
+/**
+ * @brief Map between the sample positions of a recording and its timecode, for recordings with
+ * timecode breaks: jumps, restarts and framerate changes.
+ * @details The map is built from anchors: a sample position and the timecode of the frame that
+ * starts there. Every anchor that doesn't continue the timecode before it starts a segment, in
+ * which the timecode counts up from the anchor at the framerate of its timecode. Frame starts
+ * within a segment are rounded to the nearest sample, as with Timecode::ToSamples; samplerates are
+ * interpreted as with Convert::ToTicks (exact for integer samplerates and for 1000/1001 ratios of
+ * them).
+ *
+ * Anchors can be added as they are decoded, e.g. one per frame from an LTC decoder: an anchor is
+ * merged with the segment before it when the frame of that segment nearest to the anchor position
+ * has the anchor timecode, so jitter of less than half a frame doesn't start new segments.
+ *
+ * Sample positions are looked up with a branchless binary search over the segment starts; the
+ * array version reuses the segment of the previous position when possible, so that looking up the
+ * positions of a block of audio costs little more than one lookup.
+ */
+class Dolby::TcUtils::PiecewiseTimecodeMap
+{
+public:
+    /** @brief Exception thrown for samplerates that are not positive. */
+    struct InvalidParameter : std::exception
+    {
+    };
+
+    /** @brief Exception thrown for anchors that are not after the anchor before them. */
+    struct UnorderedAnchor : std::exception
+    {
+    };
+
+    /** @brief A segment: the position of its first frame and the timecode of that frame. */
+    struct Segment
+    {
+        Samples start;
+        Timecode timecode;
+    };
+
+    /** @brief Construct an empty map for a recording at the given samplerate. */
+    explicit PiecewiseTimecodeMap(Samplerate samplerate);
+
+    /**
+     * @brief Add an anchor: the frame with the given timecode starts at the given position.
+     * @details Positions must increase (UnorderedAnchor otherwise), timecodes must be set
+     * (Timecode::ValueOutOfRange otherwise), and must not be after the end of the recording.
+     * @return Whether the anchor started a new segment, rather than continuing the last one.
+     */
+    bool AddAnchor(Samples position, const Timecode& timecode);
+
+    /**
+     * @brief Set the end of the recording: positions from the end on are not mapped. Without an
+     * end, the last segment continues indefinitely.
+     */
+    void SetEnd(Samples end);
+
+    /** @brief Get the number of segments. */
+    size_t GetSegmentCount() const
+    {
+        return mSegments.size();
+    }
+
+    /** @brief Get segment i. */
+    Segment GetSegment(size_t i) const;
+
+    /**
+     * @brief Get the timecode of the frame that contains the sample position.
+     * @details Returns a default constructed timecode (not valid) for positions before the first
+     * anchor, or from the end of the recording on. The timecode of a segment of timecodes that
+     * don't wrap at midnight may run out of range (Timecode::ValueOutOfRange).
+     */
+    Timecode ToTimecode(Samples samples) const;
+
+    /** @brief Get the timecodes of an array of sample positions, as ToTimecode. */
+    void ToTimecodes(const int64_t* samples, size_t count, Timecode* timecodes) const;
+
+    /**
+     * @brief Find the start positions of all frames with the given timecode, in order.
+     * @details A timecode may occur in several segments, e.g. after a restart, or several times
+     * in a segment of more than a day of timecodes that wrap at midnight; in the last segment
+     * without an end of the recording, only the first occurrence is found. Requires a set timecode.
+     * The positions are appended to the given vector.
+     */
+    void ToSamples(const Timecode& timecode, std::vector<int64_t>& samples) const;
+
+private:
+    struct SegmentData
+    {
+        Timecode timecode;
+        int64_t frame;        // Timecode::ToFrames of the first frame
+        int64_t framesPerDay; // for timecodes that wrap at midnight
+        // frame starts are at frame * a / b samples from the segment start, rounded to nearest
+        int64_t a;
+        int64_t b;
+    };
+
+    int64_t mSamplerateNumerator;
+    int64_t mSamplerateDenominator;
+    int64_t mEnd;
+    int64_t mLastAnchor;
+    // the segment starts, and the other data of the segments
+    std::vector<int64_t> mStarts;
+    std::vector<SegmentData> mSegments;
+
+    size_t FindSegment(int64_t samples) const;
+    int64_t SegmentEnd(size_t segment) const;
+    Timecode TimecodeInSegment(size_t segment, int64_t samples) const;
+};
+
+#endif
@@ -0,0 +1,142 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef DOLBY_TCUTILS_PULLDOWNCADENCE_H
+#define DOLBY_TCUTILS_PULLDOWNCADENCE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <tcutils/Framerate.h>
+#include <tcutils/Timecode.h>
+
+namespace Dolby
+{
+    namespace TcUtils
+    {
+        class PulldownCadence;
+    }
+}
+
+/**
+ * @brief Class to map between film and video timecode through the 2:3 pulldown cadence.
+ * @details In 2:3 pulldown, every four film frames A, B, C and D are spread over ten video fields,
+ * with 2, 3, 2 and 3 fields each, giving five video frames: AA, BB, BC, CD and DD. The cadence is
+ * fixed by a reference pair: a film timecode of an A frame and the video timecode of the video
+ * frame in which it starts. Film timecode is 23.976 (or 24) fps, video timecode 29.97 or 29.97
+ * drop-frame (or 30 / 30 drop-frame), with matching 1000/1001 ratios.
+ *
+ * Mappings are table driven and take constant time per frame. Timecodes are mapped relative to
+ * the reference without wrapping at midnight; results are wrapped at midnight unless the input
+ * timecode uses WrapMode::CONTINUE. A timecode that is not set maps to a timecode that is not set.
+ */
+class Dolby::TcUtils::PulldownCadence
+{
+public:
+    /** @brief Position of a film frame in the cadence. */
+    enum class Phase
+    {
+        A = 0, /// 2 fields, starts on the first field of a video frame
+        B = 1, /// 3 fields, starts on the first field of a video frame
+        C = 2, /// 2 fields, starts on the second field of a video frame
+        D = 3  /// 3 fields, starts on the second field of a video frame
+    };
+
+    /** @brief Field of a video frame. */
+    enum class Field
+    {
+        FIRST  = 0,
+        SECOND = 1
+    };
+
+    /**
+     * @brief Exception thrown for framerates that are not a 2:3 pulldown pair, and when mapping a
+     * timecode of which the framerate doesn't match the reference.
+     */
+    struct InvalidFramerate : std::exception
+    {
+    };
+
+    /**
+     * @brief Constructor.
+     * @param filmReference Film timecode of an A frame.
+     * @param videoReference Video timecode of the video frame in which that A frame starts.
+     */
+    PulldownCadence(const Timecode& filmReference, const Timecode& videoReference);
+
+    /** @brief Get the film framerate. */
+    Framerate GetFilmFramerate() const
+    {
+        return mFilmFramerate;
+    }
+
+    /** @brief Get the video framerate. */
+    Framerate GetVideoFramerate() const
+    {
+        return mVideoFramerate;
+    }
+
+    /** @brief Get the video frame in which the first field of the film frame is. */
+    Timecode ToVideo(const Timecode& film) const;
+
+    /** @brief Get the film frame shown in the given field of the video frame. */
+    Timecode ToFilm(const Timecode& video, Field field = Field::FIRST) const;
+
+    /** @brief Get the cadence phase of the film frame. */
+    Phase GetPhase(const Timecode& film) const;
+
+    /**
+     * @brief Get the field dominance of the film frame: the field of its first video frame on
+     * which it starts.
+     */
+    Field GetFirstField(const Timecode& film) const;
+
+    /** @brief Get the number of fields of the film frame: 2 or 3. */
+    int GetFieldCount(const Timecode& film) const;
+
+    /** @brief Whether the fields of the video frame come from two different film frames. */
+    bool IsSplitFrame(const Timecode& video) const;
+
+    /** @brief Map an array of film timecodes to video, as ToVideo. */
+    void ToVideo(const Timecode* film, size_t count, Timecode* video) const;
+
+    /** @brief Map an array of video timecodes to film, as ToFilm. */
+    void ToFilm(const Timecode* video,
+                size_t count,
+                Timecode* film,
+                Field field = Field::FIRST) const;
+
+private:
+    Framerate mFilmFramerate;
+    Framerate mVideoFramerate;
+    int64_t mFilmReference;
+    int64_t mVideoReference;
+
+    int FilmCadenceIndex(const Timecode& film) const;
+};
+
+#endif
@@ -0,0 +1,145 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef DOLBY_TCUTILS_SAMPLEREMAPPER_H
+#define DOLBY_TCUTILS_SAMPLEREMAPPER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <tcutils/Framerate.h>
+#include <tcutils/Timecode.h>
+#include <tcutils/Types.h>
+
+namespace Dolby
+{
+    namespace TcUtils
+    {
+        class SampleRemapper;
+    }
+}
+
+/**
+ * @brief Class to remap sample positions between samplerates and 0.1% pull factors.
+ * @details A position of n samples at the source samplerate is remapped to the position of the
+ * same content at the destination samplerate, after an optional pull-up or pull-down: the
+ * remapped position is n * to / from * pull, with pull 1001/1000 for a pull-down (content played
+ * 0.1% slower, e.g. 24 fps film transferred to 23.976 fps video) and 1000/1001 for a pull-up.
+ * All calculations are exact rational arithmetic; samplerates are interpreted as with
+ * Convert::ToTicks (exact for integer samplerates and for 1000/1001 ratios of them).
+ *
+ * When constructed with a framerate, the remapping is frame aligned: the start of every frame
+ * (rounded to a sample as with Timecode::ToSamples) is remapped to the start of the same frame at
+ * the destination, where the pulled framerate is the source framerate times the pull factor (e.g.
+ * 24 fps pulled down is 23.976 fps). Positions within a frame are remapped relative to the start
+ * of their frame.
+ */
+class Dolby::TcUtils::SampleRemapper
+{
+public:
+    /** @brief Pull factor applied while remapping. */
+    enum class Pull
+    {
+        NONE = 0, /// No speed change
+        UP   = 1, /// Content played 0.1% faster, positions scale by 1000/1001
+        DOWN = 2  /// Content played 0.1% slower, positions scale by 1001/1000
+    };
+
+    /** @brief Exception thrown for samplerates that are not positive or an undefined framerate. */
+    struct InvalidParameter : std::exception
+    {
+    };
+
+    /**
+     * @brief Constructor for remapping without frame alignment.
+     * @param roundingMode TRUNCATE rounds remapped positions down, NEAREST to the nearest sample
+     * (half way rounds up).
+     */
+    SampleRemapper(Samplerate from,
+                   Samplerate to,
+                   Pull pull                 = Pull::NONE,
+                   RoundingMode roundingMode = RoundingMode::DEFAULT);
+
+    /**
+     * @brief Constructor for frame-aligned remapping at the given source framerate.
+     */
+    SampleRemapper(Samplerate from,
+                   Samplerate to,
+                   Pull pull,
+                   Framerate framerate,
+                   RoundingMode roundingMode = RoundingMode::DEFAULT);
+
+    /** @brief Remap a sample position. */
+    Samples Remap(Samples samples) const;
+
+    /**
+     * @brief Remap an array of sample positions; samples and remapped may be the same array.
+     * @details Without frame alignment, when all positions are small enough (below 2^40 for common
+     * samplerates) the array is remapped with plain 64-bit arithmetic using the reduced
+     * remapping ratio, otherwise each position is remapped as with the scalar function.
+     */
+    void Remap(const int64_t* samples, size_t count, int64_t* remapped) const;
+
+    /**
+     * @brief Get the remapper for the opposite direction: swapped samplerates, opposite pull and,
+     * for frame-aligned remapping, the pulled framerate.
+     */
+    SampleRemapper Inverse() const;
+
+private:
+    Samplerate mFrom;
+    Samplerate mTo;
+    Pull mPull;
+    RoundingMode mRoundingMode;
+
+    // remapped = samples * mMultiplier / mDivisor, reduced
+    int64_t mMultiplier;
+    int64_t mDivisor;
+    // largest magnitude for which the batch remapping doesn't overflow 64 bits
+    int64_t mFastLimit;
+
+    // frame-aligned remapping: frames per second as numerator / denominator, and frame starts at
+    // frame * a / b samples
+    bool mFrameAligned;
+    int64_t mFrameNumerator;
+    int64_t mFrameDenominator;
+    int64_t mSourceFrameA;
+    int64_t mSourceFrameB;
+    int64_t mDestinationFrameA;
+    int64_t mDestinationFrameB;
+
+    SampleRemapper(Samplerate from,
+                   Samplerate to,
+                   Pull pull,
+                   int64_t frameNumerator,
+                   int64_t frameDenominator,
+                   RoundingMode roundingMode);
+
+    int64_t Scale(int64_t samples) const;
+};
+
+#endif
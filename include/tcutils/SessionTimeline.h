@@ -0,0 +1,149 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef DOLBY_TCUTILS_SESSIONTIMELINE_H
+#define DOLBY_TCUTILS_SESSIONTIMELINE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <tcutils/Framerate.h>
+#include <tcutils/Timecode.h>
+#include <tcutils/Types.h>
+
+namespace Dolby
+{
+    namespace TcUtils
+    {
+        class SessionTimeline;
+    }
+}
+
+/**
+ * @brief Timeline of a session (e.g. a DAW or Dolby Atmos session) of which sample 0 is at a start
+ * timecode, such as 00:59:50:00 or 01:00:00:00.
+ * @details Session sample positions are converted to and from timecode and DAMF-time in constant
+ * time: the position of the start timecode and the length of a frame in samples are computed
+ * once. A session position s is at position s + Timecode::ToSamples of the start timecode on the
+ * timeline that starts at 00:00:00:00, so frame starts are rounded to the nearest sample as with
+ * Timecode::ToSamples; samplerates are interpreted as with Convert::ToTicks (exact for integer
+ * samplerates and for 1000/1001 ratios of them).
+ *
+ * The wrap mode of the start timecode is the wrap policy of the session. A session with a start
+ * timecode that wraps at midnight continues at 00:00:00:00 after 23:59:59:xx, and a timecode is
+ * taken to be the first one at or after the start timecode, within a day (e.g. 00:00:05:00 is 15
+ * seconds after a start at 23:59:50:00). Otherwise the timecode continues up to 99:59:59:xx, and a
+ * timecode before the start timecode is at a negative position.
+ */
+class Dolby::TcUtils::SessionTimeline
+{
+public:
+    /** @brief Exception thrown for a start timecode that is not set, or a samplerate that is not
+     * positive. */
+    struct InvalidParameter : std::exception
+    {
+    };
+
+    /** @brief Construct the timeline of a session with the given start timecode and samplerate. */
+    SessionTimeline(const Timecode& start, Samplerate samplerate);
+
+    /** @brief Get the start timecode. */
+    const Timecode& GetStart() const
+    {
+        return mStart;
+    }
+
+    /** @brief Get the framerate, the framerate of the start timecode. */
+    Framerate GetFramerate() const
+    {
+        return mStart.GetFramerate();
+    }
+
+    /** @brief Get the wrap mode, the wrap mode of the start timecode. */
+    WrapMode GetWrapMode() const
+    {
+        return mStart.GetWrapMode();
+    }
+
+    /** @brief Get the samplerate. */
+    Samplerate GetSamplerate() const
+    {
+        return mSamplerate;
+    }
+
+    /**
+     * @brief Get the timecode of the frame that contains the session position. For sessions that
+     * don't wrap at midnight, throws Timecode::ValueOutOfRange when out of range.
+     */
+    Timecode ToTimecode(Samples samples) const;
+
+    /**
+     * @brief Get the session position of the start of the frame with the given timecode; requires
+     * a matching framerate and a set timecode.
+     */
+    Samples ToSamples(const Timecode& timecode) const;
+
+    /**
+     * @brief Get the DAMF-time of the session position: the DAMF-time of its timecode, plus the
+     * part of the frame before the position.
+     */
+    DAMFSeconds ToDAMFSeconds(Samples samples) const;
+
+    /** @brief Get the session position of a DAMF-time, rounded to the nearest sample. */
+    Samples ToSamples(DAMFSeconds seconds) const;
+
+    /** @brief Get the timecodes of an array of session positions, as ToTimecode. */
+    void ToTimecodes(const int64_t* samples, size_t count, Timecode* timecodes) const;
+
+    /** @brief Get the session positions of an array of timecodes, as ToSamples. */
+    void ToSamples(const Timecode* timecodes, size_t count, int64_t* samples) const;
+
+    /** @brief Get the DAMF-times in seconds of an array of session positions, as ToDAMFSeconds. */
+    void ToDAMFSeconds(const int64_t* samples, size_t count, double* seconds) const;
+
+    /** @brief Get the session positions of an array of DAMF-times, as ToSamples. */
+    void ToSamples(const DAMFSeconds* seconds, size_t count, int64_t* samples) const;
+
+private:
+    Timecode mStart;
+    Samplerate mSamplerate;
+    // frame starts are at frame * mA / mB samples from 00:00:00:00, rounded to nearest
+    int64_t mA;
+    int64_t mB;
+    int64_t mStartFrame;
+    // the position of the start timecode from 00:00:00:00
+    int64_t mOrigin;
+    int64_t mFramesPerDay;
+
+    int64_t FrameOf(int64_t samples) const;
+    Timecode TimecodeOf(int64_t frame) const;
+    int64_t SamplesOf(const Timecode& timecode) const;
+    double DAMFSecondsOf(int64_t samples) const;
+    int64_t SamplesOf(double seconds) const;
+};
+
+#endif
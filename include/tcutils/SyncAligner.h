@@ -0,0 +1,142 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef DOLBY_TCUTILS_SYNCALIGNER_H
+#define DOLBY_TCUTILS_SYNCALIGNER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include <tcutils/Framerate.h>
+#include <tcutils/Timecode.h>
+#include <tcutils/Types.h>
+
+namespace Dolby
+{
+    namespace TcUtils
+    {
+        class SyncAligner;
+    }
+}
+
+/**
+ * @brief Aligner that groups the files of a multicam or multi-recorder shoot into synchronized
+ * clusters by their start timecodes, and computes the sample offsets between files.
+ * @details Every file has a start timecode and a length in samples at its own samplerate; the
+ * start timecodes must have one framerate. A cluster is a set of files of which the time ranges
+ * overlap or follow each other without a gap, directly or through other files of the cluster.
+ * The files are sorted by start and clustered in a single sweep, in O(n log n); the ends of the
+ * files are compared exactly, as rationals, so files at different samplerates are clustered
+ * without rounding.
+ *
+ * When all start timecodes wrap at midnight, the day is taken to start at the largest gap between
+ * start timecodes, so that the files of a shoot of less than a day across midnight are in order:
+ * a file that starts at 00:05:00:00 is after a file that starts at 23:55:00:00 when no file
+ * starts in between. Start timecodes that don't wrap at midnight are ordered as they are.
+ *
+ * Offsets are positions on the sample timeline of a file, with frame starts rounded to the
+ * nearest sample as with Timecode::ToSamples.
+ */
+class Dolby::TcUtils::SyncAligner
+{
+public:
+    /**
+     * @brief Exception thrown for files with a start timecode that is not set, a samplerate that
+     * is not positive, or a negative length.
+     */
+    struct InvalidParameter : std::exception
+    {
+    };
+
+    /** @brief A file: its start timecode, its length and its samplerate. */
+    struct File
+    {
+        Timecode start;
+        Samples length;
+        Samplerate samplerate;
+    };
+
+    /**
+     * @brief Cluster the given files; requires matching framerates. Files are referred to by
+     * their index in the given vector.
+     */
+    explicit SyncAligner(const std::vector<File>& files);
+
+    /** @brief Get the number of clusters. */
+    size_t GetClusterCount() const
+    {
+        return mClusters.size();
+    }
+
+    /** @brief Get the files of a cluster, ordered by start. Clusters are ordered by start. */
+    const std::vector<size_t>& GetCluster(size_t cluster) const
+    {
+        return mClusters[cluster];
+    }
+
+    /** @brief Get the cluster of a file. */
+    size_t GetClusterOf(size_t file) const
+    {
+        return mFiles[file].cluster;
+    }
+
+    /**
+     * @brief Get the position of the start of file to on the sample timeline of file from: the
+     * offset to add to a position in file to to get the position in file from, for files at the
+     * same samplerate. Negative when file to starts first.
+     */
+    Samples GetOffset(size_t from, size_t to) const;
+
+    /**
+     * @brief Get the length of the overlap of two files in samples of file from, with the end of
+     * file to rounded to the nearest sample of file from. Zero for files that don't overlap.
+     */
+    Samples GetOverlap(size_t from, size_t to) const;
+
+private:
+    struct FileData
+    {
+        // the start frame (Timecode::ToFrames), plus a day for files after midnight
+        int64_t frame;
+        int64_t length;
+        // frame starts are at frame * a / b samples, rounded to nearest
+        int64_t a;
+        int64_t b;
+        // the end, exactly, at endFrame + endRemainder / a frames
+        int64_t endFrame;
+        int64_t endRemainder;
+        size_t cluster;
+    };
+
+    std::vector<FileData> mFiles;
+    std::vector<std::vector<size_t>> mClusters;
+
+    static bool EndsBefore(const FileData& file, const FileData& other);
+};
+
+#endif
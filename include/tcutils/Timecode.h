@@ -28,9 +28,13 @@
 #ifndef DOLBY_TCUTILS_TIMECODE_H
 #define DOLBY_TCUTILS_TIMECODE_H
 
+#include <chrono>
+#include <cstddef>
+#include <functional>
 #include <iosfwd>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <tcutils/Framerate.h>
 #include <tcutils/Types.h>
 
@@ -78,6 +82,19 @@ class Dolby::TcUtils::Timecode
              const TimeParameters& params,
              WrapMode wrapMode = WrapMode::DEFAULT);
 
+    /// Internal helper struct for construction from integer time, in ticks of num/den seconds
+    struct TickTime
+    {
+        int64_t ticks;
+        int64_t numerator;
+        int64_t denominator;
+    };
+
+    Timecode(Framerate framerate,
+             const TickTime& time,
+             RoundingMode roundingMode,
+             WrapMode wrapMode);
+
     Framerate mFramerate;
     WrapMode mWrapMode{WrapMode::DEFAULT};
 
@@ -194,6 +211,38 @@ public:
                       RoundingMode roundingMode = RoundingMode::DEFAULT,
                       WrapMode wrapMode         = WrapMode::DEFAULT);
 
+    /**
+     * @brief Construct from an integer time in ticks, e.g. Nanoseconds.
+     * @details The time is taken as an exact instant and compared with the exact frame
+     * boundaries, either rounding down to the frame containing the instant, or rounding to the
+     * nearest frame boundary (half way rounds up). Computed with exact integer arithmetic.
+     */
+    template <int64_t Rate>
+    explicit Timecode(Framerate framerate,
+                      Ticks<Rate> ticks,
+                      RoundingMode roundingMode = RoundingMode::DEFAULT,
+                      WrapMode wrapMode         = WrapMode::DEFAULT)
+    : Timecode(framerate, TickTime{ticks.GetValue(), 1, Rate}, roundingMode, wrapMode)
+    {
+    }
+
+    /**
+     * @brief Construct from an integer std::chrono duration.
+     * @details Same as the Ticks constructor, with the period of the duration as tick.
+     */
+    template <class Rep, class Period>
+    explicit Timecode(Framerate framerate,
+                      std::chrono::duration<Rep, Period> duration,
+                      RoundingMode roundingMode = RoundingMode::DEFAULT,
+                      WrapMode wrapMode         = WrapMode::DEFAULT)
+    : Timecode(framerate,
+               TickTime{static_cast<int64_t>(duration.count()), Period::num, Period::den},
+               roundingMode,
+               wrapMode)
+    {
+        static_assert(std::is_integral<Rep>::value, "use an integer duration, or Seconds");
+    }
+
     /**
      * @brief Return true if the time code is valid (not initialized with the default constructor).
      * Note that --:--:--:-- / --:--:--;-- is considered valid, but not set.
@@ -248,6 +297,28 @@ public:
     /** @brief Convert the timecode to seconds in damf format, symmetrical with constructor. */
     DAMFSeconds ToDAMFSeconds() const;
 
+    /**
+     * @brief Convert the timecode to integer time in ticks, e.g. ToTicks<1000000000>() for
+     * nanoseconds: the first tick at or after the start of the frame. Symmetrical with the
+     * constructor as long as a tick is shorter than half a frame.
+     */
+    template <int64_t Rate>
+    Ticks<Rate> ToTicks() const
+    {
+        return Ticks<Rate>(ToTickCount(1, Rate));
+    }
+
+    /**
+     * @brief Convert the timecode to an integer std::chrono duration, as ToTicks.
+     */
+    template <class Duration>
+    Duration ToDuration() const
+    {
+        static_assert(std::is_integral<typename Duration::rep>::value, "use an integer duration");
+        return Duration(static_cast<typename Duration::rep>(
+            ToTickCount(Duration::period::num, Duration::period::den)));
+    }
+
     /**
      * @brief Convert the timecode to frames, not counting drop-frames; symmetrical with constructor
      */
@@ -256,6 +327,50 @@ public:
     /** @brief Get the Framerate value used for the timecode */
     const Framerate& GetFramerate() const;
 
+    /** @brief Get the WrapMode used for the timecode */
+    WrapMode GetWrapMode() const
+    {
+        return mWrapMode;
+    }
+
+    /**
+     * @brief Convert the timecode to another framerate.
+     * @details The start of the frame is converted in exact integer arithmetic: TRUNCATE gives the
+     * frame that contains it, NEAREST the frame of which the start is nearest (half way rounds up).
+     * The wrap mode is kept. A timecode that is not set converts to a timecode that is not set.
+     */
+    Timecode ConvertTo(Framerate framerate,
+                       RoundingMode roundingMode = RoundingMode::DEFAULT) const;
+
+    /**
+     * @brief Convert an array of timecodes to another framerate, as the member function ConvertTo.
+     * @details The source timecodes may have different framerates; the conversion factors are
+     * reused for consecutive timecodes with the same framerate. Source and destination may be the
+     * same array.
+     */
+    static void ConvertTo(const Timecode* timecodes,
+                          size_t count,
+                          Framerate framerate,
+                          Timecode* converted,
+                          RoundingMode roundingMode = RoundingMode::DEFAULT);
+
+    /**
+     * @brief Compare timecodes of any framerate by the real-time start of their frame.
+     * @details Timecodes that are not set sort first. Timecodes starting at the same time are
+     * ordered by framerate, making this a total ordering that is consistent with operator==.
+     * @return A negative value when a is before b, 0 when equal, a positive value when after.
+     */
+    static int Compare(const Timecode& a, const Timecode& b);
+
+    /** @brief Function object ordering timecodes of any framerate with Compare. */
+    struct TimeOrder
+    {
+        bool operator()(const Timecode& a, const Timecode& b) const
+        {
+            return Compare(a, b) < 0;
+        }
+    };
+
     /** @brief Compare timecode with another timecode (equals). */
     bool operator==(const Timecode& other) const;
     /** @brief Compare timecode with another timecode (not equals). */
@@ -275,9 +390,44 @@ public:
     Timecode& operator--();
 
 private:
+    /** @brief Helper function for the conversions to integer time in ticks of num/den seconds. */
+    int64_t ToTickCount(int64_t numerator, int64_t denominator) const;
+
     /** @brief Helper function to ensure the comparison operators are used on timecodes with these
      * same frame rate. */
     void RequireMatchingFramerate(const Timecode& other) const;
 };
 
+namespace std
+{
+    /**
+     * @brief Hash of a timecode for unordered containers, consistent with operator==.
+     * @details Based on the framerate and the frame label (the hours, minutes, seconds and frames
+     * counted as frames), mixed so that consecutive timecodes spread over the buckets.
+     */
+    template <>
+    struct hash<Dolby::TcUtils::Timecode>
+    {
+        size_t operator()(const Dolby::TcUtils::Timecode& timecode) const noexcept
+        {
+            const Dolby::TcUtils::Framerate& framerate = timecode.GetFramerate();
+            const int64_t label =
+                ((static_cast<int64_t>(timecode.GetUnitHours()) * 60 + timecode.GetUnitMinutes()) *
+                     60 +
+                 timecode.GetUnitSeconds()) *
+                    framerate.GetFrameCount() +
+                timecode.GetUnitFrames();
+            const uint64_t rate = static_cast<uint64_t>(framerate.GetEnum() + 1) << 11 |
+                                  static_cast<uint64_t>(framerate.GetFrameCount()) << 1 |
+                                  static_cast<uint64_t>(framerate.IsRatio1001());
+            // the label takes at most 29 bits and the rate 15, so this is unique for set timecodes
+            uint64_t x = static_cast<uint64_t>(label) << 16 ^ rate;
+            // finalizer of splitmix64
+            x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+            return static_cast<size_t>(x ^ (x >> 31));
+        }
+    };
+}
+
 #endif
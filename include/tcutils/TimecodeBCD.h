@@ -0,0 +1,173 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef DOLBY_TCUTILS_TIMECODEBCD_H
+#define DOLBY_TCUTILS_TIMECODEBCD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <tcutils/Framerate.h>
+#include <tcutils/Timecode.h>
+
+namespace Dolby
+{
+    namespace TcUtils
+    {
+        class TimecodeBCD;
+    }
+}
+
+/**
+ * @brief Class with static functions to convert between Timecode and SMPTE 12M packed BCD words.
+ * @details The 32-bit word holds the BCD digits as used in LTC/VITC, RP188, DPX/EXR headers, MXF
+ * and AES3 channel status, with the frames in the least significant byte:
+ *
+ *     bits 31-24: hours   (bit 31: BGF2, bit 30: BGF1, bits 29-28: tens, bits 27-24: units)
+ *     bits 23-16: minutes (bit 23: BGF0, bits 22-20: tens, bits 19-16: units)
+ *     bits 15-8:  seconds (bit 15: field mark, bits 14-12: tens, bits 11-8: units)
+ *     bits 7-0:   frames  (bit 7: color frame, bit 6: drop-frame, bits 5-4: tens, bits 3-0: units)
+ *
+ * The flag positions follow the 30 fps bit assignment; at 25 fps SMPTE 12M assigns the field
+ * mark, BGF0 and BGF2 bits differently, but they are carried unmodified either way. Only
+ * framerates with a frame count up to 30 can be represented.
+ *
+ * The Decode functions validate the BCD digits, ranges and drop-frame rules without throwing, so
+ * they can be used to scan large amounts of (possibly corrupt) header data.
+ */
+class Dolby::TcUtils::TimecodeBCD
+{
+public:
+    /** @brief Flag bits that can be carried alongside the BCD digits. */
+    enum Flags : uint32_t
+    {
+        NONE        = 0x00000000,
+        DROP_FRAME  = 0x00000040,
+        COLOR_FRAME = 0x00000080,
+        FIELD_MARK  = 0x00008000,
+        BGF0        = 0x00800000,
+        BGF1        = 0x40000000,
+        BGF2        = 0x80000000,
+        FLAGS_MASK  = 0xC08080C0
+    };
+
+    /** @brief Result of decoding a word. */
+    enum class Status : uint8_t
+    {
+        OK = 0,
+        INVALID_DIGIT,         /// A BCD units digit is larger than 9
+        VALUE_OUT_OF_RANGE,    /// Hours, minutes, seconds or frames out of range
+        INVALID_DROP_FRAME,    /// The timecode is a dropped frame number for a drop-frame framerate
+        DROP_FLAG_MISMATCH,    /// The drop-frame flag does not match the framerate
+        UNSUPPORTED_FRAMERATE  /// The framerate has more than 30 frames per second
+    };
+
+    /** @brief Exception thrown when packing or unpacking for a framerate above 30 fps. */
+    struct UnsupportedFramerate : std::exception
+    {
+    };
+
+    /**
+     * @brief Pack a timecode into a BCD word.
+     * @details The drop-frame flag is set according to the framerate of the timecode; any other
+     * flags are taken from the flags argument. Throws UnsupportedFramerate for framerates above
+     * 30 fps and Timecode::ValueOutOfRange when the timecode is not set.
+     */
+    static uint32_t Pack(const Timecode& timecode, uint32_t flags = NONE);
+
+    /**
+     * @brief Unpack a BCD word into a timecode.
+     * @details Throws the corresponding Timecode exception when the word does not hold a valid
+     * timecode for the given framerate (Timecode::InvalidFormat for invalid digits or a mismatching
+     * drop-frame flag), or UnsupportedFramerate for framerates above 30 fps. Flags other than the
+     * drop-frame flag are ignored; use GetFlags to retrieve them.
+     */
+    static Timecode Unpack(uint32_t word,
+                           Framerate framerate,
+                           WrapMode wrapMode = WrapMode::DEFAULT);
+
+    /**
+     * @brief Decode a BCD word into a timecode without throwing.
+     * @details The timecode is only assigned when Status::OK is returned.
+     */
+    static Status Decode(uint32_t word,
+                         Framerate framerate,
+                         Timecode& timecode,
+                         WrapMode wrapMode = WrapMode::DEFAULT);
+
+    /** @brief Return the flag bits of a BCD word. */
+    static uint32_t GetFlags(uint32_t word)
+    {
+        return word & FLAGS_MASK;
+    }
+
+    /**
+     * @brief Pack an array of timecodes into BCD words.
+     * @details Same as calling Pack for each element.
+     */
+    static void Pack(const Timecode* timecodes,
+                     size_t count,
+                     uint32_t* words,
+                     uint32_t flags = NONE);
+
+    /**
+     * @brief Pack an array of frame counts (as returned by Timecode::ToFrames) into BCD words.
+     * @details Frame counts wrap at 24 hours. Throws UnsupportedFramerate for framerates above 30
+     * fps.
+     */
+    static void PackFrames(const int32_t* frames,
+                           size_t count,
+                           Framerate framerate,
+                           uint32_t* words,
+                           uint32_t flags = NONE);
+
+    /**
+     * @brief Decode an array of BCD words into timecodes without throwing.
+     * @details Invalid words leave the corresponding timecode untouched. When status is not
+     * nullptr, the status of each word is written to it.
+     * @return The number of successfully decoded words.
+     */
+    static size_t Decode(const uint32_t* words,
+                         size_t count,
+                         Framerate framerate,
+                         Timecode* timecodes,
+                         Status* status = nullptr);
+
+    /**
+     * @brief Decode an array of BCD words into frame counts without throwing.
+     * @details Writes the value Timecode::ToFrames would return for each valid word, and -1 for
+     * each word that would not decode with Status::OK. Uses SSE2 when available, processing four
+     * words at a time.
+     * @return The number of successfully decoded words.
+     */
+    static size_t DecodeFrames(const uint32_t* words,
+                               size_t count,
+                               Framerate framerate,
+                               int32_t* frames);
+};
+
+#endif
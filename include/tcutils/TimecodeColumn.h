@@ -0,0 +1,191 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef DOLBY_TCUTILS_TIMECODECOLUMN_H
+#define DOLBY_TCUTILS_TIMECODECOLUMN_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <tcutils/Framerate.h>
+#include <tcutils/Timecode.h>
+#include <tcutils/TimecodeDuration.h>
+#include <tcutils/Types.h>
+
+namespace Dolby
+{
+    namespace TcUtils
+    {
+        class TimecodeColumn;
+    }
+}
+
+/**
+ * @brief Column of timecodes that share one framerate and wrap mode, stored as a contiguous array
+ * of frame counts (Timecode::ToFrames).
+ * @details The column either owns its frame counts, or is a view of an array owned elsewhere
+ * (e.g. a column of a dataframe), which is then read and modified in place without copying. The
+ * bulk operations are plain loops over the frame counts that compilers vectorize; no Timecode
+ * objects are created, except by operator[] and ToStrings.
+ *
+ * The frame counts must be valid for the wrap mode: up to 24 hours for WRAP_AT_MIDNIGHT, up to
+ * 100 hours for CONTINUE; the constructors, Set and PushBack throw Timecode::ValueOutOfRange
+ * otherwise, e.g. for a CONTINUE timecode after midnight in a WRAP_AT_MIDNIGHT column. Timecodes
+ * that are not set can't be stored. Operations with timecodes or other columns require matching
+ * framerates and throw std::logic_error otherwise.
+ */
+class Dolby::TcUtils::TimecodeColumn
+{
+public:
+    /** @brief Construct an empty column that owns its frame counts. */
+    explicit TimecodeColumn(Framerate framerate, WrapMode wrapMode = WrapMode::DEFAULT);
+
+    /** @brief Construct a column that owns the given frame counts. */
+    TimecodeColumn(Framerate framerate,
+                   std::vector<int32_t> frames,
+                   WrapMode wrapMode = WrapMode::DEFAULT);
+
+    /**
+     * @brief Construct a column that owns the frame counts of an array of timecodes; requires
+     * matching framerates and set timecodes. The wrap mode is the one of the first timecode.
+     */
+    TimecodeColumn(const Timecode* timecodes, size_t count);
+
+    /**
+     * @brief Construct a column that is a view of an array of frame counts. The array must
+     * outlive the column and its copies; Offset and Set modify it.
+     */
+    static TimecodeColumn View(Framerate framerate,
+                               int32_t* frames,
+                               size_t count,
+                               WrapMode wrapMode = WrapMode::DEFAULT);
+
+    /** @brief Get the framerate. */
+    Framerate GetFramerate() const
+    {
+        return mFramerate;
+    }
+
+    /** @brief Get the wrap mode. */
+    WrapMode GetWrapMode() const
+    {
+        return mWrapMode;
+    }
+
+    /** @brief Whether this column is a view of an array owned elsewhere. */
+    bool IsView() const
+    {
+        return mIsView;
+    }
+
+    /** @brief Get the number of timecodes. */
+    size_t size() const
+    {
+        return IsView() ? mViewSize : mFrames.size();
+    }
+
+    /** @brief Whether the column has no timecodes. */
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    /** @brief Get the array of frame counts. */
+    const int32_t* data() const
+    {
+        return IsView() ? mView : mFrames.data();
+    }
+
+    /** @brief Get the timecode at index i. */
+    Timecode operator[](size_t i) const;
+
+    /**
+     * @brief Set the timecode at index i; requires a matching framerate and a set timecode in the
+     * range of the wrap mode.
+     */
+    void Set(size_t i, const Timecode& timecode);
+
+    /**
+     * @brief Append a timecode, as Set. Throws std::logic_error for views, which can't grow.
+     */
+    void PushBack(const Timecode& timecode);
+
+    /**
+     * @brief Add a duration to all timecodes, wrapping at midnight for WRAP_AT_MIDNIGHT. For
+     * CONTINUE, throws Timecode::ValueOutOfRange, leaving the column unchanged, when a timecode
+     * would end up out of range.
+     */
+    void Offset(const TimecodeDuration& offset);
+
+    /**
+     * @brief Compare all timecodes with a timecode, as Timecode::operator<: results[i] is -1, 0
+     * or 1 when the timecode at index i is before, equal to or after it. Results has size()
+     * elements.
+     */
+    void Compare(const Timecode& timecode, int8_t* results) const;
+
+    /**
+     * @brief Compare the timecodes with the timecodes at the same index of another column of the
+     * same size, as Compare.
+     */
+    void Compare(const TimecodeColumn& other, int8_t* results) const;
+
+    /**
+     * @brief Find the indices of the timecodes in [begin, end), in order, ordered as
+     * Timecode::operator< (so the range doesn't cross midnight). Indices is cleared first.
+     */
+    void Filter(const Timecode& begin, const Timecode& end, std::vector<size_t>& indices) const;
+
+    /** @brief Convert all timecodes to sample positions, as Timecode::ToSamples. */
+    void ToSamples(Samplerate samplerate, int64_t* samples) const;
+
+    /** @brief Convert all timecodes to seconds in real-time, as Timecode::ToSeconds. */
+    void ToSeconds(double* seconds) const;
+
+    /** @brief Convert all timecodes to strings, as Timecode::ToString. Strings is cleared first. */
+    void ToStrings(std::vector<std::string>& strings) const;
+
+private:
+    Framerate mFramerate;
+    WrapMode mWrapMode;
+    // the frame counts when owned, or the array and its size for views
+    std::vector<int32_t> mFrames;
+    bool mIsView{false};
+    int32_t* mView{nullptr};
+    size_t mViewSize{0};
+
+    int32_t* MutableData()
+    {
+        return IsView() ? mView : mFrames.data();
+    }
+
+    int32_t ToKey(const Timecode& timecode) const;
+    void Validate() const;
+};
+
+#endif
@@ -0,0 +1,203 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef DOLBY_TCUTILS_TIMECODEDURATION_H
+#define DOLBY_TCUTILS_TIMECODEDURATION_H
+
+#include <cstdint>
+#include <iosfwd>
+#include <stdexcept>
+#include <string>
+#include <tcutils/Framerate.h>
+#include <tcutils/Timecode.h>
+
+namespace Dolby
+{
+    namespace TcUtils
+    {
+        class TimecodeDuration;
+        std::ostream& operator<<(std::ostream& os, const TimecodeDuration& duration);
+    }
+}
+
+/**
+ * @brief Class representing a signed duration as a number of frames at a framerate.
+ * @details Durations are the result of subtracting timecodes and can be added to timecodes. All
+ * operations are constant time integer operations on the frame count.
+ *
+ * Durations are written as hh:mm:ss:ff (hh:mm:ss;ff for drop-frame framerates), with a leading '-'
+ * for negative durations and more than two hour digits when needed. The units are those of the
+ * timecode at that many frames after 00:00:00:00, so for drop-frame framerates a duration of 1800
+ * frames is written 00:01:00;02. This keeps start + duration consistent with the written values
+ * when the start is 00:00:00;00.
+ */
+class Dolby::TcUtils::TimecodeDuration
+{
+    Framerate mFramerate;
+    int64_t mValue;
+
+public:
+    /** @brief Exception thrown when constructing with an undefined framerate. */
+    struct UndefinedFramerate : std::exception
+    {
+    };
+
+    /** @brief Construct from a frame count. */
+    TimecodeDuration(Framerate framerate, int64_t frames);
+
+    /**
+     * @brief Construct from a string in hh:mm:ss:ff format (hh:mm:ss;ff for drop-frame), with
+     * optional leading '-'.
+     * @details Throws Timecode::StringParseError, Timecode::ValueOutOfRange or
+     * Timecode::InvalidDropFrame as the corresponding Timecode constructor.
+     */
+    TimecodeDuration(Framerate framerate, const char* str);
+
+    /** @brief Construct from a std::string, as the char pointer constructor. */
+    TimecodeDuration(Framerate framerate, const std::string& str);
+
+    /**
+     * @brief Get the duration from one timecode forward to the next occurrence of another, in
+     * [0, 24 hours): when to is before from, the duration crosses midnight.
+     */
+    static TimecodeDuration Between(const Timecode& from, const Timecode& to);
+
+    /** @brief Get the framerate. */
+    Framerate GetFramerate() const
+    {
+        return mFramerate;
+    }
+
+    /** @brief Get the number of frames. */
+    int64_t GetValue() const
+    {
+        return mValue;
+    }
+
+    /** @brief Get the hours unit of the absolute duration, which may exceed 99. */
+    int64_t GetUnitHours() const;
+    /** @brief Get the minutes unit of the absolute duration. */
+    int GetUnitMinutes() const;
+    /** @brief Get the seconds unit of the absolute duration. */
+    int GetUnitSeconds() const;
+    /** @brief Get the frames unit of the absolute duration. */
+    int GetUnitFrames() const;
+
+    /** @brief Convert to string, see the class description for the format. */
+    std::string ToString() const;
+
+    /** @brief Add a duration; requires matching framerates. */
+    TimecodeDuration& operator+=(const TimecodeDuration& other);
+    /** @brief Subtract a duration; requires matching framerates. */
+    TimecodeDuration& operator-=(const TimecodeDuration& other);
+
+    /** @brief Multiply by an integer factor. */
+    TimecodeDuration& operator*=(int64_t factor)
+    {
+        mValue *= factor;
+        return *this;
+    }
+
+    /** @brief Get the negated duration. */
+    TimecodeDuration operator-() const
+    {
+        return TimecodeDuration(mFramerate, -mValue);
+    }
+
+    /** @brief Compare with another duration (equals). */
+    bool operator==(const TimecodeDuration& other) const
+    {
+        return mFramerate == other.mFramerate && mValue == other.mValue;
+    }
+    /** @brief Compare with another duration (not equals). */
+    bool operator!=(const TimecodeDuration& other) const
+    {
+        return !(*this == other);
+    }
+    /** @brief Compare with another duration (less than); requires matching framerates. */
+    bool operator<(const TimecodeDuration& other) const;
+    /** @brief Compare with another duration (greater than); requires matching framerates. */
+    bool operator>(const TimecodeDuration& other) const;
+    /** @brief Compare with another duration (less or equal); requires matching framerates. */
+    bool operator<=(const TimecodeDuration& other) const;
+    /** @brief Compare with another duration (greater or equal); requires matching framerates. */
+    bool operator>=(const TimecodeDuration& other) const;
+
+private:
+    /** @brief Helper function to ensure operators are used on durations with the same framerate. */
+    void RequireMatchingFramerate(const TimecodeDuration& other) const;
+};
+
+namespace Dolby
+{
+    namespace TcUtils
+    {
+        inline TimecodeDuration operator+(TimecodeDuration a, const TimecodeDuration& b)
+        {
+            return a += b;
+        }
+
+        inline TimecodeDuration operator-(TimecodeDuration a, const TimecodeDuration& b)
+        {
+            return a -= b;
+        }
+
+        inline TimecodeDuration operator*(TimecodeDuration duration, int64_t factor)
+        {
+            return duration *= factor;
+        }
+
+        /**
+         * @brief Get the signed duration from timecode b to timecode a, without wrapping at
+         * midnight; requires matching framerates and set timecodes. See TimecodeDuration::Between
+         * for the duration crossing midnight.
+         */
+        TimecodeDuration operator-(const Timecode& a, const Timecode& b);
+
+        /**
+         * @brief Add a duration to a timecode; requires matching framerates and a set timecode.
+         * @details The result wraps at midnight unless the timecode uses WrapMode::CONTINUE, in
+         * which case Timecode::ValueOutOfRange is thrown when the result is out of range.
+         */
+        Timecode operator+(const Timecode& timecode, const TimecodeDuration& duration);
+
+        /** @brief Subtract a duration from a timecode, as operator+. */
+        Timecode operator-(const Timecode& timecode, const TimecodeDuration& duration);
+
+        inline Timecode& operator+=(Timecode& timecode, const TimecodeDuration& duration)
+        {
+            return timecode = timecode + duration;
+        }
+
+        inline Timecode& operator-=(Timecode& timecode, const TimecodeDuration& duration)
+        {
+            return timecode = timecode - duration;
+        }
+    }
+}
+
+#endif
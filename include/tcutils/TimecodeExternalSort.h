@@ -0,0 +1,109 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef DOLBY_TCUTILS_TIMECODEEXTERNALSORT_H
+#define DOLBY_TCUTILS_TIMECODEEXTERNALSORT_H
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <tcutils/TimecodeMerger.h>
+
+namespace Dolby
+{
+    namespace TcUtils
+    {
+        class TimecodeExternalSort;
+    }
+}
+
+/**
+ * @brief External merge sort of events by timecode, for streams larger than the available memory
+ * (e.g. multi-GB logs).
+ * @details Events are added and buffered up to a memory limit; a full buffer is sorted and
+ * written to a temporary file as a sorted run. After the last event, the runs are memory-mapped
+ * and merged with a TimecodeMerger, so sorting takes one pass to write the runs and one pass to
+ * read them, and the merge reads the runs sequentially through the page cache. Without runs, the
+ * events are sorted in memory.
+ *
+ * Events are ordered as TimecodeMerger orders them: by the exact real-time start of the frame of
+ * their timecode, with events at the same time in the order in which they were added (a stable
+ * sort). Timecodes must be set (Timecode::ValueOutOfRange otherwise). The temporary files are
+ * removed by the destructor.
+ */
+class Dolby::TcUtils::TimecodeExternalSort : public Dolby::TcUtils::TimecodeEventSource
+{
+public:
+    /** @brief Exception thrown when a temporary file can't be written or mapped. */
+    struct FileError : std::exception
+    {
+    };
+
+    /**
+     * @brief Construct a sort that writes its runs to the given directory, buffering up to about
+     * the given number of bytes of events in memory.
+     */
+    explicit TimecodeExternalSort(const std::string& directory, size_t memoryLimit = 64 << 20);
+    ~TimecodeExternalSort() override;
+
+    TimecodeExternalSort(const TimecodeExternalSort&) = delete;
+    TimecodeExternalSort& operator=(const TimecodeExternalSort&) = delete;
+
+    /** @brief Add an event; events can't be added after the first call to Next. */
+    void Add(TimecodeEvent event);
+
+    /** @brief Get the number of runs written to temporary files so far. */
+    size_t GetRunCount() const
+    {
+        return mPaths.size();
+    }
+
+    /** @brief Get the next event in order; returns false after the last event. */
+    bool Next(TimecodeEvent& event) override;
+
+private:
+    class Run;
+
+    std::string mDirectory;
+    size_t mMemoryLimit;
+    std::string mPrefix;
+    // the buffered events and their size in bytes
+    std::vector<TimecodeEvent> mBuffer;
+    size_t mBufferSize{0};
+    std::vector<std::string> mPaths;
+    std::vector<std::unique_ptr<Run>> mRuns;
+    std::unique_ptr<TimecodeMerger> mMerger;
+    bool mReading{false};
+    size_t mNext{0};
+
+    void SortBuffer();
+    void WriteRun();
+};
+
+#endif
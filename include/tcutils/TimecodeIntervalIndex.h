@@ -0,0 +1,136 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef DOLBY_TCUTILS_TIMECODEINTERVALINDEX_H
+#define DOLBY_TCUTILS_TIMECODEINTERVALINDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include <tcutils/Framerate.h>
+#include <tcutils/Timecode.h>
+
+namespace Dolby
+{
+    namespace TcUtils
+    {
+        class TimecodeIntervalIndex;
+    }
+}
+
+/**
+ * @brief Static index of timecode intervals, e.g. the in and out points of EDL events, for overlap
+ * queries.
+ * @details Intervals are half open: an interval [in, out) contains the frames from in up to, but
+ * not including, out; empty intervals (in equals out) are never found. Intervals are keyed by
+ * Timecode::ToFrames(), so an interval can't cross midnight; use WrapMode::CONTINUE timecodes (e.g.
+ * 23:00:00:00 to 25:00:00:00) for intervals that do.
+ *
+ * The index is an implicit augmented interval tree: the intervals sorted by in point, stored in one
+ * array that is laid out as a binary search tree, with for every node the maximum out point of its
+ * subtree. Building takes O(n log n), queries take O(log n + k) for k results. Results are the
+ * indices of the intervals in the arrays the index was built from, ordered by in point (and by
+ * index for equal in points), and are appended to the given vector.
+ */
+class Dolby::TcUtils::TimecodeIntervalIndex
+{
+public:
+    /** @brief Exception thrown for intervals of which the out point is before the in point. */
+    struct InvalidInterval : std::exception
+    {
+    };
+
+    /**
+     * @brief Build the index of the intervals [in[i], out[i]); requires matching framerates and
+     * set timecodes.
+     * @details The intervals are sorted on the given number of threads (0 for the number of
+     * hardware threads), as TimecodeSort::ParallelSort; small arrays are sorted with fewer threads.
+     */
+    TimecodeIntervalIndex(const Timecode* in,
+                          const Timecode* out,
+                          size_t count,
+                          unsigned threads = 0);
+
+    /** @brief Get the framerate of the intervals; undefined for an empty index. */
+    Framerate GetFramerate() const
+    {
+        return mFramerate;
+    }
+
+    /** @brief Get the number of intervals. */
+    size_t size() const
+    {
+        return mCount;
+    }
+
+    /** @brief Find the intervals that contain the frame (stabbing query). */
+    void FindOverlapping(const Timecode& timecode, std::vector<size_t>& indices) const;
+
+    /**
+     * @brief Find the intervals that have frames in common with the interval [begin, end) (range
+     * query).
+     */
+    void FindOverlapping(const Timecode& begin,
+                         const Timecode& end,
+                         std::vector<size_t>& indices) const;
+
+    /**
+     * @brief Find the intervals that contain each of an array of frames (bulk stabbing query).
+     * @details The results for timecodes[i] are indices[offsets[i]] up to indices[offsets[i + 1]];
+     * offsets and indices are cleared first, and offsets gets count + 1 elements.
+     */
+    void FindOverlapping(const Timecode* timecodes,
+                         size_t count,
+                         std::vector<size_t>& offsets,
+                         std::vector<size_t>& indices) const;
+
+    /** @brief Count the intervals that have frames in common with the interval [begin, end). */
+    size_t CountOverlapping(const Timecode& begin, const Timecode& end) const;
+
+private:
+    struct Node
+    {
+        int64_t in;
+        int64_t out;
+        int64_t maxOut; // the maximum out point of the subtree of this node
+        size_t index;
+    };
+
+    Framerate mFramerate;
+    size_t mCount;
+    // the intervals that are not empty, in tree order
+    std::vector<Node> mNodes;
+    int mRootLevel;
+
+    int64_t ToKey(const Timecode& timecode) const;
+
+    template <class Visitor>
+    void Visit(int64_t begin, int64_t end, Visitor& visitor) const;
+};
+
+#endif
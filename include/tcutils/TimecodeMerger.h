@@ -0,0 +1,119 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef DOLBY_TCUTILS_TIMECODEMERGER_H
+#define DOLBY_TCUTILS_TIMECODEMERGER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <tcutils/Timecode.h>
+
+namespace Dolby
+{
+    namespace TcUtils
+    {
+        struct TimecodeEvent;
+        class TimecodeEventSource;
+        class TimecodeMerger;
+    }
+}
+
+/**
+ * @brief An event keyed by timecode, e.g. a line of a log, with its data.
+ */
+struct Dolby::TcUtils::TimecodeEvent
+{
+    Timecode timecode;
+    std::string data;
+};
+
+/**
+ * @brief Interface of a stream of events, e.g. the lines of a log file.
+ */
+class Dolby::TcUtils::TimecodeEventSource
+{
+public:
+    virtual ~TimecodeEventSource() = default;
+
+    /** @brief Get the next event; returns false at the end of the stream. */
+    virtual bool Next(TimecodeEvent& event) = 0;
+};
+
+/**
+ * @brief Streaming k-way merge of sorted event streams into one stream ordered by timecode.
+ * @details The streams may have timecodes of different framerates; events are ordered by the
+ * exact real-time start of the frame of their timecode, as Timecode::Compare, with events at the
+ * same time in the order of their streams (a stable merge). Timecodes must be set
+ * (Timecode::ValueOutOfRange otherwise).
+ *
+ * The merge is a loser tree (tournament tree) over the head events of the streams: taking an
+ * event and replacing it with the next event of its stream costs log2(k) comparisons of
+ * precomputed integer keys, and only one event per stream is held in memory. Streams that are
+ * not sorted are merged as they are, so nearly sorted streams give nearly sorted output.
+ */
+class Dolby::TcUtils::TimecodeMerger
+{
+public:
+    /**
+     * @brief Construct a merge of the given streams, which must outlive the merge. Reads the
+     * first event of every stream.
+     */
+    explicit TimecodeMerger(const std::vector<TimecodeEventSource*>& sources);
+
+    /** @brief Get the next event in order; returns false when all streams have ended. */
+    bool Next(TimecodeEvent& event);
+
+    /** @brief Get the index of the stream of the event returned last by Next. */
+    size_t GetSource() const
+    {
+        return mSource;
+    }
+
+private:
+    struct Head
+    {
+        TimecodeEvent event;
+        // the start time of the frame is time / rate seconds
+        int64_t time;
+        int64_t rate;
+        bool ended;
+    };
+
+    std::vector<TimecodeEventSource*> mSources;
+    std::vector<Head> mHeads;
+    // mTree[0] is the winner, mTree[1..k) are the losers of the matches in the tree
+    std::vector<size_t> mTree;
+    size_t mSource;
+
+    void Read(size_t source);
+    bool Less(size_t a, size_t b) const;
+    void Replay(size_t source);
+};
+
+#endif
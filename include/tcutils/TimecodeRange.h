@@ -0,0 +1,284 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef DOLBY_TCUTILS_TIMECODERANGE_H
+#define DOLBY_TCUTILS_TIMECODERANGE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <tcutils/Framerate.h>
+#include <tcutils/Timecode.h>
+#include <tcutils/TimecodeDuration.h>
+
+namespace Dolby
+{
+    namespace TcUtils
+    {
+        class TimecodeRange;
+    }
+}
+
+/**
+ * @brief Lazy view of the consecutive timecodes from a begin timecode up to (not including) an end
+ * timecode.
+ * @details The range stores only its first frame and size; timecodes are computed on access. The
+ * iterators are random access iterators: stepping, distance, indexing and comparison are integer
+ * operations, so std::distance, std::lower_bound and std::advance take constant time per step, and
+ * the range can be used with the parallel algorithms of C++17 (e.g. std::for_each with
+ * std::execution::par). Dereferencing returns a Timecode by value, and it->member calls the member
+ * on a copy held by a proxy.
+ *
+ * Ranges of timecodes that wrap at midnight may cross midnight: the range from 23:59:59:00 to
+ * 00:00:01:00 has 2 seconds of timecodes. Note that their timecodes are then not sorted by
+ * Timecode::operator<; use Find or IndexOf to look up a timecode in constant time.
+ */
+class Dolby::TcUtils::TimecodeRange
+{
+public:
+    /** @brief Exception thrown for ranges with a negative size. */
+    struct InvalidRange : std::exception
+    {
+    };
+
+    /** @brief Random access iterator over the timecodes of a range. */
+    class Iterator
+    {
+        Framerate mFramerate;
+        WrapMode mWrapMode{WrapMode::DEFAULT};
+        int64_t mFramesPerDay{1};
+        int64_t mFrame{0};
+
+        friend class TimecodeRange;
+
+        Iterator(Framerate framerate, WrapMode wrapMode, int64_t framesPerDay, int64_t frame)
+        : mFramerate(framerate)
+        , mWrapMode(wrapMode)
+        , mFramesPerDay(framesPerDay)
+        , mFrame(frame)
+        {
+        }
+
+    public:
+        /** @brief Holder of a dereferenced timecode, for it->member. */
+        class Pointer
+        {
+            Timecode mTimecode;
+
+        public:
+            explicit Pointer(const Timecode& timecode)
+            : mTimecode(timecode)
+            {
+            }
+            const Timecode* operator->() const
+            {
+                return &mTimecode;
+            }
+        };
+
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef Timecode value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef Pointer pointer;
+        typedef Timecode reference;
+
+        Iterator() = default;
+
+        Timecode operator*() const
+        {
+            const int64_t frame =
+                mWrapMode == WrapMode::WRAP_AT_MIDNIGHT ? mFrame % mFramesPerDay : mFrame;
+            return Timecode(mFramerate, Frames(static_cast<int32_t>(frame)), mWrapMode);
+        }
+        Pointer operator->() const
+        {
+            return Pointer(**this);
+        }
+        Timecode operator[](difference_type n) const
+        {
+            return *(*this + n);
+        }
+
+        Iterator& operator++()
+        {
+            ++mFrame;
+            return *this;
+        }
+        Iterator operator++(int)
+        {
+            Iterator previous = *this;
+            ++mFrame;
+            return previous;
+        }
+        Iterator& operator--()
+        {
+            --mFrame;
+            return *this;
+        }
+        Iterator operator--(int)
+        {
+            Iterator previous = *this;
+            --mFrame;
+            return previous;
+        }
+        Iterator& operator+=(difference_type n)
+        {
+            mFrame += n;
+            return *this;
+        }
+        Iterator& operator-=(difference_type n)
+        {
+            mFrame -= n;
+            return *this;
+        }
+        Iterator operator+(difference_type n) const
+        {
+            Iterator result = *this;
+            return result += n;
+        }
+        Iterator operator-(difference_type n) const
+        {
+            Iterator result = *this;
+            return result -= n;
+        }
+        friend Iterator operator+(difference_type n, const Iterator& it)
+        {
+            return it + n;
+        }
+        difference_type operator-(const Iterator& other) const
+        {
+            return static_cast<difference_type>(mFrame - other.mFrame);
+        }
+
+        bool operator==(const Iterator& other) const
+        {
+            return mFrame == other.mFrame;
+        }
+        bool operator!=(const Iterator& other) const
+        {
+            return mFrame != other.mFrame;
+        }
+        bool operator<(const Iterator& other) const
+        {
+            return mFrame < other.mFrame;
+        }
+        bool operator>(const Iterator& other) const
+        {
+            return mFrame > other.mFrame;
+        }
+        bool operator<=(const Iterator& other) const
+        {
+            return mFrame <= other.mFrame;
+        }
+        bool operator>=(const Iterator& other) const
+        {
+            return mFrame >= other.mFrame;
+        }
+    };
+
+    /**
+     * @brief Construct the range from begin up to end; requires matching framerates and set
+     * timecodes.
+     * @details When begin wraps at midnight, the range continues past midnight when end is before
+     * begin, and is empty when they are equal. Otherwise throws InvalidRange when end is before
+     * begin.
+     */
+    TimecodeRange(const Timecode& begin, const Timecode& end);
+
+    /**
+     * @brief Construct the range of the given length from begin; requires matching framerates, a
+     * set timecode and a length that is not negative.
+     * @details Throws Timecode::ValueOutOfRange when the range doesn't wrap at midnight and
+     * continues past the last valid timecode.
+     */
+    TimecodeRange(const Timecode& begin, const TimecodeDuration& length);
+
+    /** @brief Get the framerate. */
+    Framerate GetFramerate() const
+    {
+        return mBegin.mFramerate;
+    }
+
+    Iterator begin() const
+    {
+        return mBegin;
+    }
+    Iterator end() const
+    {
+        return mBegin + static_cast<Iterator::difference_type>(mSize);
+    }
+
+    /** @brief Get the number of timecodes. */
+    size_t size() const
+    {
+        return mSize;
+    }
+
+    /** @brief Whether the range has no timecodes. */
+    bool empty() const
+    {
+        return mSize == 0;
+    }
+
+    /** @brief Get the timecode at the given index. */
+    Timecode operator[](size_t index) const
+    {
+        return mBegin[static_cast<Iterator::difference_type>(index)];
+    }
+
+    /** @brief Get the length of the range. */
+    TimecodeDuration GetDuration() const
+    {
+        return TimecodeDuration(GetFramerate(), static_cast<int64_t>(mSize));
+    }
+
+    /**
+     * @brief Get the index of the first occurrence of the timecode in the range, or -1 if the range
+     * doesn't contain it; requires a matching framerate.
+     */
+    int64_t IndexOf(const Timecode& timecode) const;
+
+    /** @brief Get the iterator to the first occurrence of the timecode, or end(); as IndexOf. */
+    Iterator Find(const Timecode& timecode) const
+    {
+        const int64_t index = IndexOf(timecode);
+        return index < 0 ? end() : mBegin + static_cast<Iterator::difference_type>(index);
+    }
+
+    /** @brief Whether the range contains the timecode; as IndexOf. */
+    bool Contains(const Timecode& timecode) const
+    {
+        return IndexOf(timecode) >= 0;
+    }
+
+private:
+    Iterator mBegin;
+    size_t mSize;
+};
+
+#endif
@@ -0,0 +1,78 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef DOLBY_TCUTILS_TIMECODESORT_H
+#define DOLBY_TCUTILS_TIMECODESORT_H
+
+#include <cstddef>
+#include <tcutils/Timecode.h>
+#include <tcutils/TimecodeSamples.h>
+#include <tcutils/TimecodeSubframes.h>
+
+namespace Dolby
+{
+    namespace TcUtils
+    {
+        class TimecodeSort;
+    }
+}
+
+/**
+ * @brief Class with static functions to sort large arrays of timecodes.
+ * @details The timecodes are sorted with an LSD radix sort on a key derived from the frame label,
+ * instead of comparing the hours, minutes, seconds and frames on every comparison: O(n) with a
+ * few passes of 11 bits over the keys, and one pass to move the timecodes. The sort is stable.
+ *
+ * The order is the order of Timecode::operator<, so the timecodes of an array require matching
+ * framerates (std::logic_error otherwise), and timecodes that are not set sort first. Timecodes
+ * with subframes or samples are ordered by timecode, then by subframes or remaining samples;
+ * subframes require matching denominators, remaining samples are assumed to be at the same
+ * samplerate.
+ *
+ * The parallel versions split every pass over the given number of threads (0 for the number of
+ * hardware threads). They pay off for millions of timecodes; small arrays are sorted with fewer
+ * threads.
+ */
+class Dolby::TcUtils::TimecodeSort
+{
+public:
+    /** @brief Sort an array of timecodes. */
+    static void Sort(Timecode* timecodes, size_t count);
+    /** @brief Sort an array of timecodes with subframes. */
+    static void Sort(TimecodeSubframes* timecodes, size_t count);
+    /** @brief Sort an array of timecodes with remaining samples. */
+    static void Sort(TimecodeSamples* timecodes, size_t count);
+
+    /** @brief Sort an array of timecodes, using multiple threads. */
+    static void ParallelSort(Timecode* timecodes, size_t count, unsigned threads = 0);
+    /** @brief Sort an array of timecodes with subframes, using multiple threads. */
+    static void ParallelSort(TimecodeSubframes* timecodes, size_t count, unsigned threads = 0);
+    /** @brief Sort an array of timecodes with remaining samples, using multiple threads. */
+    static void ParallelSort(TimecodeSamples* timecodes, size_t count, unsigned threads = 0);
+};
+
+#endif
@@ -28,7 +28,9 @@
 #ifndef DOLBY_TCUTILS_TIMEINSECONDS_H
 #define DOLBY_TCUTILS_TIMEINSECONDS_H
 
+#include <chrono>
 #include <cstdint>
+#include <ratio>
 
 /**
  * @brief Strong types used by Timecode and utility classes.
@@ -46,6 +48,10 @@ namespace Dolby
         class Frames;
         class Seconds;
         class DAMFSeconds;
+        class Rational;
+        template <int64_t Rate>
+        class Ticks;
+        typedef Ticks<1000000000> Nanoseconds;
     }
 }
 
@@ -142,10 +148,85 @@ public:
     }
 };
 
+/**
+ * @brief Strong type class representing an exact rational value numerator / denominator, e.g. a
+ * framerate of 48000 / 1001 frames per second.
+ */
+class Dolby::TcUtils::Rational
+{
+    int64_t mNumerator;
+    int64_t mDenominator;
+
+public:
+    explicit Rational(int64_t numerator, int64_t denominator = 1)
+    : mNumerator(numerator)
+    , mDenominator(denominator)
+    {
+    }
+    int64_t GetNumerator() const
+    {
+        return mNumerator;
+    }
+    int64_t GetDenominator() const
+    {
+        return mDenominator;
+    }
+};
+
+/**
+ * @brief Strong type class representing an integer time in ticks of 1/Rate seconds.
+ * @details Used as an exact integer alternative to Seconds; Nanoseconds is Ticks<1000000000>.
+ * Converts to and from std::chrono durations; converting from a duration with a finer period
+ * truncates toward zero, like std::chrono::duration_cast.
+ */
+template <int64_t Rate>
+class Dolby::TcUtils::Ticks
+{
+    static_assert(Rate > 0, "tick rate must be positive");
+
+    int64_t mValue;
+
+public:
+    /** @brief The std::chrono duration type with the same period. */
+    typedef std::chrono::duration<int64_t, std::ratio<1, Rate>> Duration;
+
+    explicit Ticks(int64_t value)
+    : mValue(value)
+    {
+    }
+
+    template <class Rep, class Period>
+    explicit Ticks(std::chrono::duration<Rep, Period> duration)
+    : mValue(std::chrono::duration_cast<Duration>(duration).count())
+    {
+    }
+
+    int64_t GetValue() const
+    {
+        return mValue;
+    }
+
+    Duration ToDuration() const
+    {
+        return Duration(mValue);
+    }
+
+    static constexpr int64_t GetRate()
+    {
+        return Rate;
+    }
+};
+
 namespace Dolby
 {
     namespace TcUtils
     {
+        template <int64_t Rate>
+        inline bool operator==(const Ticks<Rate>& a, const Ticks<Rate>& b)
+        {
+            return a.GetValue() == b.GetValue();
+        }
+
         inline bool operator==(const Seconds& a, const Seconds& b)
         {
             return a.GetValue() == b.GetValue();
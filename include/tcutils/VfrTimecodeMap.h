@@ -0,0 +1,172 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef DOLBY_TCUTILS_VFRTIMECODEMAP_H
+#define DOLBY_TCUTILS_VFRTIMECODEMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include <tcutils/Framerate.h>
+#include <tcutils/Timecode.h>
+
+namespace Dolby
+{
+    namespace TcUtils
+    {
+        class VfrTimecodeMap;
+    }
+}
+
+/**
+ * @brief Map between the frames of variable-frame-rate (VFR) footage, e.g. from phones and screen
+ * capture, and constant-rate timecode.
+ * @details The footage is described by a table of presentation timestamps, one per frame, in
+ * ticks of a timebase of numerator / denominator seconds (e.g. 1 / 90000). The first frame is
+ * labelled with a start timecode, and every frame with the timecode of the frame of the start
+ * timecode framerate that contains its timestamp (TRUNCATE) or that starts nearest to it
+ * (NEAREST), counting from the start timecode. Several frames may get the same timecode, and
+ * timecodes may be skipped. The computations are exact integer arithmetic.
+ *
+ * The table either is owned by the map, or is a view of an array owned elsewhere, e.g. a
+ * memory-mapped file of 64-bit timestamps, so that the table of a long file doesn't need to be
+ * read or copied up front: View doesn't check that the timestamps are sorted, which Validate
+ * does on request. Timestamps are looked up with an interpolation search, which takes few steps
+ * for the nearly evenly spaced timestamps of typical footage and falls back to bisection
+ * otherwise; it only reads the pages of the timestamps it visits, and throws UnsortedTimestamps
+ * when those are out of order.
+ *
+ * The wrap mode of the start timecode applies: timecodes wrap at midnight, or run up to 100 hours
+ * and throw Timecode::ValueOutOfRange beyond.
+ */
+class Dolby::TcUtils::VfrTimecodeMap
+{
+public:
+    /**
+     * @brief Exception thrown for an empty timestamp table, a timebase that is not positive, or a
+     * start timecode that is not set.
+     */
+    struct InvalidParameter : std::exception
+    {
+    };
+
+    /** @brief Exception thrown for timestamps that are not strictly increasing. */
+    struct UnsortedTimestamps : std::exception
+    {
+    };
+
+    /** @brief Construct a map that owns the given timestamp table. */
+    VfrTimecodeMap(std::vector<int64_t> timestamps,
+                   int64_t timebaseNumerator,
+                   int64_t timebaseDenominator,
+                   const Timecode& start);
+
+    /**
+     * @brief Construct a map that is a view of an array of timestamps, without reading them. The
+     * array must outlive the map and its copies.
+     */
+    static VfrTimecodeMap View(const int64_t* timestamps,
+                               size_t count,
+                               int64_t timebaseNumerator,
+                               int64_t timebaseDenominator,
+                               const Timecode& start);
+
+    /** @brief Get the start timecode, the timecode of the first frame. */
+    const Timecode& GetStart() const
+    {
+        return mStart;
+    }
+
+    /** @brief Get the number of frames. */
+    size_t GetFrameCount() const
+    {
+        return IsView() ? mViewSize : mTimestamps.size();
+    }
+
+    /** @brief Get the timestamp of a frame. */
+    int64_t GetTimestamp(size_t frame) const
+    {
+        return data()[frame];
+    }
+
+    /**
+     * @brief Check that all timestamps are strictly increasing, reading the whole table; throws
+     * UnsortedTimestamps otherwise. The constructor of a map that owns its table does this.
+     */
+    void Validate() const;
+
+    /** @brief Whether this map is a view of an array owned elsewhere. */
+    bool IsView() const
+    {
+        return mIsView;
+    }
+
+    /** @brief Get the timecode of a frame. */
+    Timecode ToTimecode(size_t frame, RoundingMode roundingMode = RoundingMode::DEFAULT) const;
+
+    /** @brief Get the timecodes of all frames; timecodes has GetFrameCount() elements. */
+    void ToTimecodes(Timecode* timecodes, RoundingMode roundingMode = RoundingMode::DEFAULT) const;
+
+    /**
+     * @brief Get the frame presented at the start of the timecode: the last frame with a
+     * timestamp not after it (TRUNCATE), or the frame with the timestamp nearest to it, half way
+     * rounds up (NEAREST). With TRUNCATE, returns -1 for timecodes before the first frame; the
+     * last frame is taken to last indefinitely. Requires a matching framerate and a set timecode.
+     */
+    int64_t ToFrame(const Timecode& timecode,
+                    RoundingMode roundingMode = RoundingMode::TRUNCATE) const;
+
+    /**
+     * @brief Get the last frame with a timestamp not after the given timestamp, or -1 when it is
+     * before the first frame.
+     */
+    int64_t FindFrame(int64_t timestamp) const;
+
+private:
+    Timecode mStart;
+    int64_t mNumerator;
+    int64_t mDenominator;
+    int64_t mStartFrame;
+    int64_t mFramesPerDay;
+    // the table when owned, or the array and its size for views
+    std::vector<int64_t> mTimestamps;
+    bool mIsView{false};
+    const int64_t* mView{nullptr};
+    size_t mViewSize{0};
+
+    VfrTimecodeMap(int64_t timebaseNumerator, int64_t timebaseDenominator, const Timecode& start);
+
+    const int64_t* data() const
+    {
+        return IsView() ? mView : mTimestamps.data();
+    }
+
+    Timecode TimecodeOf(int64_t frame) const;
+};
+
+#endif
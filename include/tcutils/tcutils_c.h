@@ -0,0 +1,251 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef DOLBY_TCUTILS_TCUTILS_C_H
+#define DOLBY_TCUTILS_TCUTILS_C_H
+
+/**
+ * @file
+ * @brief C interface of TcUtils, for bindings from other languages (e.g. Python ctypes or cffi,
+ * Rust or Go).
+ * @details The interface converts whole arrays per call, so that a binding crosses the language
+ * boundary once per buffer (e.g. a NumPy array or an Arrow column) rather than once per value.
+ * Every array is given by a pointer to its first element and a stride, the distance in bytes
+ * between consecutive elements, as in NumPy: the element size for contiguous arrays (e.g.
+ * sizeof(int64_t)), negative for reversed views, or the struct size for columns of arrays of
+ * structs, which are converted in place. An input with stride 0 repeats its first element (a
+ * broadcast); outputs of more than one element and arrays of strings can't have stride 0.
+ *
+ * Timecodes are given as frame counts since midnight (as Timecode::ToFrames), at the framerate of
+ * the call; larger counts wrap at midnight. Times (frames, samples, seconds) must not be negative.
+ *
+ * No function throws. Every function returns a tcutils_status. The array functions convert all
+ * elements; an element that fails to convert gets -1 as its result, and the function returns the
+ * status of the first failure. When first_error is not NULL, the index of the first failed element
+ * is stored there, or count when no element failed. Invalid arguments of the call itself (a NULL
+ * array, an output with stride 0, an unsupported framerate or samplerate, ...) return
+ * TCUTILS_ERROR_INVALID_ARGUMENT with first_error set to count, before any element is converted.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /** @brief Status codes of all functions; the enums have the size of an int. */
+    typedef enum tcutils_status
+    {
+        TCUTILS_OK                     = 0,
+        TCUTILS_ERROR_INVALID_ARGUMENT = 1, /**< null pointer, unsupported framerate, ... */
+        TCUTILS_ERROR_PARSE            = 2, /**< a string that is not a timecode or framerate */
+        TCUTILS_ERROR_OUT_OF_RANGE     = 3, /**< a negative, too large or invalid time */
+        TCUTILS_ERROR_INTERNAL         = 4  /**< any other error, e.g. out of memory */
+    } tcutils_status;
+
+    /** @brief Rounding of times between frames to frames, see RoundingMode. */
+    typedef enum tcutils_rounding
+    {
+        TCUTILS_ROUNDING_TRUNCATE = 0,
+        TCUTILS_ROUNDING_NEAREST  = 1
+    } tcutils_rounding;
+
+    /** @brief Frame boundary to find for a sample position, see FrameBoundary. */
+    typedef enum tcutils_boundary
+    {
+        TCUTILS_BOUNDARY_FLOOR   = 0,
+        TCUTILS_BOUNDARY_ROUND   = 1,
+        TCUTILS_BOUNDARY_CEILING = 2
+    } tcutils_boundary;
+
+    /**
+     * @brief A framerate as an exact rational value in FPS, e.g. 30000/1001 for 29.97, and a
+     * drop-frame flag; see Framerate(Rational, bool) for the supported values.
+     */
+    typedef struct tcutils_framerate
+    {
+        int64_t numerator;
+        int64_t denominator;
+        int32_t drop; /**< nonzero for drop-frame */
+    } tcutils_framerate;
+
+    /** @brief Get the version of TcUtils, e.g. "1.3.0". */
+    const char* tcutils_version(void);
+
+    /** @brief Get a description of a status code. */
+    const char* tcutils_status_string(tcutils_status status);
+
+    /** @brief Parse a framerate string, e.g. "25" or "29.97df", as Framerate(std::string). */
+    tcutils_status tcutils_framerate_parse(const char* str, tcutils_framerate* framerate);
+
+    /**
+     * @brief Get the frame count (frames per timecode second) of a framerate, e.g. 30 for 29.97.
+     */
+    tcutils_status tcutils_framerate_frame_count(tcutils_framerate framerate, int32_t* frameCount);
+
+    /**
+     * @brief Parse timecode strings, e.g. "01:00:00:00" ("01:00:00;00" for drop-frame), into
+     * frame counts.
+     * @param strings Fixed-width strings of strings_stride bytes each (e.g. a NumPy array of dtype
+     * S11); a string ends at its first NUL byte or at the end of its field. strings_stride must
+     * not be 0; a negative strings_stride gives fields of -strings_stride bytes in reverse order.
+     */
+    tcutils_status tcutils_parse_n(tcutils_framerate framerate,
+                                   const char* strings,
+                                   ptrdiff_t strings_stride,
+                                   size_t count,
+                                   int64_t* frames,
+                                   ptrdiff_t frames_stride,
+                                   size_t* first_error);
+
+    /**
+     * @brief Format frame counts as timecode strings, into fixed-width fields of strings_stride
+     * bytes, padded with NUL bytes. The width must be at least the length of a timecode: 11 bytes,
+     * or 12 for framerates over 100 FPS; failed elements get an empty string. A negative
+     * strings_stride gives fields of -strings_stride bytes in reverse order, as tcutils_parse_n.
+     */
+    tcutils_status tcutils_format_n(tcutils_framerate framerate,
+                                    const int64_t* frames,
+                                    ptrdiff_t frames_stride,
+                                    size_t count,
+                                    char* strings,
+                                    ptrdiff_t strings_stride,
+                                    size_t* first_error);
+
+    /** @brief Convert sample positions to frame counts, as Timecode(framerate, samples, ...). */
+    tcutils_status tcutils_samples_to_tc_n(tcutils_framerate framerate,
+                                           double samplerate,
+                                           tcutils_rounding rounding,
+                                           const int64_t* samples,
+                                           ptrdiff_t samples_stride,
+                                           size_t count,
+                                           int64_t* frames,
+                                           ptrdiff_t frames_stride,
+                                           size_t* first_error);
+
+    /** @brief Convert frame counts to sample positions, as Timecode::ToSamples. */
+    tcutils_status tcutils_tc_to_samples_n(tcutils_framerate framerate,
+                                           double samplerate,
+                                           const int64_t* frames,
+                                           ptrdiff_t frames_stride,
+                                           size_t count,
+                                           int64_t* samples,
+                                           ptrdiff_t samples_stride,
+                                           size_t* first_error);
+
+    /** @brief Convert real-time in seconds to frame counts, as Timecode(framerate, Seconds). */
+    tcutils_status tcutils_seconds_to_tc_n(tcutils_framerate framerate,
+                                           tcutils_rounding rounding,
+                                           const double* seconds,
+                                           ptrdiff_t seconds_stride,
+                                           size_t count,
+                                           int64_t* frames,
+                                           ptrdiff_t frames_stride,
+                                           size_t* first_error);
+
+    /** @brief Convert frame counts to real-time in seconds, as Timecode::ToSeconds. */
+    tcutils_status tcutils_tc_to_seconds_n(tcutils_framerate framerate,
+                                           const int64_t* frames,
+                                           ptrdiff_t frames_stride,
+                                           size_t count,
+                                           double* seconds,
+                                           ptrdiff_t seconds_stride,
+                                           size_t* first_error);
+
+    /** @brief Convert DAMF-time in seconds to frame counts, as Timecode(framerate, DAMFSeconds). */
+    tcutils_status tcutils_damf_to_tc_n(tcutils_framerate framerate,
+                                        tcutils_rounding rounding,
+                                        const double* damf_seconds,
+                                        ptrdiff_t damf_seconds_stride,
+                                        size_t count,
+                                        int64_t* frames,
+                                        ptrdiff_t frames_stride,
+                                        size_t* first_error);
+
+    /** @brief Convert frame counts to DAMF-time in seconds, as Timecode::ToDAMFSeconds. */
+    tcutils_status tcutils_tc_to_damf_n(tcutils_framerate framerate,
+                                        const int64_t* frames,
+                                        ptrdiff_t frames_stride,
+                                        size_t count,
+                                        double* damf_seconds,
+                                        ptrdiff_t damf_seconds_stride,
+                                        size_t* first_error);
+
+    /** @brief Convert sample positions to DAMF-time in seconds, as Convert::ToDAMFSeconds. */
+    tcutils_status tcutils_samples_to_damf_n(tcutils_framerate framerate,
+                                             double samplerate,
+                                             const int64_t* samples,
+                                             ptrdiff_t samples_stride,
+                                             size_t count,
+                                             double* damf_seconds,
+                                             ptrdiff_t damf_seconds_stride,
+                                             size_t* first_error);
+
+    /** @brief Convert DAMF-time in seconds to sample positions, as Convert::ToSamples. */
+    tcutils_status tcutils_damf_to_samples_n(tcutils_framerate framerate,
+                                             double samplerate,
+                                             const double* damf_seconds,
+                                             ptrdiff_t damf_seconds_stride,
+                                             size_t count,
+                                             int64_t* samples,
+                                             ptrdiff_t samples_stride,
+                                             size_t* first_error);
+
+    /** @brief Find the frame boundaries of sample positions, as FrameBoundary. */
+    tcutils_status tcutils_frame_boundary_n(tcutils_framerate framerate,
+                                            double samplerate,
+                                            tcutils_boundary boundary,
+                                            const int64_t* samples,
+                                            ptrdiff_t samples_stride,
+                                            size_t count,
+                                            int64_t* boundaries,
+                                            ptrdiff_t boundaries_stride,
+                                            size_t* first_error);
+
+    /**
+     * @brief Convert sample positions to frame counts and subframes, as TimecodeSubframes, with
+     * subframe numerators out of subframes_denominator (at least 2).
+     */
+    tcutils_status tcutils_samples_to_subframes_n(tcutils_framerate framerate,
+                                                  double samplerate,
+                                                  int32_t subframes_denominator,
+                                                  const int64_t* samples,
+                                                  ptrdiff_t samples_stride,
+                                                  size_t count,
+                                                  int64_t* frames,
+                                                  ptrdiff_t frames_stride,
+                                                  int32_t* subframes,
+                                                  ptrdiff_t subframes_stride,
+                                                  size_t* first_error);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
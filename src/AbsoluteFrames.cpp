@@ -0,0 +1,192 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <tcutils/AbsoluteFrames.h>
+
+#include "RationalHelpers.h"
+
+using namespace Dolby::TcUtils;
+
+namespace
+{
+    Framerate RequireDefined(Framerate framerate)
+    {
+        if (!framerate.IsDefined())
+        {
+            throw AbsoluteFrames::UndefinedFramerate();
+        }
+        return framerate;
+    }
+
+    // Frame boundaries in samples are frame * a / b rounded to nearest, with a / b the number of
+    // samples per frame.
+    struct SamplesPerFrame
+    {
+        int64_t a;
+        int64_t b;
+
+        SamplesPerFrame(Framerate framerate, Samplerate samplerate)
+        {
+            int64_t numerator;
+            int64_t denominator;
+            samplerateRational(samplerate, numerator, denominator);
+            a = numerator * rateDenominator(framerate);
+            b = denominator * rateNumerator(framerate);
+        }
+
+        int64_t ToSamples(int64_t frames) const
+        {
+            return mulDivRound(frames, a, b);
+        }
+
+        int64_t ToFrames(int64_t samples, RoundingMode roundingMode) const
+        {
+            const int64_t frames = frameForSample(samples, a, b);
+            if (roundingMode == RoundingMode::TRUNCATE)
+            {
+                return frames;
+            }
+            const int64_t samplesFloor   = ToSamples(frames);
+            const int64_t samplesCeiling = ToSamples(frames + 1);
+            return (samples - samplesFloor < samplesCeiling - samples) ? frames : frames + 1;
+        }
+    };
+}
+
+AbsoluteFrames::AbsoluteFrames(Framerate framerate, int64_t frames)
+: mFramerate(RequireDefined(framerate))
+, mValue(frames)
+{
+}
+
+AbsoluteFrames::AbsoluteFrames(Framerate framerate,
+                               Samples samples,
+                               Samplerate samplerate,
+                               RoundingMode roundingMode)
+: AbsoluteFrames(framerate,
+                 SamplesPerFrame(RequireDefined(framerate), samplerate)
+                     .ToFrames(samples.GetValue(), roundingMode))
+{
+}
+
+AbsoluteFrames::AbsoluteFrames(const Timecode& timecode, int64_t day)
+: mFramerate(RequireDefined(timecode.GetFramerate()))
+, mValue(0)
+{
+    if (!timecode.IsSet())
+    {
+        throw Timecode::ValueOutOfRange();
+    }
+    mValue = day * FramesPerDay(mFramerate) + timecode.ToFrames().GetValue();
+}
+
+int64_t AbsoluteFrames::FramesPerDay(Framerate framerate)
+{
+    RequireDefined(framerate);
+    // drop-frame timecode skips 2 frames per minute, except for every tenth minute
+    const int64_t dropFrames = framerate.IsDrop() ? 2 * (24 * 60 - 24 * 6) : 0;
+    return int64_t(24 * 3600) * framerate.GetFrameCount() - dropFrames;
+}
+
+int64_t AbsoluteFrames::GetDay() const
+{
+    return floorDiv(mValue, FramesPerDay(mFramerate));
+}
+
+int64_t AbsoluteFrames::GetFrameOfDay() const
+{
+    return floorMod(mValue, FramesPerDay(mFramerate));
+}
+
+Timecode AbsoluteFrames::ToTimecode() const
+{
+    return Timecode(mFramerate, Frames(static_cast<int32_t>(GetFrameOfDay())));
+}
+
+Samples AbsoluteFrames::ToSamples(Samplerate samplerate) const
+{
+    return Samples(SamplesPerFrame(mFramerate, samplerate).ToSamples(mValue));
+}
+
+int64_t AbsoluteFrames::FromTicks(Framerate framerate,
+                                  int64_t ticks,
+                                  int64_t rate,
+                                  RoundingMode roundingMode)
+{
+    RequireDefined(framerate);
+    return roundingMode == RoundingMode::TRUNCATE
+               ? frameForTime(ticks, 1, rate, framerate)
+               : nearestFrameForTime(ticks, 1, rate, framerate);
+}
+
+int64_t AbsoluteFrames::ToTickCount(int64_t rate) const
+{
+    return firstTickForFrame(mValue, 1, rate, mFramerate);
+}
+
+int64_t AbsoluteFrames::operator-(const AbsoluteFrames& other) const
+{
+    RequireMatchingFramerate(other);
+
+    return mValue - other.mValue;
+}
+
+bool AbsoluteFrames::operator<(const AbsoluteFrames& other) const
+{
+    RequireMatchingFramerate(other);
+
+    return mValue < other.mValue;
+}
+
+bool AbsoluteFrames::operator>(const AbsoluteFrames& other) const
+{
+    RequireMatchingFramerate(other);
+
+    return mValue > other.mValue;
+}
+
+bool AbsoluteFrames::operator<=(const AbsoluteFrames& other) const
+{
+    RequireMatchingFramerate(other);
+
+    return mValue <= other.mValue;
+}
+
+bool AbsoluteFrames::operator>=(const AbsoluteFrames& other) const
+{
+    RequireMatchingFramerate(other);
+
+    return mValue >= other.mValue;
+}
+
+void AbsoluteFrames::RequireMatchingFramerate(const AbsoluteFrames& other) const
+{
+    if (mFramerate == other.mFramerate)
+        return;
+
+    throw std::logic_error("Operation requires positions with matching framerates");
+}
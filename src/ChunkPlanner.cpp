@@ -0,0 +1,107 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <tcutils/AbsoluteFrames.h>
+#include <tcutils/ChunkPlanner.h>
+
+#include "RationalHelpers.h"
+#include "TimecodeHelpers.h"
+
+using namespace Dolby::TcUtils;
+
+ChunkPlanner::ChunkPlanner(const Timecode& start, Samplerate samplerate, Samples length)
+: mStart(start)
+, mLength(length.GetValue())
+{
+    if (!start.IsSet() || !(samplerate.GetValue() > 0.0) || mLength < 0)
+    {
+        throw InvalidParameter();
+    }
+    int64_t numerator;
+    int64_t denominator;
+    samplerateRational(samplerate, numerator, denominator);
+    const Framerate framerate = start.GetFramerate();
+    mA                        = numerator * rateDenominator(framerate);
+    mB                        = denominator * rateNumerator(framerate);
+    mStartFrame               = start.ToFrames().GetValue();
+    mOrigin                   = mulDivRound(mStartFrame, mA, mB);
+    // the frames that start before the end of the program
+    mFrameCount =
+        mLength == 0 ? 0 : frameForSample(mLength - 1 + mOrigin, mA, mB) - mStartFrame + 1;
+}
+
+int64_t ChunkPlanner::FrameStart(int64_t frame) const
+{
+    return frame >= mFrameCount ? mLength : mulDivRound(mStartFrame + frame, mA, mB) - mOrigin;
+}
+
+Timecode ChunkPlanner::TimecodeOf(int64_t frame) const
+{
+    return timecodeOfFrames(mStart.GetFramerate(), mStartFrame + frame, mStart.GetWrapMode());
+}
+
+std::vector<ChunkPlanner::Chunk> ChunkPlanner::PlanCount(size_t count, Frames handles) const
+{
+    if (count == 0 || handles.GetValue() < 0)
+    {
+        throw InvalidParameter();
+    }
+    const auto chunks = static_cast<int64_t>(std::min(static_cast<uint64_t>(count),
+                                                      static_cast<uint64_t>(mFrameCount)));
+    std::vector<Chunk> plan;
+    plan.reserve(static_cast<size_t>(chunks));
+    for (int64_t i = 0; i < chunks; i++)
+    {
+        // chunk i has frames [i * F / n, (i + 1) * F / n), so the chunks differ by at most a frame
+        const int64_t first = mulDivFloor(i, mFrameCount, chunks);
+        const int64_t last  = mulDivFloor(i + 1, mFrameCount, chunks);
+        Chunk chunk{Samples(FrameStart(first)),
+                    Samples(FrameStart(last)),
+                    Samples(FrameStart(std::max(first - handles.GetValue(), int64_t(0)))),
+                    Samples(FrameStart(last + handles.GetValue())),
+                    TimecodeOf(first)};
+        plan.push_back(chunk);
+    }
+    return plan;
+}
+
+std::vector<ChunkPlanner::Chunk> ChunkPlanner::PlanDuration(const TimecodeDuration& duration,
+                                                            Frames handles) const
+{
+    if (duration.GetFramerate() != mStart.GetFramerate())
+    {
+        throw std::logic_error("Operation requires matching framerates");
+    }
+    if (duration.GetValue() <= 0)
+    {
+        throw InvalidParameter();
+    }
+    // the fewest chunks, and at least one to validate the handles
+    const int64_t count = (mFrameCount + duration.GetValue() - 1) / duration.GetValue();
+    return PlanCount(static_cast<size_t>(std::max(count, int64_t(1))), handles);
+}
@@ -26,6 +26,7 @@
 // WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "DropFrameHelpers.h"
+#include "RationalHelpers.h"
 #include <cmath>
 #include <tcutils/Convert.h>
 
@@ -73,3 +74,27 @@ DAMFSeconds Convert::ToDAMFSeconds(Framerate framerate, Samples samples, Sampler
     const double tr = std::round(t);
     return DAMFSeconds((std::abs(t - tr) < hs) ? tr : t);
 }
+
+int64_t Convert::TicksToSamples(int64_t ticks,
+                                int64_t numerator,
+                                int64_t denominator,
+                                Samplerate samplerate)
+{
+    int64_t samplerateNumerator;
+    int64_t samplerateDenominator;
+    samplerateRational(samplerate, samplerateNumerator, samplerateDenominator);
+    return mulDivRound(
+        ticks, numerator * samplerateNumerator, denominator * samplerateDenominator);
+}
+
+int64_t Convert::SamplesToTicks(int64_t samples,
+                                int64_t numerator,
+                                int64_t denominator,
+                                Samplerate samplerate)
+{
+    int64_t samplerateNumerator;
+    int64_t samplerateDenominator;
+    samplerateRational(samplerate, samplerateNumerator, samplerateDenominator);
+    return mulDivRound(
+        samples, denominator * samplerateDenominator, numerator * samplerateNumerator);
+}
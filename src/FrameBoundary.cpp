@@ -27,6 +27,8 @@
 
 #include <tcutils/FrameBoundary.h>
 
+#include "RationalHelpers.h"
+
 using namespace Dolby::TcUtils;
 
 Samples FrameBoundary::Floor(Framerate framerate, Samples samples, Samplerate samplerate)
@@ -91,3 +93,23 @@ bool FrameBoundary::IsOnBoundary(Framerate framerate, Samples samples, Samplerat
 {
     return samples.GetValue() == Floor(framerate, samples, samplerate).GetValue();
 }
+
+int64_t FrameBoundary::Calculate(Mode mode,
+                                 Framerate framerate,
+                                 int64_t ticks,
+                                 int64_t numerator,
+                                 int64_t denominator)
+{
+    const int64_t frames     = frameForTime(ticks, numerator, denominator, framerate);
+    const int64_t ticksFloor = firstTickForFrame(frames, numerator, denominator, framerate);
+    if (ticks == ticksFloor || mode == Mode::FLOOR)
+    {
+        return ticksFloor;
+    }
+    const int64_t ticksCeiling = firstTickForFrame(frames + 1, numerator, denominator, framerate);
+    if (mode == Mode::CEILING)
+    {
+        return ticksCeiling;
+    }
+    return ticks - ticksFloor < ticksCeiling - ticks ? ticksFloor : ticksCeiling;
+}
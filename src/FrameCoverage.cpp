@@ -0,0 +1,524 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <stdexcept>
+#include <tcutils/FrameCoverage.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define DOLBY_TCUTILS_COVERAGE_SSE2 1
+#endif
+
+using namespace Dolby::TcUtils;
+
+namespace
+{
+    const int chunkBits          = 16;
+    const int64_t framesPerChunk = int64_t(1) << chunkBits;
+    const size_t wordsPerChunk   = framesPerChunk / 64;
+    const uint64_t allFrames     = ~uint64_t(0);
+
+    int CountTrailingZeros(uint64_t word)
+    {
+#if defined(__GNUC__)
+        return __builtin_ctzll(word);
+#else
+        int count = 0;
+        while ((word & 1) == 0)
+        {
+            word >>= 1;
+            count++;
+        }
+        return count;
+#endif
+    }
+
+    int64_t PopCount(uint64_t word)
+    {
+#if defined(__GNUC__)
+        return __builtin_popcountll(word);
+#else
+        int64_t count = 0;
+        for (; word != 0; word &= word - 1)
+        {
+            count++;
+        }
+        return count;
+#endif
+    }
+
+    // Word-wise set operations on the bitmaps of two chunks: a = a op b
+    enum class Operation
+    {
+        OR,
+        AND,
+        AND_NOT
+    };
+
+    void Apply(Operation operation, uint64_t* a, const uint64_t* b)
+    {
+#ifdef DOLBY_TCUTILS_COVERAGE_SSE2
+        for (size_t i = 0; i < wordsPerChunk; i += 2)
+        {
+            const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+            const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+            const __m128i r = operation == Operation::OR    ? _mm_or_si128(x, y)
+                              : operation == Operation::AND ? _mm_and_si128(x, y)
+                                                            : _mm_andnot_si128(y, x);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(a + i), r);
+        }
+#else
+        for (size_t i = 0; i < wordsPerChunk; i++)
+        {
+            a[i] = operation == Operation::OR    ? a[i] | b[i]
+                   : operation == Operation::AND ? a[i] & b[i]
+                                                 : a[i] & ~b[i];
+        }
+#endif
+    }
+
+    int64_t CountFrames(const std::vector<uint64_t>& words)
+    {
+        int64_t count = 0;
+        for (uint64_t word : words)
+        {
+            count += PopCount(word);
+        }
+        return count;
+    }
+
+    // Collects the runs of present frames, clipped to [begin, end)
+    struct RunCollector
+    {
+        int64_t begin;
+        int64_t end;
+        std::vector<std::pair<int64_t, int64_t>> runs;
+
+        bool operator()(int64_t in, int64_t out)
+        {
+            if (in >= end)
+            {
+                return false;
+            }
+            in  = std::max(in, begin);
+            out = std::min(out, end);
+            if (in < out)
+            {
+                runs.emplace_back(in, out);
+            }
+            return true;
+        }
+    };
+
+    Timecode ToTimecode(Framerate framerate, int64_t frames)
+    {
+        return Timecode(framerate, Frames(static_cast<int32_t>(frames)), WrapMode::CONTINUE);
+    }
+}
+
+FrameCoverage::FrameCoverage(Framerate framerate)
+: mFramerate(framerate)
+{
+}
+
+int64_t FrameCoverage::ToKey(const Timecode& timecode) const
+{
+    if (timecode.GetFramerate() != mFramerate)
+    {
+        throw std::logic_error("Operation requires timecodes with matching framerates");
+    }
+    if (!timecode.IsSet())
+    {
+        throw Timecode::ValueOutOfRange();
+    }
+    return timecode.ToFrames().GetValue();
+}
+
+void FrameCoverage::RequireMatchingFramerate(const FrameCoverage& other) const
+{
+    if (mFramerate == other.mFramerate)
+        return;
+
+    throw std::logic_error("Operation requires coverages with matching framerates");
+}
+
+bool FrameCoverage::KeyLess(const Chunk& chunk, uint32_t key)
+{
+    return chunk.key < key;
+}
+
+void FrameCoverage::SetRange(int64_t begin, int64_t end, bool present)
+{
+    if (end <= begin)
+    {
+        return;
+    }
+    for (int64_t base = begin >> chunkBits << chunkBits; base < end; base += framesPerChunk)
+    {
+        const auto key      = static_cast<uint32_t>(base >> chunkBits);
+        auto chunk          = std::lower_bound(mChunks.begin(), mChunks.end(), key, KeyLess);
+        const bool exists   = chunk != mChunks.end() && chunk->key == key;
+        const int64_t first = std::max(begin, base) - base;
+        const int64_t limit = std::min(end, base + framesPerChunk) - base;
+
+        if (first == 0 && limit == framesPerChunk)
+        {
+            // the whole chunk
+            if (present && !exists)
+            {
+                mChunks.insert(chunk, Chunk{key, framesPerChunk, {}});
+            }
+            else if (present)
+            {
+                chunk->count = framesPerChunk;
+                chunk->words.clear();
+            }
+            else if (exists)
+            {
+                mChunks.erase(chunk);
+            }
+            continue;
+        }
+        if (present ? (exists && chunk->words.empty()) : !exists)
+        {
+            continue;
+        }
+        if (!exists)
+        {
+            chunk = mChunks.insert(chunk, Chunk{key, 0, std::vector<uint64_t>(wordsPerChunk, 0)});
+        }
+        else if (chunk->words.empty())
+        {
+            chunk->words.assign(wordsPerChunk, allFrames);
+        }
+
+        uint64_t* words = chunk->words.data();
+        for (int64_t word = first / 64; word * 64 < limit; word++)
+        {
+            const int64_t low  = std::max(first - word * 64, int64_t(0));
+            const int64_t high = std::min(limit - word * 64, int64_t(64));
+            const uint64_t mask =
+                (high == 64 ? allFrames : ((uint64_t(1) << high) - 1)) & (allFrames << low);
+            const uint64_t changed = present ? mask & ~words[word] : mask & words[word];
+            chunk->count += present ? PopCount(changed) : -PopCount(changed);
+            words[word] ^= changed;
+        }
+        if (chunk->count == framesPerChunk)
+        {
+            chunk->words.clear();
+        }
+        else if (chunk->count == 0)
+        {
+            mChunks.erase(chunk);
+        }
+    }
+}
+
+void FrameCoverage::Add(const Timecode& timecode)
+{
+    const int64_t frame = ToKey(timecode);
+    SetRange(frame, frame + 1, true);
+}
+
+void FrameCoverage::Add(const Timecode& in, const Timecode& out)
+{
+    SetRange(ToKey(in), ToKey(out), true);
+}
+
+void FrameCoverage::Add(const Timecode* in, const Timecode* out, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        SetRange(ToKey(in[i]), ToKey(out[i]), true);
+    }
+}
+
+void FrameCoverage::Remove(const Timecode& in, const Timecode& out)
+{
+    SetRange(ToKey(in), ToKey(out), false);
+}
+
+bool FrameCoverage::Contains(const Timecode& timecode) const
+{
+    const int64_t frame = ToKey(timecode);
+    const auto key      = static_cast<uint32_t>(frame >> chunkBits);
+    const auto chunk    = std::lower_bound(mChunks.begin(), mChunks.end(), key, KeyLess);
+    if (chunk == mChunks.end() || chunk->key != key)
+    {
+        return false;
+    }
+    const int64_t bit = frame & (framesPerChunk - 1);
+    return chunk->words.empty() || (chunk->words[bit / 64] >> (bit % 64) & 1) != 0;
+}
+
+int64_t FrameCoverage::Count() const
+{
+    int64_t count = 0;
+    for (const Chunk& chunk : mChunks)
+    {
+        count += chunk.count;
+    }
+    return count;
+}
+
+template <class Visitor>
+void FrameCoverage::VisitRuns(int64_t from, Visitor& visitor) const
+{
+    const auto fromKey = static_cast<uint32_t>(std::max(from, int64_t(0)) >> chunkBits);
+    auto chunk = std::lower_bound(mChunks.begin(), mChunks.end(), fromKey, KeyLess);
+    bool inRun       = false;
+    int64_t runBegin = 0;
+    for (; chunk != mChunks.end(); ++chunk)
+    {
+        const int64_t base = int64_t(chunk->key) << chunkBits;
+        if (chunk->words.empty())
+        {
+            runBegin = inRun ? runBegin : base;
+            inRun    = true;
+        }
+        else
+        {
+            for (size_t i = 0; i < wordsPerChunk; i++)
+            {
+                const uint64_t word = chunk->words[i];
+                // find the transitions between present and missing frames in the word
+                int bit = 0;
+                while (bit < 64)
+                {
+                    const uint64_t rest = (inRun ? ~word : word) >> bit;
+                    if (rest == 0)
+                    {
+                        break;
+                    }
+                    bit += CountTrailingZeros(rest);
+                    const int64_t frame = base + static_cast<int64_t>(i) * 64 + bit;
+                    if (inRun && !visitor(runBegin, frame))
+                    {
+                        return;
+                    }
+                    runBegin = frame;
+                    inRun    = !inRun;
+                }
+            }
+        }
+        // a run ends at the end of the chunk when the next chunk doesn't follow directly
+        const auto next = chunk + 1;
+        if (inRun && (next == mChunks.end() || next->key != chunk->key + 1))
+        {
+            inRun = false;
+            if (!visitor(runBegin, base + framesPerChunk))
+            {
+                return;
+            }
+        }
+    }
+}
+
+std::vector<FrameCoverage::Run> FrameCoverage::GetRuns() const
+{
+    RunCollector collector{0, INT64_MAX, {}};
+    VisitRuns(0, collector);
+
+    std::vector<Run> runs;
+    runs.reserve(collector.runs.size());
+    for (const auto& run : collector.runs)
+    {
+        runs.push_back({ToTimecode(mFramerate, run.first), ToTimecode(mFramerate, run.second)});
+    }
+    return runs;
+}
+
+std::vector<FrameCoverage::Run> FrameCoverage::GetGaps(const Timecode& begin,
+                                                       const Timecode& end) const
+{
+    const int64_t first = ToKey(begin);
+    const int64_t limit = ToKey(end);
+    RunCollector collector{first, limit, {}};
+    VisitRuns(first, collector);
+
+    std::vector<Run> gaps;
+    int64_t gapBegin = first;
+    for (const auto& run : collector.runs)
+    {
+        if (gapBegin < run.first)
+        {
+            gaps.push_back({ToTimecode(mFramerate, gapBegin), ToTimecode(mFramerate, run.first)});
+        }
+        gapBegin = run.second;
+    }
+    if (gapBegin < limit)
+    {
+        gaps.push_back({ToTimecode(mFramerate, gapBegin), ToTimecode(mFramerate, limit)});
+    }
+    return gaps;
+}
+
+FrameCoverage& FrameCoverage::operator|=(const FrameCoverage& other)
+{
+    RequireMatchingFramerate(other);
+    if (&other == this)
+    {
+        return *this;
+    }
+
+    std::vector<Chunk> chunks;
+    chunks.reserve(mChunks.size() + other.mChunks.size());
+    auto a = mChunks.begin();
+    auto b = other.mChunks.begin();
+    while (a != mChunks.end() || b != other.mChunks.end())
+    {
+        if (b == other.mChunks.end() || (a != mChunks.end() && a->key < b->key))
+        {
+            chunks.push_back(std::move(*a++));
+        }
+        else if (a == mChunks.end() || b->key < a->key)
+        {
+            chunks.push_back(*b++);
+        }
+        else
+        {
+            Chunk chunk = std::move(*a++);
+            if (b->words.empty())
+            {
+                chunk.count = framesPerChunk;
+                chunk.words.clear();
+            }
+            else if (!chunk.words.empty())
+            {
+                Apply(Operation::OR, chunk.words.data(), b->words.data());
+                chunk.count = CountFrames(chunk.words);
+                if (chunk.count == framesPerChunk)
+                {
+                    chunk.words.clear();
+                }
+            }
+            ++b;
+            chunks.push_back(std::move(chunk));
+        }
+    }
+    mChunks.swap(chunks);
+    return *this;
+}
+
+FrameCoverage& FrameCoverage::operator&=(const FrameCoverage& other)
+{
+    RequireMatchingFramerate(other);
+    if (&other == this)
+    {
+        return *this;
+    }
+
+    std::vector<Chunk> chunks;
+    auto b = other.mChunks.begin();
+    for (Chunk& chunk : mChunks)
+    {
+        while (b != other.mChunks.end() && b->key < chunk.key)
+        {
+            ++b;
+        }
+        if (b == other.mChunks.end() || b->key != chunk.key)
+        {
+            continue;
+        }
+        if (chunk.words.empty())
+        {
+            chunk.count = b->count;
+            chunk.words = b->words;
+        }
+        else if (!b->words.empty())
+        {
+            Apply(Operation::AND, chunk.words.data(), b->words.data());
+            chunk.count = CountFrames(chunk.words);
+            if (chunk.count == 0)
+            {
+                continue;
+            }
+        }
+        chunks.push_back(std::move(chunk));
+    }
+    mChunks.swap(chunks);
+    return *this;
+}
+
+FrameCoverage& FrameCoverage::operator-=(const FrameCoverage& other)
+{
+    RequireMatchingFramerate(other);
+    if (&other == this)
+    {
+        mChunks.clear();
+        return *this;
+    }
+
+    std::vector<Chunk> chunks;
+    auto b = other.mChunks.begin();
+    for (Chunk& chunk : mChunks)
+    {
+        while (b != other.mChunks.end() && b->key < chunk.key)
+        {
+            ++b;
+        }
+        if (b != other.mChunks.end() && b->key == chunk.key)
+        {
+            if (b->words.empty())
+            {
+                continue;
+            }
+            if (chunk.words.empty())
+            {
+                chunk.words.assign(wordsPerChunk, allFrames);
+            }
+            Apply(Operation::AND_NOT, chunk.words.data(), b->words.data());
+            chunk.count = CountFrames(chunk.words);
+            if (chunk.count == 0)
+            {
+                continue;
+            }
+        }
+        chunks.push_back(std::move(chunk));
+    }
+    mChunks.swap(chunks);
+    return *this;
+}
+
+bool FrameCoverage::operator==(const FrameCoverage& other) const
+{
+    if (mFramerate != other.mFramerate || mChunks.size() != other.mChunks.size())
+    {
+        return false;
+    }
+    // chunks are normalized: bitmaps are never full or empty
+    for (size_t i = 0; i < mChunks.size(); i++)
+    {
+        if (mChunks[i].key != other.mChunks[i].key || mChunks[i].count != other.mChunks[i].count ||
+            mChunks[i].words != other.mChunks[i].words)
+        {
+            return false;
+        }
+    }
+    return true;
+}
@@ -27,6 +27,8 @@
 
 #include <cassert>
 #include <cmath>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <stdexcept>
@@ -79,7 +81,7 @@ namespace
         if (std::strcmp("120", str) == 0)
             return Framerate::FPS_120;
 
-        throw Framerate::StringParseError();
+        return Framerate::UNDEFINED;
     }
 
     bool isNear(double value, double ref)
@@ -88,6 +90,13 @@ namespace
         return std::abs(value - ref) < e;
     }
 
+    // relative tolerance, as custom framerate names like 119.88 are rounded to a few decimals
+    bool isNearRelative(double value, double ref)
+    {
+        const double e = 0.00001;
+        return std::abs(value - ref) < ref * e;
+    }
+
     Framerate::Enum ToEnum(double value, bool isDrop)
     {
         if (isDrop)
@@ -120,13 +129,107 @@ namespace
             return Framerate::FPS_100;
         if (isNear(value, 120))
             return Framerate::FPS_120;
-        throw std::runtime_error("unsupported framerate");
+        return Framerate::UNDEFINED;
+    }
+
+    // Framerate for an FPS value not in the enum: an integer or a 1000/1001 ratio of one
+    bool ToCustom(double value, Framerate& framerate)
+    {
+        if (!(value > 0.0 && value < Framerate::MAX_FRAME_COUNT + 0.5))
+        {
+            return false;
+        }
+        const double count      = std::round(value);
+        const double countRatio = std::round(value * 1001.0 / 1000.0);
+        const double ratio      = countRatio * 1000.0 / 1001.0;
+        // take the nearer of the two, as towards 1000 FPS the tolerance is wider than the distance
+        // between a count and its 1000/1001 ratio (e.g. 997.003 and 997)
+        if (std::abs(value - ratio) < std::abs(value - count))
+        {
+            if (countRatio < 1.0 || countRatio > Framerate::MAX_FRAME_COUNT ||
+                !isNearRelative(value, ratio))
+            {
+                return false;
+            }
+            framerate = Framerate(Rational(static_cast<int64_t>(countRatio) * 1000, 1001));
+            return true;
+        }
+        if (count < 1.0 || !isNearRelative(value, count))
+        {
+            return false;
+        }
+        framerate = Framerate(Rational(static_cast<int64_t>(count)));
+        return true;
+    }
+
+    Framerate FromString(const char* str)
+    {
+        const Framerate::Enum value = ToEnum(str);
+        if (value != Framerate::UNDEFINED)
+        {
+            return value;
+        }
+        // a number, e.g. "59.94" or "72"
+        char* end            = nullptr;
+        const double numeric = std::strtod(str, &end);
+        Framerate framerate;
+        if (end == str || *end != '\0' || !(str[0] >= '0' && str[0] <= '9') ||
+            !ToCustom(numeric, framerate))
+        {
+            throw Framerate::StringParseError();
+        }
+        return framerate;
     }
 
+    Framerate FromDouble(double fps, bool isDrop)
+    {
+        const Framerate::Enum value = ToEnum(fps, isDrop);
+        if (value != Framerate::UNDEFINED)
+        {
+            return value;
+        }
+        Framerate framerate;
+        if (!ToCustom(fps, framerate))
+        {
+            throw std::runtime_error("unsupported framerate");
+        }
+        return framerate;
+    }
+
+    // Names of custom framerates, e.g. "59.94" or "72", indexed by ratio and frame count
+    const char* CustomName(int frameCount, bool ratio1001)
+    {
+        struct Names
+        {
+            char names[2][Framerate::MAX_FRAME_COUNT + 1][8];
+
+            Names()
+            {
+                for (int count = 0; count <= Framerate::MAX_FRAME_COUNT; count++)
+                {
+                    std::snprintf(names[0][count], sizeof(names[0][count]), "%d", count);
+                    char* name = names[1][count];
+                    std::snprintf(name, sizeof(names[1][count]), "%.3f", count * 1000.0 / 1001.0);
+                    // remove trailing zeros, e.g. 59.940 becomes 59.94
+                    size_t length = std::strlen(name);
+                    while (name[length - 1] == '0')
+                    {
+                        name[--length] = '\0';
+                    }
+                    if (name[length - 1] == '.')
+                    {
+                        name[length - 1] = '\0';
+                    }
+                }
+            }
+        };
+        static const Names table;
+        return table.names[ratio1001 ? 1 : 0][frameCount];
+    }
 }
 
 Framerate::Framerate(const char* str)
-: mValue(ToEnum(str))
+: Framerate(FromString(str))
 {
 }
 
@@ -136,51 +239,70 @@ Framerate::Framerate(const std::string& str)
 }
 
 Framerate::Framerate(double value)
-: mValue(ToEnum(value, false))
+: Framerate(FromDouble(value, false))
 {
 }
 
 Framerate::Framerate(double value, bool isDrop)
-: mValue(ToEnum(value, isDrop))
+: Framerate(FromDouble(value, isDrop))
 {
 }
 
-int Framerate::GetFrameCount() const
+Framerate::Framerate(Rational fps, bool drop)
 {
-    switch (mValue)
+    int64_t numerator   = fps.GetNumerator();
+    int64_t denominator = fps.GetDenominator();
+    if (numerator <= 0 || denominator <= 0)
     {
-        case UNDEFINED:
-            return 0;
-        case FPS_23976:
-            return 24;
-        case FPS_24:
-            return 24;
-        case FPS_25:
-            return 25;
-        case FPS_2997:
-            return 30;
-        case FPS_2997DF:
-            return 30;
-        case FPS_30:
-            return 30;
-        case FPS_30DF:
-            return 30;
-        case FPS_48:
-            return 48;
-        case FPS_50:
-            return 50;
-        case FPS_60:
-            return 60;
-        case FPS_96:
-            return 96;
-        case FPS_100:
-            return 100;
-        case FPS_120:
-            return 120;
-        case COUNT:
-            return 0;
+        throw UnsupportedFramerate();
+    }
+    int64_t a = numerator;
+    int64_t b = denominator;
+    while (b != 0)
+    {
+        const int64_t r = a % b;
+        a               = b;
+        b               = r;
+    }
+    numerator /= a;
+    denominator /= a;
+
+    bool ratio1001;
+    int64_t frameCount;
+    if (denominator == 1)
+    {
+        ratio1001  = false;
+        frameCount = numerator;
+    }
+    else if (1001 % denominator == 0 && numerator <= MAX_FRAME_COUNT * 1000 &&
+             numerator * 1001 % (denominator * 1000) == 0)
+    {
+        // count * 1000 / 1001, which reduces further when count shares a factor 7, 11 or 13
+        // with 1001 (e.g. 28000/1001 is 4000/143)
+        ratio1001  = true;
+        frameCount = numerator * 1001 / (denominator * 1000);
+    }
+    else
+    {
+        throw UnsupportedFramerate();
+    }
+    if (frameCount > MAX_FRAME_COUNT || (drop && frameCount != 30))
+    {
+        throw UnsupportedFramerate();
+    }
+
+    mValue      = CUSTOM;
+    mFrameCount = static_cast<int>(frameCount);
+    mRatio1001  = ratio1001;
+    mDrop       = drop;
+    for (const Framerate framerate : values())
+    {
+        if (framerate.mFrameCount == mFrameCount && framerate.mRatio1001 == mRatio1001 &&
+            framerate.mDrop == mDrop)
+        {
+            mValue = framerate.mValue;
+        }
     }
-    return 0;
 }
 
 const char* Framerate::ToString() const
@@ -217,64 +339,12 @@ const char* Framerate::ToString() const
             return "120";
         case COUNT:
             return "";
+        case CUSTOM:
+            return CustomName(mFrameCount, mRatio1001);
     }
     return "";
 }
 
-bool Framerate::IsDefined() const
-{
-    return mValue != UNDEFINED;
-}
-
-bool Framerate::IsDrop() const
-{
-    return mValue == FPS_2997DF || mValue == FPS_30DF;
-}
-
-bool Framerate::IsHighFramerate() const
-{
-    return mValue == FPS_48 || mValue == FPS_50 || mValue == FPS_60 || mValue == FPS_96 ||
-           mValue == FPS_100 || mValue == FPS_120;
-}
-
-bool Framerate::IsRatio1001() const
-{
-    switch (mValue)
-    {
-        case UNDEFINED:
-            return false;
-        case FPS_23976:
-            return true;
-        case FPS_24:
-            return false;
-        case FPS_25:
-            return false;
-        case FPS_2997:
-            return true;
-        case FPS_2997DF:
-            return true;
-        case FPS_30:
-            return false;
-        case FPS_30DF:
-            return false;
-        case FPS_48:
-            return false;
-        case FPS_50:
-            return false;
-        case FPS_60:
-            return false;
-        case FPS_96:
-            return false;
-        case FPS_100:
-            return false;
-        case FPS_120:
-            return false;
-        case COUNT:
-            return false;
-    }
-    return false;
-}
-
 double Framerate::ApplyRatio(double value) const
 {
     return IsRatio1001() ? value * 1000.0 / 1001.0 : value;
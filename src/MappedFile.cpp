@@ -0,0 +1,154 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace Dolby::TcUtils;
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+#ifdef _WIN32
+
+bool MappedFile::Open(const std::string& path)
+{
+    Close();
+    HANDLE file = CreateFileA(path.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size))
+    {
+        CloseHandle(file);
+        return false;
+    }
+    mFile = file;
+    mSize = static_cast<size_t>(size.QuadPart);
+    if (mSize == 0)
+    {
+        return true;
+    }
+    mMapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mMapping == nullptr)
+    {
+        Close();
+        return false;
+    }
+    mData = static_cast<const char*>(MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0));
+    if (mData == nullptr)
+    {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (mData != nullptr)
+    {
+        UnmapViewOfFile(mData);
+    }
+    if (mMapping != nullptr)
+    {
+        CloseHandle(mMapping);
+    }
+    if (mFile != nullptr)
+    {
+        CloseHandle(mFile);
+    }
+    mData    = nullptr;
+    mSize    = 0;
+    mMapping = nullptr;
+    mFile    = nullptr;
+}
+
+#else
+
+bool MappedFile::Open(const std::string& path)
+{
+    Close();
+    const int file = open(path.c_str(), O_RDONLY);
+    if (file < 0)
+    {
+        return false;
+    }
+    struct stat status;
+    if (fstat(file, &status) != 0)
+    {
+        close(file);
+        return false;
+    }
+    const auto size = static_cast<size_t>(status.st_size);
+    if (size > 0)
+    {
+        void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+        if (data == MAP_FAILED)
+        {
+            close(file);
+            return false;
+        }
+        // the files are read front to back
+        madvise(data, size, MADV_SEQUENTIAL);
+        mData = static_cast<const char*>(data);
+    }
+    // the mapping stays valid after closing the file
+    close(file);
+    mSize = size;
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (mData != nullptr)
+    {
+        munmap(const_cast<char*>(mData), mSize);
+    }
+    mData = nullptr;
+    mSize = 0;
+}
+
+#endif
@@ -0,0 +1,81 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef DOLBY_TCUTILS_MAPPEDFILE_H
+#define DOLBY_TCUTILS_MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+namespace Dolby
+{
+    namespace TcUtils
+    {
+        class MappedFile;
+    }
+}
+
+/**
+ * @brief Read-only memory map of a whole file (mmap, or a file mapping on Windows).
+ */
+class Dolby::TcUtils::MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /** @brief Map the file, unmapping the current one first; returns false on failure. */
+    bool Open(const std::string& path);
+
+    /** @brief Unmap the file. */
+    void Close();
+
+    /** @brief Get the contents of the file, nullptr for empty files. */
+    const char* data() const
+    {
+        return mData;
+    }
+
+    /** @brief Get the size of the file. */
+    size_t size() const
+    {
+        return mSize;
+    }
+
+private:
+    const char* mData{nullptr};
+    size_t mSize{0};
+#ifdef _WIN32
+    void* mFile{nullptr};
+    void* mMapping{nullptr};
+#endif
+};
+
+#endif
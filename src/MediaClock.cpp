@@ -0,0 +1,167 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <tcutils/MediaClock.h>
+
+#include "RationalHelpers.h"
+
+using namespace Dolby::TcUtils;
+
+namespace
+{
+    const int64_t nanosecondsPerDay = 86400 * nanosecondsPerSecond;
+
+    int64_t ToTickRate(uint32_t clockRate)
+    {
+        if (clockRate == 0)
+        {
+            throw MediaClock::InvalidParameter();
+        }
+        return static_cast<int64_t>(clockRate);
+    }
+
+    int64_t Unwrap(uint32_t rtpTimestamp, int64_t referenceTicks)
+    {
+        // the signed 32-bit difference selects the nearest candidate
+        const uint32_t difference = rtpTimestamp - static_cast<uint32_t>(referenceTicks);
+        return referenceTicks + static_cast<int32_t>(difference);
+    }
+}
+
+MediaClock::MediaClock(Framerate framerate, int32_t utcOffset, int32_t localOffset, int32_t jamTime)
+: mFramerate(framerate)
+, mJamOffset((static_cast<int64_t>(utcOffset) - localOffset + jamTime) * nanosecondsPerSecond)
+{
+    if (!framerate.IsDefined())
+    {
+        throw InvalidParameter();
+    }
+}
+
+int64_t MediaClock::ToFrameCount(int64_t taiNanoseconds) const
+{
+    return frameForTick(taiNanoseconds, nanosecondsPerSecond, mFramerate);
+}
+
+int64_t MediaClock::ToNanoseconds(int64_t frameCount) const
+{
+    return tickForFrame(frameCount, nanosecondsPerSecond, mFramerate);
+}
+
+int64_t MediaClock::JamFrameCountForDay(int64_t day) const
+{
+    // the first frame that starts at or after the jam time
+    const int64_t jam = day * nanosecondsPerDay + mJamOffset;
+    return frameForTick(jam - 1, nanosecondsPerSecond, mFramerate) + 1;
+}
+
+int64_t MediaClock::DayForFrame(int64_t frameCount) const
+{
+    // the day of the jam preceding the start of the frame, corrected for a frame that starts
+    // less than a nanosecond after the jam time
+    int64_t day = floorDiv(ToNanoseconds(frameCount) - mJamOffset, nanosecondsPerDay);
+    if (JamFrameCountForDay(day + 1) <= frameCount)
+    {
+        day++;
+    }
+    return day;
+}
+
+int64_t MediaClock::GetJamFrameCount(int64_t frameCount) const
+{
+    return JamFrameCountForDay(DayForFrame(frameCount));
+}
+
+Timecode MediaClock::ToTimecode(int64_t taiNanoseconds) const
+{
+    DayCache cache;
+    return ToTimecode(cache, ToFrameCount(taiNanoseconds));
+}
+
+Timecode MediaClock::ToTimecode(uint32_t rtpTimestamp,
+                                uint32_t clockRate,
+                                int64_t referenceNanoseconds) const
+{
+    const int64_t ticks = UnwrapRtpTimestamp(rtpTimestamp, clockRate, referenceNanoseconds);
+    DayCache cache;
+    return ToTimecode(cache, frameForTick(ticks, clockRate, mFramerate));
+}
+
+void MediaClock::ToTimecodes(const int64_t* taiNanoseconds, size_t count, Timecode* timecodes) const
+{
+    DayCache cache;
+    for (size_t i = 0; i < count; i++)
+    {
+        timecodes[i] = ToTimecode(cache, ToFrameCount(taiNanoseconds[i]));
+    }
+}
+
+void MediaClock::ToTimecodes(const uint32_t* rtpTimestamps,
+                             size_t count,
+                             uint32_t clockRate,
+                             int64_t referenceNanoseconds,
+                             Timecode* timecodes) const
+{
+    if (count == 0)
+    {
+        return;
+    }
+    DayCache cache;
+    int64_t ticks = UnwrapRtpTimestamp(rtpTimestamps[0], clockRate, referenceNanoseconds);
+    for (size_t i = 0; i < count; i++)
+    {
+        ticks        = Unwrap(rtpTimestamps[i], ticks);
+        timecodes[i] = ToTimecode(cache, frameForTick(ticks, clockRate, mFramerate));
+    }
+}
+
+Timecode MediaClock::ToTimecode(DayCache& cache, int64_t frameCount) const
+{
+    // the jam frame only changes once per day
+    if (frameCount < cache.start || frameCount >= cache.end)
+    {
+        const int64_t day = DayForFrame(frameCount);
+        cache.start       = JamFrameCountForDay(day);
+        cache.end         = JamFrameCountForDay(day + 1);
+    }
+    return Timecode(mFramerate, Frames(static_cast<int32_t>(frameCount - cache.start)));
+}
+
+uint32_t MediaClock::ToRtpTimestamp(int64_t taiNanoseconds, uint32_t clockRate)
+{
+    const int64_t ticks = mulDivFloor(taiNanoseconds, ToTickRate(clockRate), nanosecondsPerSecond);
+    return static_cast<uint32_t>(ticks);
+}
+
+int64_t MediaClock::UnwrapRtpTimestamp(uint32_t rtpTimestamp,
+                                       uint32_t clockRate,
+                                       int64_t referenceNanoseconds)
+{
+    const int64_t referenceTicks =
+        mulDivFloor(referenceNanoseconds, ToTickRate(clockRate), nanosecondsPerSecond);
+    return Unwrap(rtpTimestamp, referenceTicks);
+}
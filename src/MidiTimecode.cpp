@@ -0,0 +1,428 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <tcutils/MidiTimecode.h>
+
+using namespace Dolby::TcUtils;
+
+namespace
+{
+    const uint8_t quarterFrameStatus = 0xF1;
+    const uint8_t sysExStart         = 0xF0;
+    const uint8_t sysExEnd           = 0xF7;
+    const uint8_t realTimeFirst      = 0xF8;
+
+    // F0 7F <device> 01 01 hh mm ss ff F7, without the trailing F7
+    const size_t fullFrameLength = 9;
+
+    bool IsValid(Framerate framerate, int hours, int minutes, int seconds, int frames)
+    {
+        if (hours >= 24 || minutes >= 60 || seconds >= 60 || frames >= framerate.GetFrameCount())
+        {
+            return false;
+        }
+        // frames 0 and 1 are dropped at the start of each minute, except minutes 0, 10, 20, ...
+        return !framerate.IsDrop() || seconds != 0 || frames >= 2 || (minutes % 10) == 0;
+    }
+
+    uint8_t QuarterFrameData(const Timecode& timecode, int piece, MidiTimecode::RateCode rateCode)
+    {
+        int nibble = 0;
+        switch (piece)
+        {
+            case 0:
+                nibble = timecode.GetUnitFrames() & 0xF;
+                break;
+            case 1:
+                nibble = timecode.GetUnitFrames() >> 4;
+                break;
+            case 2:
+                nibble = timecode.GetUnitSeconds() & 0xF;
+                break;
+            case 3:
+                nibble = timecode.GetUnitSeconds() >> 4;
+                break;
+            case 4:
+                nibble = timecode.GetUnitMinutes() & 0xF;
+                break;
+            case 5:
+                nibble = timecode.GetUnitMinutes() >> 4;
+                break;
+            case 6:
+                nibble = timecode.GetUnitHours() & 0xF;
+                break;
+            case 7:
+                nibble = (rateCode << 1) | ((timecode.GetUnitHours() >> 4) & 1);
+                break;
+            default:
+                throw Timecode::ValueOutOfRange();
+        }
+        return static_cast<uint8_t>((piece << 4) | nibble);
+    }
+}
+
+MidiTimecode::RateCode MidiTimecode::ToRateCode(Framerate framerate)
+{
+    switch (framerate.GetEnum())
+    {
+        case Framerate::FPS_23976:
+        case Framerate::FPS_24:
+            return RATE_24;
+        case Framerate::FPS_25:
+            return RATE_25;
+        case Framerate::FPS_2997DF:
+            return RATE_2997DF;
+        case Framerate::FPS_2997:
+        case Framerate::FPS_30:
+            return RATE_30;
+        default:
+            throw UnsupportedFramerate();
+    }
+}
+
+size_t MidiTimecode::WriteQuarterFrame(const Timecode& timecode,
+                                       int piece,
+                                       uint8_t* buffer,
+                                       size_t size)
+{
+    const RateCode rateCode = ToRateCode(timecode.GetFramerate());
+    if (!timecode.IsSet())
+    {
+        throw Timecode::ValueOutOfRange();
+    }
+    if (size < QUARTER_FRAME_SIZE)
+    {
+        return 0;
+    }
+    buffer[0] = quarterFrameStatus;
+    buffer[1] = QuarterFrameData(timecode, piece, rateCode);
+    return QUARTER_FRAME_SIZE;
+}
+
+size_t MidiTimecode::WriteFullFrame(const Timecode& timecode,
+                                    uint8_t* buffer,
+                                    size_t size,
+                                    uint8_t deviceId)
+{
+    const RateCode rateCode = ToRateCode(timecode.GetFramerate());
+    if (!timecode.IsSet())
+    {
+        throw Timecode::ValueOutOfRange();
+    }
+    if (size < FULL_FRAME_SIZE)
+    {
+        return 0;
+    }
+    buffer[0] = sysExStart;
+    buffer[1] = 0x7F;
+    buffer[2] = deviceId & 0x7F;
+    buffer[3] = 0x01;
+    buffer[4] = 0x01;
+    buffer[5] = static_cast<uint8_t>((rateCode << 5) | timecode.GetUnitHours());
+    buffer[6] = static_cast<uint8_t>(timecode.GetUnitMinutes());
+    buffer[7] = static_cast<uint8_t>(timecode.GetUnitSeconds());
+    buffer[8] = static_cast<uint8_t>(timecode.GetUnitFrames());
+    buffer[9] = sysExEnd;
+    return FULL_FRAME_SIZE;
+}
+
+MidiTimecode::Parser::Parser(Framerate framerate24, Framerate framerate30)
+: mFramerate24(framerate24)
+, mFramerate30(framerate30)
+{
+    if (ToRateCode(framerate24) != RATE_24 || ToRateCode(framerate30) != RATE_30)
+    {
+        throw UnsupportedFramerate();
+    }
+}
+
+void MidiTimecode::Parser::Reset()
+{
+    mExpectQuarterFrame = false;
+    mLocked             = false;
+    mReceivedPieces     = 0;
+    mLastPiece          = -1;
+    mInSysEx            = false;
+    mSysExLength        = 0;
+}
+
+Framerate MidiTimecode::Parser::ToFramerate(int rateCode) const
+{
+    switch (rateCode)
+    {
+        case RATE_24:
+            return mFramerate24;
+        case RATE_25:
+            return Framerate::FPS_25;
+        case RATE_2997DF:
+            return Framerate::FPS_2997DF;
+        default:
+            return mFramerate30;
+    }
+}
+
+bool MidiTimecode::Parser::Parse(uint8_t byte)
+{
+    mUpdated = false;
+    if (byte >= realTimeFirst)
+    {
+        // system real-time messages may be interleaved with any other message
+        return false;
+    }
+
+    if (byte & 0x80)
+    {
+        // any other status byte ends the message in progress
+        const bool sysExComplete = mInSysEx && byte == sysExEnd;
+        mInSysEx                 = byte == sysExStart;
+        mExpectQuarterFrame      = byte == quarterFrameStatus;
+        if (sysExComplete)
+        {
+            mUpdated = ParseFullFrame();
+        }
+        mSysExLength = 0;
+        if (mInSysEx)
+        {
+            mSysEx[mSysExLength++] = byte;
+        }
+        return mUpdated;
+    }
+
+    if (mExpectQuarterFrame)
+    {
+        mExpectQuarterFrame = false;
+        mUpdated            = ParseQuarterFrame(byte);
+    }
+    else if (mInSysEx)
+    {
+        if (mSysExLength < fullFrameLength)
+        {
+            mSysEx[mSysExLength++] = byte;
+        }
+        else
+        {
+            // too long for a full-frame message, ignore the remainder
+            mInSysEx = false;
+        }
+    }
+    return mUpdated;
+}
+
+size_t MidiTimecode::Parser::Parse(const uint8_t* data, size_t size)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        if (Parse(data[i]))
+        {
+            return i + 1;
+        }
+    }
+    return size;
+}
+
+bool MidiTimecode::Parser::ParseQuarterFrame(uint8_t data)
+{
+    const int piece = data >> 4;
+    if (piece == 0)
+    {
+        mReceivedPieces = 1;
+    }
+    else if (piece == mLastPiece + 1 && mReceivedPieces == (1 << piece) - 1)
+    {
+        mReceivedPieces |= static_cast<uint8_t>(1 << piece);
+    }
+    else
+    {
+        // out of order or reverse direction: wait for the next piece 0
+        mReceivedPieces = 0;
+        mLocked         = false;
+    }
+    mLastPiece     = piece;
+    mPieces[piece] = data & 0xF;
+
+    if (mLocked && piece == 3 && mReceivedPieces == 0x0F)
+    {
+        // halfway through the sequence, the next frame starts
+        mFullFrame = false;
+        ++mTimecode;
+        return true;
+    }
+    if (piece != 7 || mReceivedPieces != 0xFF)
+    {
+        return false;
+    }
+
+    const Framerate framerate = ToFramerate((mPieces[7] >> 1) & 3);
+    const int frames          = mPieces[0] | ((mPieces[1] & 1) << 4);
+    const int seconds         = mPieces[2] | ((mPieces[3] & 3) << 4);
+    const int minutes         = mPieces[4] | ((mPieces[5] & 3) << 4);
+    const int hours           = mPieces[6] | ((mPieces[7] & 1) << 4);
+    if (!IsValid(framerate, hours, minutes, seconds, frames))
+    {
+        mLocked = false;
+        return false;
+    }
+
+    // the sequence started two frames ago
+    mTimecode = Timecode(framerate, hours, minutes, seconds, frames);
+    ++mTimecode;
+    ++mTimecode;
+    mFullFrame = false;
+    mLocked    = true;
+    return true;
+}
+
+bool MidiTimecode::Parser::ParseFullFrame()
+{
+    if (mSysExLength != fullFrameLength || mSysEx[1] != 0x7F || mSysEx[3] != 0x01 ||
+        mSysEx[4] != 0x01)
+    {
+        return false;
+    }
+
+    const Framerate framerate = ToFramerate((mSysEx[5] >> 5) & 3);
+    const int hours           = mSysEx[5] & 0x1F;
+    if (!IsValid(framerate, hours, mSysEx[6], mSysEx[7], mSysEx[8]))
+    {
+        return false;
+    }
+
+    mTimecode  = Timecode(framerate, hours, mSysEx[6], mSysEx[7], mSysEx[8]);
+    mFullFrame = true;
+    // a locate interrupts the quarter-frame stream
+    mReceivedPieces = 0;
+    mLastPiece      = -1;
+    mLocked         = false;
+    return true;
+}
+
+MidiTimecode::Generator::Generator(const Timecode& start, Samplerate samplerate)
+: mFramerate(start.GetFramerate())
+, mRateCode(ToRateCode(start.GetFramerate()))
+, mSamplerate(samplerate)
+, mStartFrames(0)
+, mStartSamples(0)
+, mSequenceTimecode(start)
+{
+    if (!start.IsSet())
+    {
+        throw Timecode::ValueOutOfRange();
+    }
+    mStartFrames  = start.ToFrames().GetValue();
+    mStartSamples = start.ToSamples(samplerate).GetValue();
+    Seek(0);
+}
+
+int64_t MidiTimecode::Generator::FrameBoundary(int64_t frame) const
+{
+    const Timecode timecode(
+        mFramerate, Frames(static_cast<int32_t>(mStartFrames + frame)), WrapMode::CONTINUE);
+    return timecode.ToSamples(mSamplerate).GetValue() - mStartSamples;
+}
+
+int64_t MidiTimecode::Generator::Position() const
+{
+    // quarter frames are rounded to the nearest sample, frame boundaries are exact
+    return mFrameStart + ((mQuarterFrame & 3) * (mFrameEnd - mFrameStart) + 2) / 4;
+}
+
+void MidiTimecode::Generator::Advance()
+{
+    if ((++mQuarterFrame & 3) == 0)
+    {
+        mFrameStart = mFrameEnd;
+        mFrameEnd   = FrameBoundary(mQuarterFrame / 4 + 1);
+        if ((mQuarterFrame & 7) == 0)
+        {
+            ++mSequenceTimecode;
+            ++mSequenceTimecode;
+        }
+    }
+}
+
+void MidiTimecode::Generator::Seek(int64_t position)
+{
+    int64_t frame = 0;
+    if (position > 0)
+    {
+        const Timecode timecode(mFramerate,
+                                Samples(mStartSamples + position),
+                                mSamplerate,
+                                RoundingMode::TRUNCATE,
+                                WrapMode::CONTINUE);
+        frame = timecode.ToFrames().GetValue() - mStartFrames;
+    }
+    while (frame > 0 && FrameBoundary(frame) > position)
+    {
+        // guard against rounding differences between both conversions
+        frame--;
+    }
+
+    // start at the first quarter frame of the sequence, and advance to the requested position
+    const int64_t sequenceStart = (frame / 2) * 2;
+    mQuarterFrame               = sequenceStart * 4;
+    mFrameStart                 = FrameBoundary(sequenceStart);
+    mFrameEnd                   = FrameBoundary(sequenceStart + 1);
+    mSequenceTimecode =
+        Timecode(mFramerate, Frames(static_cast<int32_t>(mStartFrames + sequenceStart)));
+    while (Position() < position)
+    {
+        Advance();
+    }
+    mNextBlockStart = position;
+}
+
+size_t MidiTimecode::Generator::Generate(Samples blockStart,
+                                         int64_t blockLength,
+                                         Message* messages,
+                                         size_t maxMessages)
+{
+    const int64_t start = blockStart.GetValue();
+    const int64_t end   = start + blockLength;
+    if (start != mNextBlockStart)
+    {
+        Seek(start);
+    }
+
+    size_t count = 0;
+    int64_t position;
+    while ((position = Position()) < end)
+    {
+        if (count == maxMessages)
+        {
+            mNextBlockStart = count > 0 ? start + messages[count - 1].sampleOffset + 1 : start;
+            return count;
+        }
+        Message& message     = messages[count++];
+        message.sampleOffset = position - start;
+        message.bytes[0]     = quarterFrameStatus;
+        message.bytes[1]     = QuarterFrameData(mSequenceTimecode, mQuarterFrame & 7, mRateCode);
+        Advance();
+    }
+    mNextBlockStart = end;
+    return count;
+}
@@ -0,0 +1,218 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <limits>
+#include <tcutils/AbsoluteFrames.h>
+#include <tcutils/PiecewiseTimecodeMap.h>
+#include <tcutils/TimecodeDuration.h>
+
+#include "RationalHelpers.h"
+#include "TimecodeHelpers.h"
+
+using namespace Dolby::TcUtils;
+
+namespace
+{
+    const size_t noSegment = std::numeric_limits<size_t>::max();
+    const int64_t noEnd    = std::numeric_limits<int64_t>::max();
+}
+
+PiecewiseTimecodeMap::PiecewiseTimecodeMap(Samplerate samplerate)
+: mEnd(noEnd)
+, mLastAnchor(0)
+{
+    if (!(samplerate.GetValue() > 0.0))
+    {
+        throw InvalidParameter();
+    }
+    samplerateRational(samplerate, mSamplerateNumerator, mSamplerateDenominator);
+}
+
+bool PiecewiseTimecodeMap::AddAnchor(Samples position, const Timecode& timecode)
+{
+    const int64_t frame   = requireSetFrames(timecode);
+    const int64_t samples = position.GetValue();
+    if ((!mStarts.empty() && samples <= mLastAnchor) || samples >= mEnd)
+    {
+        throw UnorderedAnchor();
+    }
+    mLastAnchor = samples;
+
+    const Framerate framerate = timecode.GetFramerate();
+    const bool wraps          = timecode.GetWrapMode() == WrapMode::WRAP_AT_MIDNIGHT;
+    if (!mSegments.empty())
+    {
+        const SegmentData& last = mSegments.back();
+        if (last.timecode.GetFramerate() == framerate &&
+            last.timecode.GetWrapMode() == timecode.GetWrapMode())
+        {
+            // the frame of the last segment nearest to the anchor
+            int64_t expected = last.frame + mulDivRound(samples - mStarts.back(), last.b, last.a);
+            if (wraps)
+            {
+                expected = floorMod(expected, last.framesPerDay);
+            }
+            if (expected == frame)
+            {
+                return false;
+            }
+        }
+    }
+
+    SegmentData segment;
+    segment.timecode     = timecode;
+    segment.frame        = frame;
+    segment.framesPerDay = AbsoluteFrames::FramesPerDay(framerate);
+    segment.a            = mSamplerateNumerator * rateDenominator(framerate);
+    segment.b            = mSamplerateDenominator * rateNumerator(framerate);
+    mStarts.push_back(samples);
+    mSegments.push_back(segment);
+    return true;
+}
+
+void PiecewiseTimecodeMap::SetEnd(Samples end)
+{
+    if (!mStarts.empty() && end.GetValue() <= mLastAnchor)
+    {
+        throw UnorderedAnchor();
+    }
+    mEnd = end.GetValue();
+}
+
+PiecewiseTimecodeMap::Segment PiecewiseTimecodeMap::GetSegment(size_t i) const
+{
+    return Segment{Samples(mStarts[i]), mSegments[i].timecode};
+}
+
+size_t PiecewiseTimecodeMap::FindSegment(int64_t samples) const
+{
+    const int64_t* starts = mStarts.data();
+    size_t n              = mStarts.size();
+    if (n == 0 || samples < starts[0])
+    {
+        return noSegment;
+    }
+    // the last start not after the position; the conditional compiles to a conditional move
+    size_t base = 0;
+    while (n > 1)
+    {
+        const size_t half = n / 2;
+        base              = starts[base + half] <= samples ? base + half : base;
+        n -= half;
+    }
+    return base;
+}
+
+int64_t PiecewiseTimecodeMap::SegmentEnd(size_t segment) const
+{
+    return segment + 1 < mStarts.size() ? mStarts[segment + 1] : mEnd;
+}
+
+Timecode PiecewiseTimecodeMap::TimecodeInSegment(size_t segment, int64_t samples) const
+{
+    const SegmentData& data = mSegments[segment];
+    const int64_t frames    = frameForSample(samples - mStarts[segment], data.a, data.b);
+    return data.timecode + TimecodeDuration(data.timecode.GetFramerate(), frames);
+}
+
+Timecode PiecewiseTimecodeMap::ToTimecode(Samples samples) const
+{
+    const size_t segment = FindSegment(samples.GetValue());
+    if (segment == noSegment || samples.GetValue() >= mEnd)
+    {
+        return Timecode();
+    }
+    return TimecodeInSegment(segment, samples.GetValue());
+}
+
+void PiecewiseTimecodeMap::ToTimecodes(const int64_t* samples,
+                                       size_t count,
+                                       Timecode* timecodes) const
+{
+    size_t segment       = noSegment;
+    int64_t segmentStart = 0;
+    int64_t segmentEnd   = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (samples[i] < segmentStart || samples[i] >= segmentEnd)
+        {
+            segment = FindSegment(samples[i]);
+            if (segment == noSegment || samples[i] >= mEnd)
+            {
+                timecodes[i] = Timecode();
+                segmentEnd   = segmentStart;
+                continue;
+            }
+            segmentStart = mStarts[segment];
+            segmentEnd   = SegmentEnd(segment);
+        }
+        timecodes[i] = TimecodeInSegment(segment, samples[i]);
+    }
+}
+
+void PiecewiseTimecodeMap::ToSamples(const Timecode& timecode, std::vector<int64_t>& samples) const
+{
+    const int64_t frame = requireSetFrames(timecode);
+    for (size_t i = 0; i < mSegments.size(); i++)
+    {
+        const SegmentData& data = mSegments[i];
+        if (data.timecode.GetFramerate() != timecode.GetFramerate())
+        {
+            continue;
+        }
+        const bool wraps = data.timecode.GetWrapMode() == WrapMode::WRAP_AT_MIDNIGHT;
+        if (wraps && frame >= data.framesPerDay)
+        {
+            // e.g. 25:00:00:00, which a segment that wraps at midnight never reaches
+            continue;
+        }
+        int64_t frames = frame - data.frame;
+        if (wraps)
+        {
+            frames = floorMod(frames, data.framesPerDay);
+        }
+        if (frames < 0)
+        {
+            continue;
+        }
+        const int64_t end = SegmentEnd(i);
+        for (;;)
+        {
+            const int64_t position = mStarts[i] + mulDivRound(frames, data.a, data.b);
+            if (position >= end)
+            {
+                break;
+            }
+            samples.push_back(position);
+            if (!wraps || end == noEnd)
+            {
+                break;
+            }
+            frames += data.framesPerDay;
+        }
+    }
+}
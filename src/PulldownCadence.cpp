@@ -0,0 +1,153 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <tcutils/AbsoluteFrames.h>
+#include <tcutils/PulldownCadence.h>
+
+#include "RationalHelpers.h"
+#include "TimecodeHelpers.h"
+
+using namespace Dolby::TcUtils;
+
+namespace
+{
+    // For each film frame A, B, C, D: the video frame of its first field within the cadence, and
+    // the field it starts on
+    const int filmToVideo[4]      = {0, 1, 2, 3};
+    const int filmToVideoField[4] = {0, 0, 1, 1};
+    const int filmFieldCount[4]   = {2, 3, 2, 3};
+    // For each video frame AA, BB, BC, CD, DD: the film frame of its first and second field
+    const int videoToFilm[2][5] = {{0, 1, 1, 2, 3}, {0, 1, 2, 3, 3}};
+
+    bool IsFilmFramerate(Framerate framerate)
+    {
+        return framerate == Framerate::FPS_23976 || framerate == Framerate::FPS_24;
+    }
+
+    bool IsVideoFramerate(Framerate framerate)
+    {
+        return framerate == Framerate::FPS_2997 || framerate == Framerate::FPS_2997DF ||
+               framerate == Framerate::FPS_30 || framerate == Framerate::FPS_30DF;
+    }
+
+    void RequireFramerate(const Timecode& timecode, Framerate framerate)
+    {
+        if (timecode.GetFramerate() != framerate)
+        {
+            throw PulldownCadence::InvalidFramerate();
+        }
+    }
+}
+
+PulldownCadence::PulldownCadence(const Timecode& filmReference, const Timecode& videoReference)
+: mFilmFramerate(filmReference.GetFramerate())
+, mVideoFramerate(videoReference.GetFramerate())
+, mFilmReference(0)
+, mVideoReference(0)
+{
+    if (!IsFilmFramerate(mFilmFramerate) || !IsVideoFramerate(mVideoFramerate) ||
+        mFilmFramerate.IsRatio1001() != mVideoFramerate.IsRatio1001())
+    {
+        throw InvalidFramerate();
+    }
+    if (!filmReference.IsSet() || !videoReference.IsSet())
+    {
+        throw Timecode::ValueOutOfRange();
+    }
+    mFilmReference  = filmReference.ToFrames().GetValue();
+    mVideoReference = videoReference.ToFrames().GetValue();
+}
+
+int PulldownCadence::FilmCadenceIndex(const Timecode& film) const
+{
+    RequireFramerate(film, mFilmFramerate);
+    return static_cast<int>(floorMod(film.ToFrames().GetValue() - mFilmReference, 4));
+}
+
+Timecode PulldownCadence::ToVideo(const Timecode& film) const
+{
+    RequireFramerate(film, mFilmFramerate);
+    if (!film.IsSet())
+    {
+        return Timecode(mVideoFramerate, film.GetWrapMode());
+    }
+    const int64_t offset = film.ToFrames().GetValue() - mFilmReference;
+    const int64_t video =
+        mVideoReference + floorDiv(offset, 4) * 5 + filmToVideo[floorMod(offset, 4)];
+    return timecodeOfFrames(mVideoFramerate, video, film.GetWrapMode());
+}
+
+Timecode PulldownCadence::ToFilm(const Timecode& video, Field field) const
+{
+    RequireFramerate(video, mVideoFramerate);
+    if (!video.IsSet())
+    {
+        return Timecode(mFilmFramerate, video.GetWrapMode());
+    }
+    const int64_t offset = video.ToFrames().GetValue() - mVideoReference;
+    const int* table     = videoToFilm[static_cast<int>(field)];
+    const int64_t film   = mFilmReference + floorDiv(offset, 5) * 4 + table[floorMod(offset, 5)];
+    return timecodeOfFrames(mFilmFramerate, film, video.GetWrapMode());
+}
+
+PulldownCadence::Phase PulldownCadence::GetPhase(const Timecode& film) const
+{
+    return static_cast<Phase>(FilmCadenceIndex(film));
+}
+
+PulldownCadence::Field PulldownCadence::GetFirstField(const Timecode& film) const
+{
+    return static_cast<Field>(filmToVideoField[FilmCadenceIndex(film)]);
+}
+
+int PulldownCadence::GetFieldCount(const Timecode& film) const
+{
+    return filmFieldCount[FilmCadenceIndex(film)];
+}
+
+bool PulldownCadence::IsSplitFrame(const Timecode& video) const
+{
+    RequireFramerate(video, mVideoFramerate);
+    const int index = static_cast<int>(floorMod(video.ToFrames().GetValue() - mVideoReference, 5));
+    return videoToFilm[0][index] != videoToFilm[1][index];
+}
+
+void PulldownCadence::ToVideo(const Timecode* film, size_t count, Timecode* video) const
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        video[i] = ToVideo(film[i]);
+    }
+}
+
+void PulldownCadence::ToFilm(const Timecode* video, size_t count, Timecode* film, Field field) const
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        film[i] = ToFilm(video[i], field);
+    }
+}
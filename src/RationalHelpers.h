@@ -0,0 +1,243 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef DOLBY_TCUTILS_RATIONALHELPERS_H
+#define DOLBY_TCUTILS_RATIONALHELPERS_H
+
+#include <cmath>
+#include <cstdint>
+#include <tcutils/Framerate.h>
+#include <tcutils/Types.h>
+
+namespace
+{
+    const int64_t nanosecondsPerSecond = 1000000000;
+
+    inline int64_t floorDiv(const int64_t a, const int64_t b)
+    {
+        // b > 0
+        const int64_t q = a / b;
+        return (a % b < 0) ? q - 1 : q;
+    }
+
+    inline int64_t floorMod(const int64_t a, const int64_t b)
+    {
+        return a - floorDiv(a, b) * b;
+    }
+
+    inline int64_t greatestCommonDivisor(int64_t a, int64_t b)
+    {
+        // a, b > 0
+        while (b != 0)
+        {
+            const int64_t r = a % b;
+            a               = b;
+            b               = r;
+        }
+        return a;
+    }
+
+#if defined(__SIZEOF_INT128__) && !defined(DOLBY_TCUTILS_NO_INT128)
+    __extension__ typedef unsigned __int128 uint128_t;
+
+    inline uint64_t mulDivUnsigned(const uint64_t a,
+                                   const uint64_t b,
+                                   const uint64_t c,
+                                   uint64_t& remainder)
+    {
+        const uint128_t product = static_cast<uint128_t>(a) * b;
+        remainder               = static_cast<uint64_t>(product % c);
+        return static_cast<uint64_t>(product / c);
+    }
+#else
+    inline uint64_t mulDivUnsigned(const uint64_t a,
+                                   const uint64_t b,
+                                   const uint64_t c,
+                                   uint64_t& remainder)
+    {
+        // 128-bit product from 32-bit halves
+        const uint64_t aLow   = a & 0xFFFFFFFF;
+        const uint64_t aHigh  = a >> 32;
+        const uint64_t bLow   = b & 0xFFFFFFFF;
+        const uint64_t bHigh  = b >> 32;
+        const uint64_t p0     = aLow * bLow;
+        const uint64_t p1     = aLow * bHigh;
+        const uint64_t p2     = aHigh * bLow;
+        const uint64_t middle = (p0 >> 32) + (p1 & 0xFFFFFFFF) + (p2 & 0xFFFFFFFF);
+        const uint64_t low    = (middle << 32) | (p0 & 0xFFFFFFFF);
+        const uint64_t high   = aHigh * bHigh + (p1 >> 32) + (p2 >> 32) + (middle >> 32);
+
+        // long division, one bit at a time
+        uint64_t quotient = 0;
+        uint64_t rest     = 0;
+        for (int i = 127; i >= 0; i--)
+        {
+            const uint64_t bit = i >= 64 ? (high >> (i - 64)) & 1 : (low >> i) & 1;
+            const bool carry   = (rest >> 63) != 0;
+            rest               = (rest << 1) | bit;
+            quotient <<= 1;
+            if (carry || rest >= c)
+            {
+                rest -= c;
+                quotient |= 1;
+            }
+        }
+        remainder = rest;
+        return quotient;
+    }
+#endif
+
+    inline int64_t mulDivFloor(const int64_t a,
+                               const int64_t b,
+                               const int64_t c,
+                               int64_t& remainder)
+    {
+        // floor(a * b / c) for b >= 0 and c > 0, with a 128-bit intermediate product; the
+        // remainder is in [0, c)
+        uint64_t r;
+        if (a >= 0)
+        {
+            const uint64_t q = mulDivUnsigned(static_cast<uint64_t>(a), b, c, r);
+            remainder        = static_cast<int64_t>(r);
+            return static_cast<int64_t>(q);
+        }
+        const uint64_t q = mulDivUnsigned(0 - static_cast<uint64_t>(a), b, c, r);
+        remainder        = r == 0 ? 0 : c - static_cast<int64_t>(r);
+        return -static_cast<int64_t>(q) - (r == 0 ? 0 : 1);
+    }
+
+    inline int64_t mulDivFloor(const int64_t a, const int64_t b, const int64_t c)
+    {
+        int64_t remainder;
+        return mulDivFloor(a, b, c, remainder);
+    }
+
+    inline int64_t mulDivCeil(const int64_t a, const int64_t b, const int64_t c)
+    {
+        return -mulDivFloor(-a, b, c);
+    }
+
+    inline int64_t mulDivRound(const int64_t a, const int64_t b, const int64_t c)
+    {
+        // a * b / c rounded to nearest, half way rounds up
+        int64_t remainder;
+        const int64_t q = mulDivFloor(a, b, c, remainder);
+        return remainder >= c - remainder ? q + 1 : q;
+    }
+
+    // The framerate in frames per second as numerator / denominator, e.g. 30000 / 1001 for 29.97.
+    inline int64_t rateNumerator(const Dolby::TcUtils::Framerate framerate)
+    {
+        return framerate.IsRatio1001() ? framerate.GetFrameCount() * 1000
+                                       : framerate.GetFrameCount();
+    }
+
+    inline int64_t rateDenominator(const Dolby::TcUtils::Framerate framerate)
+    {
+        return framerate.IsRatio1001() ? 1001 : 1;
+    }
+
+    // The samplerate in Hz as numerator / denominator: exact for integer samplerates and for
+    // samplerates with a 1000/1001 ratio (e.g. 48000 / 1.001), otherwise rounded to 1/1000 Hz.
+    inline void samplerateRational(const Dolby::TcUtils::Samplerate samplerate,
+                                   int64_t& numerator,
+                                   int64_t& denominator)
+    {
+        const double value = samplerate.GetValue();
+        if (value == std::floor(value))
+        {
+            numerator   = static_cast<int64_t>(value);
+            denominator = 1;
+            return;
+        }
+        const double ratio1001 = value * 1001.0;
+        if (std::abs(ratio1001 - std::round(ratio1001)) < 1e-6)
+        {
+            numerator   = std::llround(ratio1001);
+            denominator = 1001;
+            return;
+        }
+        numerator   = std::llround(value * 1000.0);
+        denominator = 1000;
+    }
+
+    // Index of the frame that contains the given sample, for frames of a / b samples of which the
+    // start is rounded to the nearest sample (half way rounds up), as with Timecode::ToSamples:
+    // frame * a / b + 1/2 < sample + 1  <=>  frame < (2 * sample + 1) * b / (2 * a)
+    inline int64_t frameForSample(const int64_t sample, const int64_t a, const int64_t b)
+    {
+        return mulDivCeil(2 * sample + 1, b, 2 * a) - 1;
+    }
+
+    // Index of the frame that contains the given tick: the last frame of which the start time,
+    // truncated to the tick grid, is not after the tick. For ticks of 1/tickRate seconds.
+    inline int64_t frameForTick(const int64_t tick,
+                                const int64_t tickRate,
+                                const Dolby::TcUtils::Framerate framerate)
+    {
+        const int64_t divisor = tickRate * rateDenominator(framerate);
+        return mulDivCeil(tick + 1, rateNumerator(framerate), divisor) - 1;
+    }
+
+    // Start time of the given frame in ticks of 1/tickRate seconds, truncated to the tick grid.
+    inline int64_t tickForFrame(const int64_t frame,
+                                const int64_t tickRate,
+                                const Dolby::TcUtils::Framerate framerate)
+    {
+        return mulDivFloor(frame, tickRate * rateDenominator(framerate), rateNumerator(framerate));
+    }
+
+    // Index of the frame containing the time tick * num / den seconds; frame boundaries are
+    // exact, the frame starting exactly at the given time is included.
+    inline int64_t frameForTime(const int64_t tick,
+                                const int64_t num,
+                                const int64_t den,
+                                const Dolby::TcUtils::Framerate framerate)
+    {
+        return mulDivFloor(tick, num * rateNumerator(framerate), den * rateDenominator(framerate));
+    }
+
+    // Index of the frame nearest to the time tick * num / den seconds, half way rounds up.
+    inline int64_t nearestFrameForTime(const int64_t tick,
+                                       const int64_t num,
+                                       const int64_t den,
+                                       const Dolby::TcUtils::Framerate framerate)
+    {
+        return mulDivRound(tick, num * rateNumerator(framerate), den * rateDenominator(framerate));
+    }
+
+    // The first tick of num / den seconds at or after the start of the given frame.
+    inline int64_t firstTickForFrame(const int64_t frame,
+                                     const int64_t num,
+                                     const int64_t den,
+                                     const Dolby::TcUtils::Framerate framerate)
+    {
+        return mulDivCeil(frame, den * rateDenominator(framerate), num * rateNumerator(framerate));
+    }
+}
+
+#endif
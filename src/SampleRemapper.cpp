@@ -0,0 +1,229 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cassert>
+#include <limits>
+#include <tcutils/SampleRemapper.h>
+
+#include "RationalHelpers.h"
+
+using namespace Dolby::TcUtils;
+
+namespace
+{
+    void samplerateRationalChecked(Samplerate samplerate, int64_t& numerator, int64_t& denominator)
+    {
+        if (!(samplerate.GetValue() > 0.0))
+        {
+            throw SampleRemapper::InvalidParameter();
+        }
+        samplerateRational(samplerate, numerator, denominator);
+    }
+
+    // the pull factor applied to positions as numerator / denominator
+    int64_t pullNumerator(SampleRemapper::Pull pull)
+    {
+        switch (pull)
+        {
+            case SampleRemapper::Pull::UP:
+                return 1000;
+            case SampleRemapper::Pull::DOWN:
+                return 1001;
+            default:
+                return 1;
+        }
+    }
+
+    int64_t pullDenominator(SampleRemapper::Pull pull)
+    {
+        switch (pull)
+        {
+            case SampleRemapper::Pull::UP:
+                return 1001;
+            case SampleRemapper::Pull::DOWN:
+                return 1000;
+            default:
+                return 1;
+        }
+    }
+
+    SampleRemapper::Pull opposite(SampleRemapper::Pull pull)
+    {
+        return pull == SampleRemapper::Pull::DOWN ? SampleRemapper::Pull::UP
+               : pull == SampleRemapper::Pull::UP ? SampleRemapper::Pull::DOWN
+                                                  : SampleRemapper::Pull::NONE;
+    }
+}
+
+SampleRemapper::SampleRemapper(Samplerate from, Samplerate to, Pull pull, RoundingMode roundingMode)
+: SampleRemapper(from, to, pull, 0, 1, roundingMode)
+{
+}
+
+SampleRemapper::SampleRemapper(Samplerate from,
+                               Samplerate to,
+                               Pull pull,
+                               Framerate framerate,
+                               RoundingMode roundingMode)
+: SampleRemapper(from,
+                 to,
+                 pull,
+                 framerate.IsDefined() ? rateNumerator(framerate) : -1,
+                 framerate.IsDefined() ? rateDenominator(framerate) : 1,
+                 roundingMode)
+{
+}
+
+SampleRemapper::SampleRemapper(Samplerate from,
+                               Samplerate to,
+                               Pull pull,
+                               int64_t frameNumerator,
+                               int64_t frameDenominator,
+                               RoundingMode roundingMode)
+: mFrom(from)
+, mTo(to)
+, mPull(pull)
+, mRoundingMode(roundingMode)
+, mFrameAligned(frameNumerator != 0)
+, mFrameNumerator(frameNumerator)
+, mFrameDenominator(frameDenominator)
+{
+    if (frameNumerator < 0)
+    {
+        throw InvalidParameter();
+    }
+
+    int64_t fromNumerator;
+    int64_t fromDenominator;
+    int64_t toNumerator;
+    int64_t toDenominator;
+    samplerateRationalChecked(from, fromNumerator, fromDenominator);
+    samplerateRationalChecked(to, toNumerator, toDenominator);
+
+    const int64_t multiplier = toNumerator * fromDenominator * pullNumerator(pull);
+    const int64_t divisor    = toDenominator * fromNumerator * pullDenominator(pull);
+    const int64_t gcd        = greatestCommonDivisor(multiplier, divisor);
+    mMultiplier              = multiplier / gcd;
+    mDivisor                 = divisor / gcd;
+    // 2 * samples * mMultiplier + mDivisor must fit in 64 bits
+    mFastLimit = (std::numeric_limits<int64_t>::max() / 2 - mDivisor) / mMultiplier;
+
+    if (mFrameAligned)
+    {
+        mSourceFrameA      = fromNumerator * frameDenominator;
+        mSourceFrameB      = fromDenominator * frameNumerator;
+        mDestinationFrameA = toNumerator * frameDenominator * pullNumerator(pull);
+        mDestinationFrameB = toDenominator * frameNumerator * pullDenominator(pull);
+    }
+    else
+    {
+        mSourceFrameA      = 0;
+        mSourceFrameB      = 1;
+        mDestinationFrameA = 0;
+        mDestinationFrameB = 1;
+    }
+}
+
+int64_t SampleRemapper::Scale(int64_t samples) const
+{
+    switch (mRoundingMode)
+    {
+        case RoundingMode::TRUNCATE:
+        {
+            return mulDivFloor(samples, mMultiplier, mDivisor);
+        }
+        case RoundingMode::NEAREST:
+        {
+            return mulDivRound(samples, mMultiplier, mDivisor);
+        }
+        default:
+            assert(false);
+            break;
+    }
+    return 0;
+}
+
+Samples SampleRemapper::Remap(Samples samples) const
+{
+    if (!mFrameAligned)
+    {
+        return Samples(Scale(samples.GetValue()));
+    }
+
+    const int64_t frame = frameForSample(samples.GetValue(), mSourceFrameA, mSourceFrameB);
+    const int64_t start = mulDivRound(frame, mSourceFrameA, mSourceFrameB);
+    return Samples(mulDivRound(frame, mDestinationFrameA, mDestinationFrameB) +
+                   Scale(samples.GetValue() - start));
+}
+
+void SampleRemapper::Remap(const int64_t* samples, size_t count, int64_t* remapped) const
+{
+    int64_t maxMagnitude = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        const int64_t magnitude = samples[i] < 0 ? -(samples[i] + 1) : samples[i];
+        maxMagnitude            = magnitude > maxMagnitude ? magnitude : maxMagnitude;
+    }
+
+    if (mFrameAligned || maxMagnitude >= mFastLimit)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            remapped[i] = Remap(Samples(samples[i])).GetValue();
+        }
+        return;
+    }
+
+    // 64-bit products: one multiplication and one division by a loop invariant per position
+    const int64_t multiplier = mMultiplier;
+    const int64_t divisor    = mDivisor;
+    if (mRoundingMode == RoundingMode::TRUNCATE)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            remapped[i] = floorDiv(samples[i] * multiplier, divisor);
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            remapped[i] = floorDiv(2 * samples[i] * multiplier + divisor, 2 * divisor);
+        }
+    }
+}
+
+SampleRemapper SampleRemapper::Inverse() const
+{
+    // for frame-aligned remapping, the source framerate of the inverse is the pulled framerate
+    return SampleRemapper(mTo,
+                          mFrom,
+                          opposite(mPull),
+                          mFrameNumerator * pullDenominator(mPull),
+                          mFrameDenominator * pullNumerator(mPull),
+                          mRoundingMode);
+}
@@ -0,0 +1,180 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <cmath>
+#include <tcutils/AbsoluteFrames.h>
+#include <tcutils/SessionTimeline.h>
+
+#include "RationalHelpers.h"
+#include "TimecodeHelpers.h"
+
+using namespace Dolby::TcUtils;
+
+namespace
+{
+    const Timecode& RequireSet(const Timecode& timecode)
+    {
+        if (!timecode.IsSet())
+        {
+            throw SessionTimeline::InvalidParameter();
+        }
+        return timecode;
+    }
+
+    // The frames of the hours, minutes, seconds and frames of the timecode, counting the frames
+    // that drop-frame timecode skips, as in DAMF-time
+    int64_t LabelFrames(const Timecode& timecode)
+    {
+        const int64_t minutes = int64_t(timecode.GetUnitHours()) * 60 + timecode.GetUnitMinutes();
+        const int64_t seconds = minutes * 60 + timecode.GetUnitSeconds();
+        return seconds * timecode.GetFramerate().GetFrameCount() + timecode.GetUnitFrames();
+    }
+}
+
+SessionTimeline::SessionTimeline(const Timecode& start, Samplerate samplerate)
+: mStart(RequireSet(start))
+, mSamplerate(samplerate)
+{
+    if (!(samplerate.GetValue() > 0.0))
+    {
+        throw InvalidParameter();
+    }
+    int64_t numerator;
+    int64_t denominator;
+    samplerateRational(samplerate, numerator, denominator);
+    const Framerate framerate = start.GetFramerate();
+    mA                        = numerator * rateDenominator(framerate);
+    mB                        = denominator * rateNumerator(framerate);
+    mStartFrame               = start.ToFrames().GetValue();
+    mOrigin                   = mulDivRound(mStartFrame, mA, mB);
+    mFramesPerDay             = AbsoluteFrames::FramesPerDay(framerate);
+}
+
+int64_t SessionTimeline::FrameOf(int64_t samples) const
+{
+    return frameForSample(samples + mOrigin, mA, mB);
+}
+
+Timecode SessionTimeline::TimecodeOf(int64_t frame) const
+{
+    return timecodeOfFrames(mStart.GetFramerate(), frame, mStart.GetWrapMode());
+}
+
+int64_t SessionTimeline::SamplesOf(const Timecode& timecode) const
+{
+    if (timecode.GetFramerate() != mStart.GetFramerate())
+    {
+        throw std::logic_error("Operation requires timecodes with matching framerates");
+    }
+    if (!timecode.IsSet())
+    {
+        throw Timecode::ValueOutOfRange();
+    }
+    int64_t frames = timecode.ToFrames().GetValue() - mStartFrame;
+    if (mStart.GetWrapMode() == WrapMode::WRAP_AT_MIDNIGHT)
+    {
+        frames = floorMod(frames, mFramesPerDay);
+    }
+    return mulDivRound(mStartFrame + frames, mA, mB) - mOrigin;
+}
+
+double SessionTimeline::DAMFSecondsOf(int64_t samples) const
+{
+    const int64_t frame    = FrameOf(samples);
+    const Timecode label   = TimecodeOf(frame);
+    const int64_t position = samples + mOrigin - mulDivRound(frame, mA, mB);
+    // the part of the frame before the position, in frames
+    const double fraction = static_cast<double>(position) * static_cast<double>(mB) /
+                            static_cast<double>(mA);
+    return (static_cast<double>(LabelFrames(label)) + fraction) /
+           static_cast<double>(mStart.GetFramerate().GetFrameCount());
+}
+
+int64_t SessionTimeline::SamplesOf(double seconds) const
+{
+    const Framerate framerate = mStart.GetFramerate();
+    const Timecode label(
+        framerate, DAMFSeconds(seconds), RoundingMode::TRUNCATE, mStart.GetWrapMode());
+    const double fraction = seconds * static_cast<double>(framerate.GetFrameCount()) -
+                            static_cast<double>(LabelFrames(label));
+    const double position = std::max(fraction, 0.0) * static_cast<double>(mA) /
+                            static_cast<double>(mB);
+    return SamplesOf(label) + static_cast<int64_t>(std::llround(position));
+}
+
+Timecode SessionTimeline::ToTimecode(Samples samples) const
+{
+    return TimecodeOf(FrameOf(samples.GetValue()));
+}
+
+Samples SessionTimeline::ToSamples(const Timecode& timecode) const
+{
+    return Samples(SamplesOf(timecode));
+}
+
+DAMFSeconds SessionTimeline::ToDAMFSeconds(Samples samples) const
+{
+    return DAMFSeconds(DAMFSecondsOf(samples.GetValue()));
+}
+
+Samples SessionTimeline::ToSamples(DAMFSeconds seconds) const
+{
+    return Samples(SamplesOf(seconds.GetValue()));
+}
+
+void SessionTimeline::ToTimecodes(const int64_t* samples, size_t count, Timecode* timecodes) const
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        timecodes[i] = TimecodeOf(FrameOf(samples[i]));
+    }
+}
+
+void SessionTimeline::ToSamples(const Timecode* timecodes, size_t count, int64_t* samples) const
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        samples[i] = SamplesOf(timecodes[i]);
+    }
+}
+
+void SessionTimeline::ToDAMFSeconds(const int64_t* samples, size_t count, double* seconds) const
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        seconds[i] = DAMFSecondsOf(samples[i]);
+    }
+}
+
+void SessionTimeline::ToSamples(const DAMFSeconds* seconds, size_t count, int64_t* samples) const
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        samples[i] = SamplesOf(seconds[i].GetValue());
+    }
+}
@@ -0,0 +1,162 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <tcutils/AbsoluteFrames.h>
+#include <tcutils/SyncAligner.h>
+
+#include "RationalHelpers.h"
+
+using namespace Dolby::TcUtils;
+
+SyncAligner::SyncAligner(const std::vector<File>& files)
+{
+    if (files.empty())
+    {
+        return;
+    }
+    const Framerate framerate = files[0].start.GetFramerate();
+    bool wraps                = true;
+    mFiles.reserve(files.size());
+    for (const File& file : files)
+    {
+        if (file.start.GetFramerate() != framerate)
+        {
+            throw std::logic_error("Operation requires timecodes with matching framerates");
+        }
+        if (!file.start.IsSet() || !(file.samplerate.GetValue() > 0.0) ||
+            file.length.GetValue() < 0)
+        {
+            throw InvalidParameter();
+        }
+        wraps = wraps && file.start.GetWrapMode() == WrapMode::WRAP_AT_MIDNIGHT;
+
+        int64_t numerator;
+        int64_t denominator;
+        samplerateRational(file.samplerate, numerator, denominator);
+        FileData data;
+        data.frame   = file.start.ToFrames().GetValue();
+        data.length  = file.length.GetValue();
+        data.a       = numerator * rateDenominator(framerate);
+        data.b       = denominator * rateNumerator(framerate);
+        data.cluster = 0;
+        mFiles.push_back(data);
+    }
+
+    std::vector<size_t> order(mFiles.size());
+    std::iota(order.begin(), order.end(), size_t(0));
+    std::sort(order.begin(), order.end(), [this](size_t i, size_t j) {
+        return mFiles[i].frame < mFiles[j].frame || (mFiles[i].frame == mFiles[j].frame && i < j);
+    });
+
+    if (wraps)
+    {
+        // start the day after the largest gap between start timecodes, the files before it are
+        // after midnight
+        const int64_t framesPerDay = AbsoluteFrames::FramesPerDay(framerate);
+        const size_t count         = order.size();
+        size_t cut                 = count - 1;
+        int64_t largestGap = mFiles[order[0]].frame + framesPerDay - mFiles[order[cut]].frame;
+        for (size_t k = 0; k + 1 < count; k++)
+        {
+            const int64_t gap = mFiles[order[k + 1]].frame - mFiles[order[k]].frame;
+            if (gap > largestGap)
+            {
+                largestGap = gap;
+                cut        = k;
+            }
+        }
+        if (cut + 1 < count)
+        {
+            for (size_t k = 0; k <= cut; k++)
+            {
+                mFiles[order[k]].frame += framesPerDay;
+            }
+            const auto first = static_cast<std::ptrdiff_t>(cut + 1);
+            std::rotate(order.begin(), order.begin() + first, order.end());
+        }
+    }
+
+    for (FileData& file : mFiles)
+    {
+        // the length in frames is length * b / a
+        file.endFrame = file.frame + mulDivFloor(file.length, file.b, file.a, file.endRemainder);
+    }
+
+    // sweep over the files in order of start, keeping the file of the cluster that ends last
+    const FileData* last = nullptr;
+    for (size_t i : order)
+    {
+        FileData& file = mFiles[i];
+        if (last == nullptr || file.frame > last->endFrame)
+        {
+            mClusters.push_back(std::vector<size_t>());
+            last = &file;
+        }
+        else if (EndsBefore(*last, file))
+        {
+            last = &file;
+        }
+        file.cluster = mClusters.size() - 1;
+        mClusters.back().push_back(i);
+    }
+}
+
+bool SyncAligner::EndsBefore(const FileData& file, const FileData& other)
+{
+    if (file.endFrame != other.endFrame)
+    {
+        return file.endFrame < other.endFrame;
+    }
+    // file.endRemainder / file.a < other.endRemainder / other.a, with other.endRemainder integer
+    return mulDivFloor(file.endRemainder, other.a, file.a) < other.endRemainder;
+}
+
+Samples SyncAligner::GetOffset(size_t from, size_t to) const
+{
+    const FileData& reference = mFiles[from];
+    return Samples(mulDivRound(mFiles[to].frame, reference.a, reference.b) -
+                   mulDivRound(reference.frame, reference.a, reference.b));
+}
+
+Samples SyncAligner::GetOverlap(size_t from, size_t to) const
+{
+    const FileData& reference = mFiles[from];
+    const FileData& other     = mFiles[to];
+    // the samplerate of from over the samplerate of to is (from.a / from.b) / (to.a / to.b)
+    const int64_t gcdA        = greatestCommonDivisor(reference.a, other.a);
+    const int64_t gcdB        = greatestCommonDivisor(reference.b, other.b);
+    const int64_t numerator   = (reference.a / gcdA) * (other.b / gcdB);
+    const int64_t denominator = (reference.b / gcdB) * (other.a / gcdA);
+
+    const int64_t start = GetOffset(from, to).GetValue();
+    const int64_t end   = start + mulDivRound(other.length, numerator, denominator);
+    return Samples(std::max(std::min(end, reference.length) - std::max(start, int64_t(0)),
+                            int64_t(0)));
+}
@@ -0,0 +1,125 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef DOLBY_TCUTILS_THREADHELPERS_H
+#define DOLBY_TCUTILS_THREADHELPERS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // below this number of elements per thread, starting the threads costs more than it saves
+    const size_t minCountPerThread = size_t(1) << 16;
+
+    // The number of threads to use for count elements: the given number (0 for the number of
+    // hardware threads), but at most one per minCountPerThread elements
+    inline unsigned threadCount(size_t count, unsigned threads)
+    {
+        if (threads == 0)
+        {
+            threads = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+        return static_cast<unsigned>(
+            std::min(static_cast<size_t>(threads), std::max(count / minCountPerThread, size_t(1))));
+    }
+
+    // Call function(block, begin, end) for consecutive blocks of [0, count), one block per thread
+    template <class Function>
+    void forEachBlock(size_t count, unsigned threads, const Function& function)
+    {
+        std::vector<std::thread> workers;
+        workers.reserve(threads - 1);
+        try
+        {
+            for (unsigned block = 1; block < threads; block++)
+            {
+                workers.emplace_back(
+                    function, block, count * block / threads, count * (block + 1) / threads);
+            }
+        }
+        catch (...)
+        {
+            for (std::thread& worker : workers)
+            {
+                worker.join();
+            }
+            throw;
+        }
+        function(0u, size_t(0), count / threads);
+        for (std::thread& worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    // Sort [first, last) as std::sort on the given number of threads: the halves are sorted on
+    // half of the threads each and then merged
+    template <class Iterator, class Compare>
+    void parallelSort(Iterator first, Iterator last, const Compare& compare, unsigned threads)
+    {
+        if (threads < 2)
+        {
+            std::sort(first, last, compare);
+            return;
+        }
+        const Iterator middle = first + (last - first) / 2;
+        std::exception_ptr error;
+        std::thread worker(
+            [&]
+            {
+                try
+                {
+                    parallelSort(first, middle, compare, threads / 2);
+                }
+                catch (...)
+                {
+                    error = std::current_exception();
+                }
+            });
+        try
+        {
+            parallelSort(middle, last, compare, threads - threads / 2);
+        }
+        catch (...)
+        {
+            worker.join();
+            throw;
+        }
+        worker.join();
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+        std::inplace_merge(first, middle, last, compare);
+    }
+}
+
+#endif
@@ -32,6 +32,7 @@
 #include <tcutils/Timecode.h>
 
 #include "DropFrameHelpers.h"
+#include "RationalHelpers.h"
 
 using namespace Dolby::TcUtils;
 
@@ -164,6 +165,41 @@ namespace
         return Frames(-1);
     }
 
+    Frames CalculateFrames(Framerate framerate,
+                           int64_t ticks,
+                           int64_t numerator,
+                           int64_t denominator,
+                           RoundingMode roundingMode)
+    {
+        if (framerate == Framerate::UNDEFINED || ticks < 0)
+        {
+            return Frames(-1);
+        }
+
+        int64_t frames = -1;
+        switch (roundingMode)
+        {
+            case RoundingMode::TRUNCATE:
+            {
+                frames = frameForTime(ticks, numerator, denominator, framerate);
+                break;
+            }
+            case RoundingMode::NEAREST:
+            {
+                frames = nearestFrameForTime(ticks, numerator, denominator, framerate);
+                break;
+            }
+            default:
+                assert(false);
+                break;
+        }
+        if (frames > INT32_MAX)
+        {
+            throw Timecode::ValueOutOfRange();
+        }
+        return Frames(static_cast<int32_t>(frames));
+    }
+
     int32_t CalculateFramesCountingDroppedFrames(Framerate framerate,
                                                  DAMFSeconds seconds,
                                                  RoundingMode roundingMode)
@@ -295,6 +331,16 @@ Timecode::Timecode(Framerate framerate,
 {
 }
 
+Timecode::Timecode(Framerate framerate,
+                   const TickTime& time,
+                   RoundingMode roundingMode,
+                   WrapMode wrapMode)
+: Timecode(framerate,
+           CalculateFrames(framerate, time.ticks, time.numerator, time.denominator, roundingMode),
+           wrapMode)
+{
+}
+
 Timecode::Timecode(Framerate framerate,
                    Samples samples,
                    Samplerate samplerate,
@@ -363,6 +409,11 @@ Samples Timecode::ToSamples(Samplerate samplerate) const
     return CalculateSamples(mFramerate, ToFrames(), samplerate);
 }
 
+int64_t Timecode::ToTickCount(int64_t numerator, int64_t denominator) const
+{
+    return firstTickForFrame(ToFrames().GetValue(), numerator, denominator, mFramerate);
+}
+
 bool Timecode::IsValid() const
 {
     return mFramerate != Framerate::UNDEFINED;
@@ -460,6 +511,122 @@ const Framerate& Timecode::GetFramerate() const
     return mFramerate;
 }
 
+namespace
+{
+    // Conversion of frame counts between framerates: the frame start in the source framerate,
+    // frames * sourceDenominator / sourceNumerator seconds, in frames of the destination framerate
+    struct FramerateConversion
+    {
+        Framerate source;
+        int64_t multiplier;
+        int64_t divisor;
+
+        FramerateConversion(Framerate from, Framerate to)
+        : source(from)
+        , multiplier(rateDenominator(from) * rateNumerator(to))
+        , divisor(rateNumerator(from) * rateDenominator(to))
+        {
+        }
+
+        Frames Convert(Frames frames, RoundingMode roundingMode) const
+        {
+            // frame counts of a timecode are below 2^29 (100 hours at 999 FPS) and the multiplier
+            // below 2^30 (1001 * 999000), so even twice the product fits in 64 bits
+            const int64_t product = frames.GetValue() * multiplier;
+            switch (roundingMode)
+            {
+                case RoundingMode::TRUNCATE:
+                {
+                    return Frames(static_cast<int32_t>(product / divisor));
+                }
+                case RoundingMode::NEAREST:
+                {
+                    return Frames(static_cast<int32_t>((2 * product + divisor) / (2 * divisor)));
+                }
+                default:
+                    assert(false);
+                    break;
+            }
+            return Frames(-1);
+        }
+    };
+}
+
+Timecode Timecode::ConvertTo(Framerate framerate, RoundingMode roundingMode) const
+{
+    if (!IsSet() || !framerate.IsDefined())
+    {
+        return Timecode(framerate, mWrapMode);
+    }
+    const FramerateConversion conversion(mFramerate, framerate);
+    return Timecode(framerate, conversion.Convert(ToFrames(), roundingMode), mWrapMode);
+}
+
+void Timecode::ConvertTo(const Timecode* timecodes,
+                         size_t count,
+                         Framerate framerate,
+                         Timecode* converted,
+                         RoundingMode roundingMode)
+{
+    if (!framerate.IsDefined())
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            converted[i] = Timecode(framerate, timecodes[i].mWrapMode);
+        }
+        return;
+    }
+
+    FramerateConversion conversion(framerate, framerate);
+    for (size_t i = 0; i < count; i++)
+    {
+        const Timecode& timecode = timecodes[i];
+        if (!timecode.IsSet())
+        {
+            converted[i] = Timecode(framerate, timecode.mWrapMode);
+            continue;
+        }
+        if (timecode.mFramerate != conversion.source)
+        {
+            conversion = FramerateConversion(timecode.mFramerate, framerate);
+        }
+        converted[i] = Timecode(framerate,
+                                conversion.Convert(timecode.ToFrames(), roundingMode),
+                                timecode.mWrapMode);
+    }
+}
+
+int Timecode::Compare(const Timecode& a, const Timecode& b)
+{
+    if (a.IsSet() != b.IsSet())
+    {
+        return a.IsSet() ? 1 : -1;
+    }
+    if (a.IsSet())
+    {
+        // compare a.frames / a.rate with b.frames / b.rate; the products fit in 64 bits
+        const int64_t timeA = static_cast<int64_t>(a.ToFrames().GetValue()) *
+                              rateDenominator(a.mFramerate) * rateNumerator(b.mFramerate);
+        const int64_t timeB = static_cast<int64_t>(b.ToFrames().GetValue()) *
+                              rateDenominator(b.mFramerate) * rateNumerator(a.mFramerate);
+        if (timeA != timeB)
+        {
+            return timeA < timeB ? -1 : 1;
+        }
+    }
+    const Framerate& framerateA = a.mFramerate;
+    const Framerate& framerateB = b.mFramerate;
+    if (framerateA.GetEnum() != framerateB.GetEnum())
+    {
+        return static_cast<int>(framerateA.GetEnum()) - static_cast<int>(framerateB.GetEnum());
+    }
+    if (framerateA.GetFrameCount() != framerateB.GetFrameCount())
+    {
+        return framerateA.GetFrameCount() - framerateB.GetFrameCount();
+    }
+    return static_cast<int>(framerateA.IsRatio1001()) - static_cast<int>(framerateB.IsRatio1001());
+}
+
 void Timecode::RequireMatchingFramerate(const Timecode& other) const
 {
     if (mFramerate == other.mFramerate)
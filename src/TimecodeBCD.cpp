@@ -0,0 +1,336 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <tcutils/TimecodeBCD.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define DOLBY_TCUTILS_BCD_SSE2 1
+#endif
+
+#include "DropFrameHelpers.h"
+
+using namespace Dolby::TcUtils;
+
+namespace
+{
+    using Status = TimecodeBCD::Status;
+
+    // Masks for the tens digits per byte: frames and hours have 2 bits, seconds and minutes 3 bits.
+    const uint32_t tensMask  = 0x03070703;
+    const uint32_t unitsMask = 0x0F0F0F0F;
+
+    bool IsSupported(Framerate framerate)
+    {
+        return framerate.IsDefined() && framerate.GetFrameCount() <= 30;
+    }
+
+    uint32_t ToBCD(int value)
+    {
+        return static_cast<uint32_t>(((value / 10) << 4) | (value % 10));
+    }
+
+    struct Fields
+    {
+        int hours;
+        int minutes;
+        int seconds;
+        int frames;
+    };
+
+    Status DecodeFields(uint32_t word, Framerate framerate, Fields& fields)
+    {
+        if (!IsSupported(framerate))
+        {
+            return Status::UNSUPPORTED_FRAMERATE;
+        }
+
+        const uint32_t units = word & unitsMask;
+        const uint32_t tens  = (word >> 4) & tensMask;
+        if (((units + 0x06060606) & 0xF0F0F0F0) != 0)
+        {
+            // adding 6 to a nibble carries into the next nibble only when it is larger than 9
+            return Status::INVALID_DIGIT;
+        }
+
+        fields.frames  = static_cast<int>((tens & 0xFF) * 10 + (units & 0xFF));
+        fields.seconds = static_cast<int>(((tens >> 8) & 0xFF) * 10 + ((units >> 8) & 0xFF));
+        fields.minutes = static_cast<int>(((tens >> 16) & 0xFF) * 10 + ((units >> 16) & 0xFF));
+        fields.hours   = static_cast<int>((tens >> 24) * 10 + (units >> 24));
+
+        if (fields.hours >= 24 || fields.minutes >= 60 || fields.seconds >= 60 ||
+            fields.frames >= framerate.GetFrameCount())
+        {
+            return Status::VALUE_OUT_OF_RANGE;
+        }
+        if (((word & TimecodeBCD::DROP_FRAME) != 0) != framerate.IsDrop())
+        {
+            return Status::DROP_FLAG_MISMATCH;
+        }
+        if (framerate.IsDrop() && fields.seconds == 0 && fields.frames < 2 &&
+            (fields.minutes % 10) != 0)
+        {
+            return Status::INVALID_DROP_FRAME;
+        }
+        return Status::OK;
+    }
+
+    int32_t ToFrames(Framerate framerate, const Fields& fields)
+    {
+        const int32_t mins   = fields.hours * 60 + fields.minutes;
+        const int32_t frames =
+            (mins * 60 + fields.seconds) * framerate.GetFrameCount() + fields.frames;
+        return framerate.IsDrop() ? frames - dropFramesToRemoveForMinutes(mins) : frames;
+    }
+
+    int32_t DecodeFramesScalar(uint32_t word, Framerate framerate)
+    {
+        Fields fields;
+        if (DecodeFields(word, framerate, fields) != Status::OK)
+        {
+            return -1;
+        }
+        return ToFrames(framerate, fields);
+    }
+
+#ifdef DOLBY_TCUTILS_BCD_SSE2
+    // Decodes four words at once. Returns the frame counts, with -1 for invalid words.
+    __m128i DecodeFramesSSE2(__m128i words, Framerate framerate)
+    {
+        const int frameCount = framerate.GetFrameCount();
+        const bool isDrop    = framerate.IsDrop();
+
+        const __m128i zero  = _mm_setzero_si128();
+        const __m128i units = _mm_and_si128(words, _mm_set1_epi32(unitsMask));
+        const __m128i tens  = _mm_and_si128(_mm_srli_epi32(words, 4), _mm_set1_epi32(tensMask));
+
+        // Each byte holds a value below 80, so the byte-wise signed compares below are safe and
+        // tens * 10 never carries into the next byte.
+        const __m128i binary = _mm_add_epi32(
+            units, _mm_add_epi32(_mm_slli_epi32(tens, 3), _mm_slli_epi32(tens, 1)));
+
+        // bytes in little endian order: frames, seconds, minutes, hours
+        const __m128i maxDigits = _mm_set1_epi32(0x09090909);
+        const __m128i maxValues =
+            _mm_set1_epi32(static_cast<int>(0x173B3B00u | static_cast<uint32_t>(frameCount - 1)));
+        __m128i invalid = _mm_or_si128(_mm_cmpgt_epi8(units, maxDigits),
+                                       _mm_cmpgt_epi8(binary, maxValues));
+
+        const __m128i dropFlag = _mm_and_si128(words, _mm_set1_epi32(TimecodeBCD::DROP_FRAME));
+        const __m128i expectedDropFlag =
+            _mm_set1_epi32(isDrop ? static_cast<int>(TimecodeBCD::DROP_FRAME) : 0);
+        invalid = _mm_or_si128(invalid,
+                               _mm_xor_si128(_mm_cmpeq_epi32(dropFlag, expectedDropFlag),
+                                             _mm_set1_epi32(-1)));
+
+        // 16-bit lanes: frames and minutes in lo, seconds and hours in hi
+        const __m128i lowMask       = _mm_set1_epi32(0x00FF00FF);
+        const __m128i framesMinutes = _mm_and_si128(binary, lowMask);
+        const __m128i secondsHours  = _mm_and_si128(_mm_srli_epi32(binary, 8), lowMask);
+        const __m128i frames        = _mm_and_si128(framesMinutes, _mm_set1_epi32(0xFF));
+        const __m128i seconds       = _mm_and_si128(secondsHours, _mm_set1_epi32(0xFF));
+
+        // minutes = hours * 60 + minutes
+        const __m128i minutes =
+            _mm_add_epi32(_mm_madd_epi16(secondsHours, _mm_set1_epi32(60 << 16)),
+                          _mm_srli_epi32(framesMinutes, 16));
+        // total = minutes * 60 * frameCount + seconds * frameCount + frames
+        const __m128i minutesSeconds = _mm_or_si128(minutes, _mm_slli_epi32(seconds, 16));
+        __m128i total = _mm_add_epi32(
+            _mm_madd_epi16(minutesSeconds, _mm_set1_epi32((frameCount << 16) | (60 * frameCount))),
+            frames);
+
+        if (isDrop)
+        {
+            // minutes / 10 == (minutes * 6554) >> 16 for all minutes below 16389
+            const __m128i tenMinutes =
+                _mm_srli_epi32(_mm_madd_epi16(minutes, _mm_set1_epi32(6554)), 16);
+            const __m128i dropped =
+                _mm_slli_epi32(_mm_sub_epi32(minutes, tenMinutes), 1); // 2 * (mins - mins / 10)
+            total = _mm_sub_epi32(total, dropped);
+
+            // frames 0 and 1 are dropped at second 0 of every minute, except every tenth minute
+            const __m128i minuteUnits =
+                _mm_and_si128(_mm_srli_epi32(words, 16), _mm_set1_epi32(0x0F));
+            const __m128i droppedNumber =
+                _mm_andnot_si128(_mm_cmpeq_epi32(minuteUnits, zero),
+                                 _mm_and_si128(_mm_cmpeq_epi32(seconds, zero),
+                                               _mm_cmplt_epi32(frames, _mm_set1_epi32(2))));
+            invalid = _mm_or_si128(invalid, droppedNumber);
+        }
+
+        // a word is valid when none of its bytes is flagged invalid
+        const __m128i valid = _mm_cmpeq_epi32(invalid, zero);
+        return _mm_or_si128(_mm_and_si128(valid, total),
+                            _mm_andnot_si128(valid, _mm_set1_epi32(-1)));
+    }
+#endif
+
+    void ThrowForStatus(Status status)
+    {
+        switch (status)
+        {
+            case Status::OK:
+                return;
+            case Status::INVALID_DIGIT:
+                throw Timecode::InvalidFormat();
+            case Status::VALUE_OUT_OF_RANGE:
+                throw Timecode::ValueOutOfRange();
+            case Status::INVALID_DROP_FRAME:
+                throw Timecode::InvalidDropFrame();
+            case Status::DROP_FLAG_MISMATCH:
+                throw Timecode::InvalidFormat();
+            case Status::UNSUPPORTED_FRAMERATE:
+                throw TimecodeBCD::UnsupportedFramerate();
+        }
+    }
+}
+
+uint32_t TimecodeBCD::Pack(const Timecode& timecode, uint32_t flags)
+{
+    const Framerate& framerate = timecode.GetFramerate();
+    if (!IsSupported(framerate))
+    {
+        throw UnsupportedFramerate();
+    }
+    if (!timecode.IsSet() || timecode.GetUnitHours() >= 24)
+    {
+        throw Timecode::ValueOutOfRange();
+    }
+
+    const uint32_t dropFlag = framerate.IsDrop() ? DROP_FRAME : NONE;
+    return (flags & FLAGS_MASK & ~static_cast<uint32_t>(DROP_FRAME)) | dropFlag |
+           (ToBCD(timecode.GetUnitHours()) << 24) | (ToBCD(timecode.GetUnitMinutes()) << 16) |
+           (ToBCD(timecode.GetUnitSeconds()) << 8) | ToBCD(timecode.GetUnitFrames());
+}
+
+Timecode TimecodeBCD::Unpack(uint32_t word, Framerate framerate, WrapMode wrapMode)
+{
+    Timecode timecode;
+    ThrowForStatus(Decode(word, framerate, timecode, wrapMode));
+    return timecode;
+}
+
+TimecodeBCD::Status TimecodeBCD::Decode(uint32_t word,
+                                        Framerate framerate,
+                                        Timecode& timecode,
+                                        WrapMode wrapMode)
+{
+    Fields fields;
+    const Status status = DecodeFields(word, framerate, fields);
+    if (status == Status::OK)
+    {
+        // all values are validated, so this constructor won't throw
+        timecode = Timecode(
+            framerate, fields.hours, fields.minutes, fields.seconds, fields.frames, wrapMode);
+    }
+    return status;
+}
+
+void TimecodeBCD::Pack(const Timecode* timecodes, size_t count, uint32_t* words, uint32_t flags)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        words[i] = Pack(timecodes[i], flags);
+    }
+}
+
+void TimecodeBCD::PackFrames(const int32_t* frames,
+                             size_t count,
+                             Framerate framerate,
+                             uint32_t* words,
+                             uint32_t flags)
+{
+    if (!IsSupported(framerate))
+    {
+        throw UnsupportedFramerate();
+    }
+    for (size_t i = 0; i < count; i++)
+    {
+        words[i] = Pack(Timecode(framerate, Frames(frames[i])), flags);
+    }
+}
+
+size_t TimecodeBCD::Decode(const uint32_t* words,
+                           size_t count,
+                           Framerate framerate,
+                           Timecode* timecodes,
+                           Status* status)
+{
+    size_t decoded = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        const Status s = Decode(words[i], framerate, timecodes[i]);
+        if (status)
+        {
+            status[i] = s;
+        }
+        if (s == Status::OK)
+        {
+            decoded++;
+        }
+    }
+    return decoded;
+}
+
+size_t TimecodeBCD::DecodeFrames(const uint32_t* words,
+                                 size_t count,
+                                 Framerate framerate,
+                                 int32_t* frames)
+{
+    size_t decoded = 0;
+    size_t i       = 0;
+    if (!IsSupported(framerate))
+    {
+        for (; i < count; i++)
+        {
+            frames[i] = -1;
+        }
+        return 0;
+    }
+#ifdef DOLBY_TCUTILS_BCD_SSE2
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i in  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(words + i));
+        const __m128i out = DecodeFramesSSE2(in, framerate);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(frames + i), out);
+        const int invalidMask =
+            _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(out, _mm_set1_epi32(-1))));
+        decoded += 4 - static_cast<size_t>((invalidMask & 1) + ((invalidMask >> 1) & 1) +
+                                           ((invalidMask >> 2) & 1) + ((invalidMask >> 3) & 1));
+    }
+#endif
+    for (; i < count; i++)
+    {
+        frames[i] = DecodeFramesScalar(words[i], framerate);
+        if (frames[i] != -1)
+        {
+            decoded++;
+        }
+    }
+    return decoded;
+}
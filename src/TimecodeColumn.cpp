@@ -0,0 +1,242 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <tcutils/AbsoluteFrames.h>
+#include <tcutils/TimecodeColumn.h>
+
+#include "RationalHelpers.h"
+#include "TimecodeHelpers.h"
+
+using namespace Dolby::TcUtils;
+
+TimecodeColumn::TimecodeColumn(Framerate framerate, WrapMode wrapMode)
+: mFramerate(framerate)
+, mWrapMode(wrapMode)
+{
+}
+
+TimecodeColumn::TimecodeColumn(Framerate framerate, std::vector<int32_t> frames, WrapMode wrapMode)
+: mFramerate(framerate)
+, mWrapMode(wrapMode)
+, mFrames(std::move(frames))
+{
+    Validate();
+}
+
+TimecodeColumn::TimecodeColumn(const Timecode* timecodes, size_t count)
+: mFramerate(count > 0 ? timecodes[0].GetFramerate() : Framerate())
+, mWrapMode(count > 0 ? timecodes[0].GetWrapMode() : WrapMode::DEFAULT)
+{
+    mFrames.reserve(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        mFrames.push_back(ToKey(timecodes[i]));
+    }
+}
+
+TimecodeColumn TimecodeColumn::View(Framerate framerate,
+                                    int32_t* frames,
+                                    size_t count,
+                                    WrapMode wrapMode)
+{
+    TimecodeColumn column(framerate, wrapMode);
+    column.mIsView   = true;
+    column.mView     = frames;
+    column.mViewSize = count;
+    column.Validate();
+    return column;
+}
+
+int32_t TimecodeColumn::ToKey(const Timecode& timecode) const
+{
+    requireMatchingFramerates(mFramerate, timecode.GetFramerate());
+    // e.g. a CONTINUE timecode after midnight, which a WRAP_AT_MIDNIGHT column can't hold
+    const int64_t frames = requireSetFrames(timecode);
+    if (frames >= frameLimit(mFramerate, mWrapMode))
+    {
+        throw Timecode::ValueOutOfRange();
+    }
+    return static_cast<int32_t>(frames);
+}
+
+void TimecodeColumn::Validate() const
+{
+    const int32_t* frames = data();
+    const size_t count    = size();
+    if (count == 0)
+    {
+        return;
+    }
+    const auto minmax = std::minmax_element(frames, frames + count);
+    if (*minmax.first < 0 || *minmax.second >= frameLimit(mFramerate, mWrapMode))
+    {
+        throw Timecode::ValueOutOfRange();
+    }
+}
+
+Timecode TimecodeColumn::operator[](size_t i) const
+{
+    return Timecode(mFramerate, Frames(data()[i]), mWrapMode);
+}
+
+void TimecodeColumn::Set(size_t i, const Timecode& timecode)
+{
+    MutableData()[i] = ToKey(timecode);
+}
+
+void TimecodeColumn::PushBack(const Timecode& timecode)
+{
+    if (IsView())
+    {
+        throw std::logic_error("Operation requires a column that owns its frames");
+    }
+    mFrames.push_back(ToKey(timecode));
+}
+
+void TimecodeColumn::Offset(const TimecodeDuration& offset)
+{
+    requireMatchingFramerates(mFramerate, offset.GetFramerate());
+    int32_t* frames    = MutableData();
+    const size_t count = size();
+    if (count == 0)
+    {
+        return;
+    }
+    const int64_t limit = frameLimit(mFramerate, mWrapMode);
+    if (mWrapMode == WrapMode::WRAP_AT_MIDNIGHT)
+    {
+        // with the offset in [0, limit), every sum is below 2 * limit, which fits in 32 bits
+        const auto add  = static_cast<int32_t>(floorMod(offset.GetValue(), limit));
+        const auto wrap = static_cast<int32_t>(limit);
+        for (size_t i = 0; i < count; i++)
+        {
+            const int32_t sum = frames[i] + add;
+            frames[i]         = sum >= wrap ? sum - wrap : sum;
+        }
+        return;
+    }
+    const auto minmax = std::minmax_element(frames, frames + count);
+    if (*minmax.first + offset.GetValue() < 0 || *minmax.second + offset.GetValue() >= limit)
+    {
+        throw Timecode::ValueOutOfRange();
+    }
+    const auto add = static_cast<int32_t>(offset.GetValue());
+    for (size_t i = 0; i < count; i++)
+    {
+        frames[i] += add;
+    }
+}
+
+void TimecodeColumn::Compare(const Timecode& timecode, int8_t* results) const
+{
+    const int32_t key     = ToKey(timecode);
+    const int32_t* frames = data();
+    const size_t count    = size();
+    for (size_t i = 0; i < count; i++)
+    {
+        results[i] = static_cast<int8_t>((frames[i] > key) - (frames[i] < key));
+    }
+}
+
+void TimecodeColumn::Compare(const TimecodeColumn& other, int8_t* results) const
+{
+    requireMatchingFramerates(mFramerate, other.mFramerate);
+    if (size() != other.size())
+    {
+        throw std::logic_error("Operation requires columns of the same size");
+    }
+    const int32_t* frames      = data();
+    const int32_t* otherFrames = other.data();
+    const size_t count         = size();
+    for (size_t i = 0; i < count; i++)
+    {
+        results[i] =
+            static_cast<int8_t>((frames[i] > otherFrames[i]) - (frames[i] < otherFrames[i]));
+    }
+}
+
+void TimecodeColumn::Filter(const Timecode& begin,
+                            const Timecode& end,
+                            std::vector<size_t>& indices) const
+{
+    const int32_t first   = ToKey(begin);
+    const int32_t limit   = ToKey(end);
+    const int32_t* frames = data();
+    const size_t count    = size();
+    indices.clear();
+    for (size_t i = 0; i < count; i++)
+    {
+        if (frames[i] >= first && frames[i] < limit)
+        {
+            indices.push_back(i);
+        }
+    }
+}
+
+void TimecodeColumn::ToSamples(Samplerate samplerate, int64_t* samples) const
+{
+    // the same computation as Timecode::ToSamples, with the factor hoisted out of the loop
+    const double samplesPerFrame =
+        samplerate.GetValue() / static_cast<double>(mFramerate.GetFrameCount());
+    const bool ratio      = mFramerate.IsRatio1001();
+    const int32_t* frames = data();
+    const size_t count    = size();
+    for (size_t i = 0; i < count; i++)
+    {
+        const double value = static_cast<double>(frames[i]) * samplesPerFrame;
+        samples[i] = static_cast<int64_t>(std::llround(ratio ? value * 1001.0 / 1000.0 : value));
+    }
+}
+
+void TimecodeColumn::ToSeconds(double* seconds) const
+{
+    // the same computation as Timecode::ToSeconds, with the factor hoisted out of the loop
+    const auto frameCount = static_cast<double>(mFramerate.GetFrameCount());
+    const bool ratio      = mFramerate.IsRatio1001();
+    const int32_t* frames = data();
+    const size_t count    = size();
+    for (size_t i = 0; i < count; i++)
+    {
+        const double value = static_cast<double>(frames[i]) / frameCount;
+        seconds[i]         = ratio ? value * 1001.0 / 1000.0 : value;
+    }
+}
+
+void TimecodeColumn::ToStrings(std::vector<std::string>& strings) const
+{
+    const int32_t* frames = data();
+    const size_t count    = size();
+    strings.clear();
+    strings.reserve(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        strings.push_back(Timecode(mFramerate, Frames(frames[i]), mWrapMode).ToString());
+    }
+}
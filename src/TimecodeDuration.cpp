@@ -0,0 +1,295 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstdlib>
+#include <iostream>
+#include <tcutils/AbsoluteFrames.h>
+#include <tcutils/TimecodeDuration.h>
+
+#include "DropFrameHelpers.h"
+#include "RationalHelpers.h"
+#include "TimecodeHelpers.h"
+
+using namespace Dolby::TcUtils;
+
+namespace
+{
+    // there are 17982 frames in 10 minutes of drop-frame timecode, and 18000 timecode labels
+    const int64_t dropFramesPer10Minutes = 17982;
+    const int64_t labelsPer10Minutes     = 18000;
+
+    Framerate RequireDefined(Framerate framerate)
+    {
+        if (!framerate.IsDefined())
+        {
+            throw TimecodeDuration::UndefinedFramerate();
+        }
+        return framerate;
+    }
+
+    // The timecode label of a frame count, counting the drop-frames: the frame count as it would be
+    // without dropping frames.
+    int64_t ToLabel(Framerate framerate, int64_t frames)
+    {
+        if (!framerate.IsDrop())
+        {
+            return frames;
+        }
+        const int64_t blocks = frames / dropFramesPer10Minutes;
+        const auto remainder = static_cast<int32_t>(frames % dropFramesPer10Minutes);
+        return blocks * labelsPer10Minutes + remainder + dropFramesToAddForFrames(remainder);
+    }
+
+    int64_t ParseDigits(const char*& str, int minDigits, int maxDigits, char term)
+    {
+        int64_t value = 0;
+        int digits    = 0;
+        while (*str >= '0' && *str <= '9' && digits < maxDigits)
+        {
+            value = value * 10 + (*str++ - '0');
+            digits++;
+        }
+        if (digits < minDigits || *str != term)
+        {
+            throw Timecode::StringParseError();
+        }
+        if (term != '\0')
+        {
+            str++;
+        }
+        return value;
+    }
+
+    int64_t Parse(Framerate framerate, const char* str)
+    {
+        RequireDefined(framerate);
+        const bool negative = *str == '-';
+        if (negative)
+        {
+            str++;
+        }
+        const int frameCount  = framerate.GetFrameCount();
+        const int frameDigits = frameCount > 100 ? 3 : 2;
+        const int64_t hours   = ParseDigits(str, 2, 12, ':');
+        const int64_t mins    = ParseDigits(str, 2, 2, ':');
+        const int64_t secs    = ParseDigits(str, 2, 2, framerate.IsDrop() ? ';' : ':');
+        const int64_t frames  = ParseDigits(str, frameDigits, frameDigits, '\0');
+        if (mins >= 60 || secs >= 60 || frames >= frameCount)
+        {
+            throw Timecode::ValueOutOfRange();
+        }
+        const int64_t totalMinutes = hours * 60 + mins;
+        int64_t value              = (totalMinutes * 60 + secs) * frameCount + frames;
+        if (framerate.IsDrop())
+        {
+            if (secs == 0 && frames < 2 && mins % 10 != 0)
+            {
+                throw Timecode::InvalidDropFrame();
+            }
+            value -= 2 * (totalMinutes - totalMinutes / 10);
+        }
+        return negative ? -value : value;
+    }
+}
+
+TimecodeDuration::TimecodeDuration(Framerate framerate, int64_t frames)
+: mFramerate(RequireDefined(framerate))
+, mValue(frames)
+{
+}
+
+TimecodeDuration::TimecodeDuration(Framerate framerate, const char* str)
+: mFramerate(framerate)
+, mValue(Parse(framerate, str))
+{
+}
+
+TimecodeDuration::TimecodeDuration(Framerate framerate, const std::string& str)
+: TimecodeDuration(framerate, str.c_str())
+{
+}
+
+TimecodeDuration TimecodeDuration::Between(const Timecode& from, const Timecode& to)
+{
+    const Framerate framerate = from.GetFramerate();
+    requireMatchingFramerates(framerate, to.GetFramerate());
+    const int64_t frames = requireSetFrames(to) - requireSetFrames(from);
+    return TimecodeDuration(framerate, floorMod(frames, AbsoluteFrames::FramesPerDay(framerate)));
+}
+
+int64_t TimecodeDuration::GetUnitHours() const
+{
+    return ToLabel(mFramerate, std::abs(mValue)) / (int64_t(3600) * mFramerate.GetFrameCount());
+}
+
+int TimecodeDuration::GetUnitMinutes() const
+{
+    const int64_t label = ToLabel(mFramerate, std::abs(mValue));
+    return static_cast<int>(label / (60 * mFramerate.GetFrameCount()) % 60);
+}
+
+int TimecodeDuration::GetUnitSeconds() const
+{
+    const int64_t label = ToLabel(mFramerate, std::abs(mValue));
+    return static_cast<int>(label / mFramerate.GetFrameCount() % 60);
+}
+
+int TimecodeDuration::GetUnitFrames() const
+{
+    return static_cast<int>(ToLabel(mFramerate, std::abs(mValue)) % mFramerate.GetFrameCount());
+}
+
+std::string TimecodeDuration::ToString() const
+{
+    const int frameCount = mFramerate.GetFrameCount();
+    const int64_t label  = ToLabel(mFramerate, std::abs(mValue));
+    const int64_t secs   = label / frameCount;
+
+    // sign, hours up to 19 digits, 3 separators, 2 + 2 + 3 digits, and the terminating null char
+    char str[32];
+    char* p = str;
+    if (mValue < 0)
+    {
+        *p++ = '-';
+    }
+    char hours[20];
+    int digits    = 0;
+    int64_t value = secs / 3600;
+    do
+    {
+        hours[digits++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    if (digits < 2)
+    {
+        hours[digits++] = '0';
+    }
+    while (digits > 0)
+    {
+        *p++ = hours[--digits];
+    }
+
+    const auto mins    = static_cast<int>(secs / 60 % 60);
+    const auto seconds = static_cast<int>(secs % 60);
+    const auto frames  = static_cast<int>(label % frameCount);
+
+    *p++ = ':';
+    *p++ = static_cast<char>('0' + mins / 10);
+    *p++ = static_cast<char>('0' + mins % 10);
+    *p++ = ':';
+    *p++ = static_cast<char>('0' + seconds / 10);
+    *p++ = static_cast<char>('0' + seconds % 10);
+    *p++ = mFramerate.IsDrop() ? ';' : ':';
+    if (frameCount > 100)
+    {
+        *p++ = static_cast<char>('0' + frames / 100);
+    }
+    *p++ = static_cast<char>('0' + (frames / 10) % 10);
+    *p++ = static_cast<char>('0' + frames % 10);
+    *p   = 0;
+    return {str};
+}
+
+TimecodeDuration& TimecodeDuration::operator+=(const TimecodeDuration& other)
+{
+    RequireMatchingFramerate(other);
+
+    mValue += other.mValue;
+    return *this;
+}
+
+TimecodeDuration& TimecodeDuration::operator-=(const TimecodeDuration& other)
+{
+    RequireMatchingFramerate(other);
+
+    mValue -= other.mValue;
+    return *this;
+}
+
+bool TimecodeDuration::operator<(const TimecodeDuration& other) const
+{
+    RequireMatchingFramerate(other);
+
+    return mValue < other.mValue;
+}
+
+bool TimecodeDuration::operator>(const TimecodeDuration& other) const
+{
+    RequireMatchingFramerate(other);
+
+    return mValue > other.mValue;
+}
+
+bool TimecodeDuration::operator<=(const TimecodeDuration& other) const
+{
+    RequireMatchingFramerate(other);
+
+    return mValue <= other.mValue;
+}
+
+bool TimecodeDuration::operator>=(const TimecodeDuration& other) const
+{
+    RequireMatchingFramerate(other);
+
+    return mValue >= other.mValue;
+}
+
+void TimecodeDuration::RequireMatchingFramerate(const TimecodeDuration& other) const
+{
+    requireMatchingFramerates(mFramerate, other.mFramerate);
+}
+
+namespace Dolby
+{
+    namespace TcUtils
+    {
+        TimecodeDuration operator-(const Timecode& a, const Timecode& b)
+        {
+            requireMatchingFramerates(a.GetFramerate(), b.GetFramerate());
+            return TimecodeDuration(a.GetFramerate(), requireSetFrames(a) - requireSetFrames(b));
+        }
+
+        Timecode operator+(const Timecode& timecode, const TimecodeDuration& duration)
+        {
+            requireMatchingFramerates(timecode.GetFramerate(), duration.GetFramerate());
+            return timecodeOfFrames(timecode.GetFramerate(),
+                                    requireSetFrames(timecode) + duration.GetValue(),
+                                    timecode.GetWrapMode());
+        }
+
+        Timecode operator-(const Timecode& timecode, const TimecodeDuration& duration)
+        {
+            return timecode + -duration;
+        }
+
+        std::ostream& operator<<(std::ostream& os, const TimecodeDuration& duration)
+        {
+            os << duration.ToString();
+            return os;
+        }
+    }
+}
@@ -0,0 +1,257 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <utility>
+#include <tcutils/TimecodeExternalSort.h>
+
+#include "MappedFile.h"
+#include "RationalHelpers.h"
+
+using namespace Dolby::TcUtils;
+
+namespace
+{
+    // A run is a sequence of records: the frame count (Timecode::ToFrames) as int32_t, the frame
+    // count of the framerate as uint16_t, the flags as uint8_t, a reserved uint8_t, the size of
+    // the data as uint32_t and the data, in the byte order of the machine
+    const size_t headerSize = 12;
+
+    enum Flags : uint8_t
+    {
+        RATIO_1001 = 1,
+        DROP       = 2,
+        CONTINUE   = 4
+    };
+
+    struct Key
+    {
+        // the start time of the frame is time / rate seconds
+        int64_t time;
+        int64_t rate;
+        size_t index;
+
+        bool operator<(const Key& other) const
+        {
+            const int64_t a = time * other.rate;
+            const int64_t b = other.time * rate;
+            return a != b ? a < b : index < other.index;
+        }
+    };
+}
+
+class TimecodeExternalSort::Run : public TimecodeEventSource
+{
+public:
+    explicit Run(const std::string& path)
+    {
+        if (!mFile.Open(path))
+        {
+            throw FileError();
+        }
+    }
+
+    bool Next(TimecodeEvent& event) override
+    {
+        if (mOffset + headerSize > mFile.size())
+        {
+            return false;
+        }
+        const char* record = mFile.data() + mOffset;
+        int32_t frames;
+        uint16_t frameCount;
+        uint32_t size;
+        std::memcpy(&frames, record, sizeof(frames));
+        std::memcpy(&frameCount, record + 4, sizeof(frameCount));
+        const uint8_t flags = static_cast<uint8_t>(record[6]);
+        std::memcpy(&size, record + 8, sizeof(size));
+        if (mOffset + headerSize + size > mFile.size())
+        {
+            throw FileError();
+        }
+        if (frameCount != mFrameCount || flags != mFlags)
+        {
+            const bool ratio = (flags & RATIO_1001) != 0;
+            const Rational rate(ratio ? frameCount * 1000 : frameCount, ratio ? 1001 : 1);
+            mFramerate       = Framerate(rate, (flags & DROP) != 0);
+            mFrameCount      = frameCount;
+            mFlags           = flags;
+        }
+        event.timecode = Timecode(mFramerate,
+                                  Frames(frames),
+                                  (flags & CONTINUE) != 0 ? WrapMode::CONTINUE
+                                                          : WrapMode::WRAP_AT_MIDNIGHT);
+        event.data.assign(record + headerSize, size);
+        mOffset += headerSize + size;
+        return true;
+    }
+
+private:
+    MappedFile mFile;
+    size_t mOffset{0};
+    // the framerate of the last record
+    Framerate mFramerate;
+    uint16_t mFrameCount{0};
+    uint8_t mFlags{0};
+};
+
+TimecodeExternalSort::TimecodeExternalSort(const std::string& directory, size_t memoryLimit)
+: mDirectory(directory)
+, mMemoryLimit(memoryLimit)
+{
+    // a random name for the runs, so that sorts can share a directory
+    std::random_device random;
+    std::ostringstream prefix;
+    prefix << directory << "/tcutils-sort-" << std::hex << random() << random() << "-";
+    mPrefix = prefix.str();
+}
+
+TimecodeExternalSort::~TimecodeExternalSort()
+{
+    mMerger.reset();
+    mRuns.clear();
+    for (const std::string& path : mPaths)
+    {
+        std::remove(path.c_str());
+    }
+}
+
+void TimecodeExternalSort::Add(TimecodeEvent event)
+{
+    if (mReading)
+    {
+        throw std::logic_error("Operation requires a sort that is not being read");
+    }
+    if (!event.timecode.IsSet())
+    {
+        throw Timecode::ValueOutOfRange();
+    }
+    mBufferSize += sizeof(TimecodeEvent) + event.data.size();
+    mBuffer.push_back(std::move(event));
+    if (mBufferSize >= mMemoryLimit)
+    {
+        WriteRun();
+    }
+}
+
+void TimecodeExternalSort::SortBuffer()
+{
+    std::vector<Key> keys;
+    keys.reserve(mBuffer.size());
+    for (size_t i = 0; i < mBuffer.size(); i++)
+    {
+        const Timecode& timecode = mBuffer[i].timecode;
+        const Framerate framerate = timecode.GetFramerate();
+        keys.push_back(Key{timecode.ToFrames().GetValue() * rateDenominator(framerate),
+                           rateNumerator(framerate),
+                           i});
+    }
+    std::sort(keys.begin(), keys.end());
+    std::vector<TimecodeEvent> sorted;
+    sorted.reserve(mBuffer.size());
+    for (const Key& key : keys)
+    {
+        sorted.push_back(std::move(mBuffer[key.index]));
+    }
+    mBuffer.swap(sorted);
+}
+
+void TimecodeExternalSort::WriteRun()
+{
+    SortBuffer();
+    std::ostringstream path;
+    path << mPrefix << mPaths.size() << ".run";
+    mPaths.push_back(path.str());
+    std::ofstream file(mPaths.back(), std::ios::binary | std::ios::trunc);
+    std::string record;
+    for (const TimecodeEvent& event : mBuffer)
+    {
+        const Framerate framerate = event.timecode.GetFramerate();
+        const int32_t frames      = event.timecode.ToFrames().GetValue();
+        const auto frameCount     = static_cast<uint16_t>(framerate.GetFrameCount());
+        const auto flags          = static_cast<uint8_t>(
+            (framerate.IsRatio1001() ? RATIO_1001 : 0) | (framerate.IsDrop() ? DROP : 0) |
+            (event.timecode.GetWrapMode() == WrapMode::CONTINUE ? CONTINUE : 0));
+        const auto size           = static_cast<uint32_t>(event.data.size());
+        record.assign(headerSize, '\0');
+        std::memcpy(&record[0], &frames, sizeof(frames));
+        std::memcpy(&record[4], &frameCount, sizeof(frameCount));
+        record[6] = static_cast<char>(flags);
+        std::memcpy(&record[8], &size, sizeof(size));
+        record += event.data;
+        file.write(record.data(), static_cast<std::streamsize>(record.size()));
+    }
+    file.close();
+    if (!file)
+    {
+        throw FileError();
+    }
+    mBuffer.clear();
+    mBufferSize = 0;
+}
+
+bool TimecodeExternalSort::Next(TimecodeEvent& event)
+{
+    if (!mReading)
+    {
+        mReading = true;
+        if (mPaths.empty())
+        {
+            SortBuffer();
+        }
+        else
+        {
+            if (!mBuffer.empty())
+            {
+                WriteRun();
+            }
+            std::vector<TimecodeEventSource*> sources;
+            for (const std::string& path : mPaths)
+            {
+                mRuns.push_back(std::unique_ptr<Run>(new Run(path)));
+                sources.push_back(mRuns.back().get());
+            }
+            mMerger.reset(new TimecodeMerger(sources));
+        }
+    }
+    if (mMerger)
+    {
+        return mMerger->Next(event);
+    }
+    if (mNext == mBuffer.size())
+    {
+        return false;
+    }
+    event = std::move(mBuffer[mNext++]);
+    return true;
+}
@@ -0,0 +1,88 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef DOLBY_TCUTILS_TIMECODEHELPERS_H
+#define DOLBY_TCUTILS_TIMECODEHELPERS_H
+
+#include <cstdint>
+#include <stdexcept>
+#include <tcutils/AbsoluteFrames.h>
+#include <tcutils/Timecode.h>
+
+#include "RationalHelpers.h"
+
+namespace
+{
+    inline void requireMatchingFramerates(const Dolby::TcUtils::Framerate a,
+                                          const Dolby::TcUtils::Framerate b)
+    {
+        if (a != b)
+        {
+            throw std::logic_error("Operation requires matching framerates");
+        }
+    }
+
+    // The frame count of a timecode, which must be set
+    inline int64_t requireSetFrames(const Dolby::TcUtils::Timecode& timecode)
+    {
+        if (!timecode.IsSet())
+        {
+            throw Dolby::TcUtils::Timecode::ValueOutOfRange();
+        }
+        return timecode.ToFrames().GetValue();
+    }
+
+    // The number of frame counts a timecode can hold: a day when wrapping at midnight, or up to
+    // 100:00:00:00 when continuing past midnight
+    inline int64_t frameLimit(const Dolby::TcUtils::Framerate framerate,
+                              const Dolby::TcUtils::WrapMode wrapMode)
+    {
+        using namespace Dolby::TcUtils;
+        const int64_t framesPerDay = AbsoluteFrames::FramesPerDay(framerate);
+        return wrapMode == WrapMode::WRAP_AT_MIDNIGHT ? framesPerDay : framesPerDay / 24 * 100;
+    }
+
+    // The timecode of a frame count, wrapped at midnight or checked against frameLimit
+    inline Dolby::TcUtils::Timecode timecodeOfFrames(const Dolby::TcUtils::Framerate framerate,
+                                                     int64_t frames,
+                                                     const Dolby::TcUtils::WrapMode wrapMode)
+    {
+        using namespace Dolby::TcUtils;
+        const int64_t limit = frameLimit(framerate, wrapMode);
+        if (wrapMode == WrapMode::WRAP_AT_MIDNIGHT)
+        {
+            frames = floorMod(frames, limit);
+        }
+        else if (frames < 0 || frames >= limit)
+        {
+            throw Timecode::ValueOutOfRange();
+        }
+        return Timecode(framerate, Frames(static_cast<int32_t>(frames)), wrapMode);
+    }
+}
+
+#endif
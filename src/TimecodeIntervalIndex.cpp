@@ -0,0 +1,240 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <tcutils/TimecodeIntervalIndex.h>
+
+#include "ThreadHelpers.h"
+#include "TimecodeHelpers.h"
+
+using namespace Dolby::TcUtils;
+
+namespace
+{
+    // Visitors for the query results
+    struct Collect
+    {
+        std::vector<size_t>& indices;
+
+        void operator()(size_t index)
+        {
+            indices.push_back(index);
+        }
+    };
+
+    struct Count
+    {
+        size_t count;
+
+        void operator()(size_t)
+        {
+            count++;
+        }
+    };
+}
+
+TimecodeIntervalIndex::TimecodeIntervalIndex(const Timecode* in,
+                                             const Timecode* out,
+                                             size_t count,
+                                             unsigned threads)
+: mFramerate(count > 0 ? in[0].GetFramerate() : Framerate())
+, mCount(count)
+, mRootLevel(-1)
+{
+    mNodes.reserve(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        Node node;
+        node.in     = ToKey(in[i]);
+        node.out    = ToKey(out[i]);
+        node.maxOut = node.out;
+        node.index  = i;
+        if (node.out < node.in)
+        {
+            throw InvalidInterval();
+        }
+        // empty intervals contain no frames and are never found
+        if (node.in < node.out)
+        {
+            mNodes.push_back(node);
+        }
+    }
+    parallelSort(mNodes.begin(),
+                 mNodes.end(),
+                 [](const Node& a, const Node& b)
+                 { return a.in < b.in || (a.in == b.in && a.index < b.index); },
+                 threadCount(mNodes.size(), threads));
+
+    // Compute the maximum out point of every subtree, bottom up. Nodes at level k are at the
+    // positions of which the lowest k bits are set and bit k is not; the root is at 2^K - 1 for the
+    // largest K with 2^K <= n. When n is not a power of 2 minus 1, the right child of a node may be
+    // missing, in which case the maximum of the last subtree is used.
+    const auto n    = static_cast<int64_t>(mNodes.size());
+    int64_t last    = 0;
+    int64_t lastMax = 0;
+    for (int64_t i = 0; i < n; i += 2)
+    {
+        mNodes[i].maxOut = mNodes[i].out;
+        last             = i;
+        lastMax          = mNodes[i].out;
+    }
+    int level = 1;
+    for (; (int64_t(1) << level) <= n; level++)
+    {
+        const int64_t x    = int64_t(1) << (level - 1);
+        const int64_t step = x << 2;
+        for (int64_t i = (x << 1) - 1; i < n; i += step)
+        {
+            const int64_t left  = mNodes[i - x].maxOut;
+            const int64_t right = i + x < n ? mNodes[i + x].maxOut : lastMax;
+            mNodes[i].maxOut    = std::max(mNodes[i].out, std::max(left, right));
+        }
+        last = (last >> level & 1) ? last - x : last + x;
+        if (last < n && mNodes[last].maxOut > lastMax)
+        {
+            lastMax = mNodes[last].maxOut;
+        }
+    }
+    mRootLevel = n > 0 ? level - 1 : -1;
+}
+
+int64_t TimecodeIntervalIndex::ToKey(const Timecode& timecode) const
+{
+    if (timecode.GetFramerate() != mFramerate)
+    {
+        throw std::logic_error("Operation requires timecodes with matching framerates");
+    }
+    return requireSetFrames(timecode);
+}
+
+template <class Visitor>
+void TimecodeIntervalIndex::Visit(int64_t begin, int64_t end, Visitor& visitor) const
+{
+    struct Item
+    {
+        int64_t x;  // position of the node
+        int level;  // level of the node
+        bool right; // whether the left subtree was visited
+    };
+
+    if (mRootLevel < 0 || end <= begin)
+    {
+        return;
+    }
+    const auto n = static_cast<int64_t>(mNodes.size());
+    // in-order traversal, skipping subtrees of which the maximum out point is not after begin, and
+    // right subtrees of nodes of which the in point is not before end
+    Item stack[64];
+    int top      = 0;
+    stack[top++] = {(int64_t(1) << mRootLevel) - 1, mRootLevel, false};
+    while (top > 0)
+    {
+        const Item item = stack[--top];
+        if (item.level <= 3)
+        {
+            // small subtree: scan its nodes in order
+            const int64_t first = item.x >> item.level << item.level;
+            const int64_t limit = std::min(first + (int64_t(1) << (item.level + 1)) - 1, n);
+            for (int64_t i = first; i < limit && mNodes[i].in < end; i++)
+            {
+                if (begin < mNodes[i].out)
+                {
+                    visitor(mNodes[i].index);
+                }
+            }
+        }
+        else if (!item.right)
+        {
+            // the left child may be past the end of the array, while its subtree isn't
+            const int64_t left = item.x - (int64_t(1) << (item.level - 1));
+            stack[top++]       = {item.x, item.level, true};
+            if (left >= n || mNodes[left].maxOut > begin)
+            {
+                stack[top++] = {left, item.level - 1, false};
+            }
+        }
+        else if (item.x < n && mNodes[item.x].in < end)
+        {
+            if (begin < mNodes[item.x].out)
+            {
+                visitor(mNodes[item.x].index);
+            }
+            stack[top++] = {item.x + (int64_t(1) << (item.level - 1)), item.level - 1, false};
+        }
+    }
+}
+
+void TimecodeIntervalIndex::FindOverlapping(const Timecode& timecode,
+                                            std::vector<size_t>& indices) const
+{
+    if (mCount == 0)
+    {
+        return;
+    }
+    const int64_t frame = ToKey(timecode);
+    Collect collect{indices};
+    Visit(frame, frame + 1, collect);
+}
+
+void TimecodeIntervalIndex::FindOverlapping(const Timecode& begin,
+                                            const Timecode& end,
+                                            std::vector<size_t>& indices) const
+{
+    if (mCount == 0)
+    {
+        return;
+    }
+    Collect collect{indices};
+    Visit(ToKey(begin), ToKey(end), collect);
+}
+
+void TimecodeIntervalIndex::FindOverlapping(const Timecode* timecodes,
+                                            size_t count,
+                                            std::vector<size_t>& offsets,
+                                            std::vector<size_t>& indices) const
+{
+    offsets.clear();
+    indices.clear();
+    offsets.reserve(count + 1);
+    offsets.push_back(0);
+    for (size_t i = 0; i < count; i++)
+    {
+        FindOverlapping(timecodes[i], indices);
+        offsets.push_back(indices.size());
+    }
+}
+
+size_t TimecodeIntervalIndex::CountOverlapping(const Timecode& begin, const Timecode& end) const
+{
+    if (mCount == 0)
+    {
+        return 0;
+    }
+    Count count{0};
+    Visit(ToKey(begin), ToKey(end), count);
+    return count.count;
+}
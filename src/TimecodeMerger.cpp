@@ -0,0 +1,117 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <utility>
+#include <tcutils/TimecodeMerger.h>
+
+#include "RationalHelpers.h"
+
+using namespace Dolby::TcUtils;
+
+TimecodeMerger::TimecodeMerger(const std::vector<TimecodeEventSource*>& sources)
+: mSources(sources)
+, mHeads(sources.size())
+, mTree(sources.size(), sources.size())
+, mSource(0)
+{
+    // initially every match is won by the sentinel index k, that beats all streams; replaying
+    // the streams from the last to the first fills the tree with the losers of all matches
+    for (size_t source = mSources.size(); source-- > 0;)
+    {
+        Read(source);
+        Replay(source);
+    }
+}
+
+void TimecodeMerger::Read(size_t source)
+{
+    Head& head = mHeads[source];
+    head.ended = !mSources[source]->Next(head.event);
+    if (head.ended)
+    {
+        return;
+    }
+    const Timecode& timecode = head.event.timecode;
+    if (!timecode.IsSet())
+    {
+        throw Timecode::ValueOutOfRange();
+    }
+    head.time = timecode.ToFrames().GetValue() * rateDenominator(timecode.GetFramerate());
+    head.rate = rateNumerator(timecode.GetFramerate());
+}
+
+bool TimecodeMerger::Less(size_t a, size_t b) const
+{
+    const size_t sentinel = mSources.size();
+    if (a == sentinel || b == sentinel)
+    {
+        return a == sentinel && b != sentinel;
+    }
+    const Head& headA = mHeads[a];
+    const Head& headB = mHeads[b];
+    if (headA.ended || headB.ended)
+    {
+        return !headA.ended || (headB.ended && a < b);
+    }
+    // compare headA.time / headA.rate with headB.time / headB.rate; the products fit in 64 bits
+    const int64_t timeA = headA.time * headB.rate;
+    const int64_t timeB = headB.time * headA.rate;
+    return timeA != timeB ? timeA < timeB : a < b;
+}
+
+void TimecodeMerger::Replay(size_t source)
+{
+    // play the matches from the leaf of the stream up to the root, keeping the losers
+    const size_t count = mSources.size();
+    size_t winner      = source;
+    for (size_t node = (source + count) / 2; node > 0; node /= 2)
+    {
+        if (Less(mTree[node], winner))
+        {
+            std::swap(mTree[node], winner);
+        }
+    }
+    mTree[0] = winner;
+}
+
+bool TimecodeMerger::Next(TimecodeEvent& event)
+{
+    if (mSources.empty())
+    {
+        return false;
+    }
+    const size_t winner = mTree[0];
+    if (mHeads[winner].ended)
+    {
+        return false;
+    }
+    event   = std::move(mHeads[winner].event);
+    mSource = winner;
+    Read(winner);
+    Replay(winner);
+    return true;
+}
@@ -0,0 +1,102 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <tcutils/AbsoluteFrames.h>
+#include <tcutils/TimecodeRange.h>
+
+#include "RationalHelpers.h"
+#include "TimecodeHelpers.h"
+
+using namespace Dolby::TcUtils;
+
+namespace
+{
+    // The number of frames from begin to end, continuing past midnight when begin wraps
+    int64_t RangeSize(const Timecode& begin, const Timecode& end)
+    {
+        requireMatchingFramerates(begin.GetFramerate(), end.GetFramerate());
+        const int64_t size = requireSetFrames(end) - requireSetFrames(begin);
+        if (begin.GetWrapMode() == WrapMode::WRAP_AT_MIDNIGHT)
+        {
+            return floorMod(size, AbsoluteFrames::FramesPerDay(begin.GetFramerate()));
+        }
+        if (size < 0)
+        {
+            throw TimecodeRange::InvalidRange();
+        }
+        return size;
+    }
+
+    int64_t RangeSize(const Timecode& begin, const TimecodeDuration& length)
+    {
+        requireMatchingFramerates(begin.GetFramerate(), length.GetFramerate());
+        requireSetFrames(begin);
+        if (length.GetValue() < 0)
+        {
+            throw TimecodeRange::InvalidRange();
+        }
+        if (begin.GetWrapMode() != WrapMode::WRAP_AT_MIDNIGHT && length.GetValue() > 0)
+        {
+            // throws when the last timecode of the range is out of range
+            static_cast<void>(begin + (length - TimecodeDuration(length.GetFramerate(), 1)));
+        }
+        return length.GetValue();
+    }
+}
+
+TimecodeRange::TimecodeRange(const Timecode& begin, const Timecode& end)
+: mBegin(begin.GetFramerate(),
+         begin.GetWrapMode(),
+         AbsoluteFrames::FramesPerDay(begin.GetFramerate()),
+         requireSetFrames(begin))
+, mSize(static_cast<size_t>(RangeSize(begin, end)))
+{
+}
+
+TimecodeRange::TimecodeRange(const Timecode& begin, const TimecodeDuration& length)
+: mBegin(begin.GetFramerate(),
+         begin.GetWrapMode(),
+         AbsoluteFrames::FramesPerDay(begin.GetFramerate()),
+         requireSetFrames(begin))
+, mSize(static_cast<size_t>(RangeSize(begin, length)))
+{
+}
+
+int64_t TimecodeRange::IndexOf(const Timecode& timecode) const
+{
+    requireMatchingFramerates(GetFramerate(), timecode.GetFramerate());
+    if (!timecode.IsSet())
+    {
+        return -1;
+    }
+    int64_t index = timecode.ToFrames().GetValue() - mBegin.mFrame;
+    if (mBegin.mWrapMode == WrapMode::WRAP_AT_MIDNIGHT)
+    {
+        index = floorMod(index, mBegin.mFramesPerDay);
+    }
+    return index >= 0 && index < static_cast<int64_t>(mSize) ? index : -1;
+}
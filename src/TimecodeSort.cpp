@@ -0,0 +1,317 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include <tcutils/TimecodeSort.h>
+
+#include "ThreadHelpers.h"
+
+using namespace Dolby::TcUtils;
+
+namespace
+{
+    const int digitBits      = 11;
+    const size_t bucketCount = size_t(1) << digitBits;
+
+    struct Entry
+    {
+        uint64_t key;
+        size_t index;
+    };
+
+    // 0 for a timecode that is not set, otherwise the frame label plus 1; ordered as operator<
+    uint64_t LabelKey(const Timecode& timecode)
+    {
+        if (!timecode.IsSet())
+        {
+            return 0;
+        }
+        const uint64_t hours   = static_cast<uint64_t>(timecode.GetUnitHours());
+        const uint64_t seconds = (hours * 60 + timecode.GetUnitMinutes()) * 60 +
+                                 timecode.GetUnitSeconds();
+        return seconds * timecode.GetFramerate().GetFrameCount() + timecode.GetUnitFrames() + 1;
+    }
+
+    // Sort the timecodes by the keys of the entries
+    template <class T>
+    void SortByKeys(T* timecodes, std::vector<Entry>& entries, uint64_t maxKey, unsigned threads)
+    {
+        const size_t count = entries.size();
+        const auto mask    = static_cast<uint64_t>(bucketCount - 1);
+        std::vector<Entry> buffer(count);
+        // a histogram per thread, turned into the positions to write the entries of each thread
+        std::vector<size_t> positions(threads * bucketCount);
+        for (int shift = 0; shift < 64 && (maxKey >> shift) != 0; shift += digitBits)
+        {
+            std::fill(positions.begin(), positions.end(), 0);
+            forEachBlock(count,
+                         threads,
+                         [&](unsigned block, size_t begin, size_t end)
+                         {
+                             size_t* histogram = &positions[block * bucketCount];
+                             for (size_t i = begin; i < end; i++)
+                             {
+                                 histogram[(entries[i].key >> shift) & mask]++;
+                             }
+                         });
+
+            // skip the pass when all keys have the same digit
+            bool sameDigit  = false;
+            size_t position = 0;
+            for (size_t digit = 0; digit < bucketCount && !sameDigit; digit++)
+            {
+                const size_t first = position;
+                for (unsigned block = 0; block < threads; block++)
+                {
+                    const size_t n                         = positions[block * bucketCount + digit];
+                    positions[block * bucketCount + digit] = position;
+                    position += n;
+                }
+                sameDigit = position - first == count;
+            }
+            if (sameDigit)
+            {
+                continue;
+            }
+
+            forEachBlock(count,
+                         threads,
+                         [&](unsigned block, size_t begin, size_t end)
+                         {
+                             size_t* next = &positions[block * bucketCount];
+                             for (size_t i = begin; i < end; i++)
+                             {
+                                 buffer[next[(entries[i].key >> shift) & mask]++] = entries[i];
+                             }
+                         });
+            entries.swap(buffer);
+        }
+
+        std::vector<T> sorted(count);
+        forEachBlock(count,
+                     threads,
+                     [&](unsigned, size_t begin, size_t end)
+                     {
+                         for (size_t i = begin; i < end; i++)
+                         {
+                             sorted[i] = timecodes[entries[i].index];
+                         }
+                     });
+        forEachBlock(count,
+                     threads,
+                     [&](unsigned, size_t begin, size_t end)
+                     {
+                         std::copy(sorted.begin() + begin, sorted.begin() + end, timecodes + begin);
+                     });
+    }
+
+    // Sort with the keys of a Keyer, which has bool Key(const T&, uint64_t& key) returning false
+    // for timecodes that can't be ordered with the first one, and the message to throw for them
+    template <class T, class Keyer>
+    void RadixSort(T* timecodes, size_t count, unsigned threads, const Keyer& keyer)
+    {
+        if (count < 2)
+        {
+            return;
+        }
+        threads = threadCount(count, threads);
+        std::vector<Entry> entries(count);
+        std::vector<uint64_t> maxKeys(threads, 0);
+        std::vector<char> valid(threads, 1);
+        forEachBlock(count,
+                     threads,
+                     [&](unsigned block, size_t begin, size_t end)
+                     {
+                         uint64_t maxKey = 0;
+                         for (size_t i = begin; i < end; i++)
+                         {
+                             if (!keyer.Key(timecodes[i], entries[i].key))
+                             {
+                                 valid[block] = 0;
+                                 return;
+                             }
+                             entries[i].index = i;
+                             maxKey           = std::max(maxKey, entries[i].key);
+                         }
+                         maxKeys[block] = maxKey;
+                     });
+        if (std::find(valid.begin(), valid.end(), 0) != valid.end())
+        {
+            throw std::logic_error(keyer.message);
+        }
+        SortByKeys(timecodes, entries, *std::max_element(maxKeys.begin(), maxKeys.end()), threads);
+    }
+
+    struct TimecodeKeyer
+    {
+        const char* message;
+        Framerate framerate;
+
+        bool Key(const Timecode& timecode, uint64_t& key) const
+        {
+            key = LabelKey(timecode);
+            return timecode.GetFramerate() == framerate;
+        }
+    };
+
+    struct SubframesKeyer
+    {
+        const char* message;
+        Framerate framerate;
+        int denominator;
+
+        bool Key(const TimecodeSubframes& timecode, uint64_t& key) const
+        {
+            const uint64_t label = LabelKey(timecode.GetTimecode());
+            key = label == 0 ? 0
+                             : label * static_cast<uint64_t>(denominator) +
+                                   static_cast<uint64_t>(timecode.GetSubframesNum());
+            return timecode.GetTimecode().GetFramerate() == framerate &&
+                   timecode.GetSubframesDenom() == denominator;
+        }
+    };
+
+    struct SamplesKeyer
+    {
+        const char* message;
+        Framerate framerate;
+        int64_t minRemainder;
+        int remainderBits;
+
+        // remainders are biased by the minimum, as they are negative at half-sample frame starts
+        bool Key(const TimecodeSamples& timecode, uint64_t& key) const
+        {
+            key = LabelKey(timecode.GetTimecode()) << remainderBits |
+                  (static_cast<uint64_t>(timecode.GetRemainder().GetValue()) -
+                   static_cast<uint64_t>(minRemainder));
+            return timecode.GetTimecode().GetFramerate() == framerate;
+        }
+    };
+
+    const char* const framerateMessage = "Operation requires timecodes with matching framerates";
+
+    void SortTimecodes(Timecode* timecodes, size_t count, unsigned threads)
+    {
+        if (count > 0)
+        {
+            const TimecodeKeyer keyer{framerateMessage, timecodes[0].GetFramerate()};
+            RadixSort(timecodes, count, threads, keyer);
+        }
+    }
+
+    void SortSubframes(TimecodeSubframes* timecodes, size_t count, unsigned threads)
+    {
+        if (count > 0)
+        {
+            const SubframesKeyer keyer{
+                "Operation requires timecodes with matching framerates and subframe denominators",
+                timecodes[0].GetTimecode().GetFramerate(),
+                timecodes[0].GetSubframesDenom()};
+            RadixSort(timecodes, count, threads, keyer);
+        }
+    }
+
+    void SortSamples(TimecodeSamples* timecodes, size_t count, unsigned threads)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+        int64_t minRemainder = timecodes[0].GetRemainder().GetValue();
+        int64_t maxRemainder = minRemainder;
+        for (size_t i = 1; i < count; i++)
+        {
+            minRemainder = std::min(minRemainder, timecodes[i].GetRemainder().GetValue());
+            maxRemainder = std::max(maxRemainder, timecodes[i].GetRemainder().GetValue());
+        }
+        const uint64_t remainderRange =
+            static_cast<uint64_t>(maxRemainder) - static_cast<uint64_t>(minRemainder);
+        int remainderBits = 0;
+        while (remainderBits < 64 && (remainderRange >> remainderBits) != 0)
+        {
+            remainderBits++;
+        }
+        // frame labels take at most 29 bits (99 hours at 999 frames per second), plus 1 for unset
+        const Framerate framerate = timecodes[0].GetTimecode().GetFramerate();
+        if (remainderBits <= 64 - 30)
+        {
+            const SamplesKeyer keyer{framerateMessage, framerate, minRemainder, remainderBits};
+            RadixSort(timecodes, count, threads, keyer);
+            return;
+        }
+        // remainders of more than a frame at any real samplerate
+        for (size_t i = 0; i < count; i++)
+        {
+            if (timecodes[i].GetTimecode().GetFramerate() != framerate)
+            {
+                throw std::logic_error(framerateMessage);
+            }
+        }
+        std::stable_sort(timecodes,
+                         timecodes + count,
+                         [](const TimecodeSamples& a, const TimecodeSamples& b)
+                         {
+                             const uint64_t labelA = LabelKey(a.GetTimecode());
+                             const uint64_t labelB = LabelKey(b.GetTimecode());
+                             return labelA < labelB ||
+                                    (labelA == labelB &&
+                                     a.GetRemainder().GetValue() < b.GetRemainder().GetValue());
+                         });
+    }
+}
+
+void TimecodeSort::Sort(Timecode* timecodes, size_t count)
+{
+    SortTimecodes(timecodes, count, 1);
+}
+
+void TimecodeSort::Sort(TimecodeSubframes* timecodes, size_t count)
+{
+    SortSubframes(timecodes, count, 1);
+}
+
+void TimecodeSort::Sort(TimecodeSamples* timecodes, size_t count)
+{
+    SortSamples(timecodes, count, 1);
+}
+
+void TimecodeSort::ParallelSort(Timecode* timecodes, size_t count, unsigned threads)
+{
+    SortTimecodes(timecodes, count, threads);
+}
+
+void TimecodeSort::ParallelSort(TimecodeSubframes* timecodes, size_t count, unsigned threads)
+{
+    SortSubframes(timecodes, count, threads);
+}
+
+void TimecodeSort::ParallelSort(TimecodeSamples* timecodes, size_t count, unsigned threads)
+{
+    SortSamples(timecodes, count, threads);
+}
@@ -60,6 +60,13 @@ namespace
         const int64_t samplesFloor =
             FrameBoundary::Floor(framerate, samples, samplerate).GetValue();
         const int64_t sampleOffset = samples.GetValue() - samplesFloor;
+        if (sampleOffset < 0)
+        {
+            // the frame starts halfway between this sample and the next (e.g. at 24 fps and
+            // 44.1 kHz), so the boundary rounds to the next sample, but this sample is in the
+            // frame by its center, at its start
+            return 0;
+        }
         const Samples nextSample(samples.GetValue() + 1);
         const int64_t samplesCeiling =
             FrameBoundary::Ceiling(framerate, nextSample, samplerate).GetValue();
@@ -0,0 +1,213 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <tcutils/AbsoluteFrames.h>
+#include <tcutils/VfrTimecodeMap.h>
+
+#include "RationalHelpers.h"
+#include "TimecodeHelpers.h"
+
+using namespace Dolby::TcUtils;
+
+namespace
+{
+    // the number of interpolation steps to try before falling back to bisection, when they fail
+    // to halve the search interval
+    const int maxSlowSteps = 2;
+}
+
+VfrTimecodeMap::VfrTimecodeMap(int64_t timebaseNumerator,
+                               int64_t timebaseDenominator,
+                               const Timecode& start)
+: mStart(start)
+, mNumerator(timebaseNumerator)
+, mDenominator(timebaseDenominator)
+{
+    if (timebaseNumerator <= 0 || timebaseDenominator <= 0 || !start.IsSet())
+    {
+        throw InvalidParameter();
+    }
+    mStartFrame   = start.ToFrames().GetValue();
+    mFramesPerDay = AbsoluteFrames::FramesPerDay(start.GetFramerate());
+}
+
+VfrTimecodeMap::VfrTimecodeMap(std::vector<int64_t> timestamps,
+                               int64_t timebaseNumerator,
+                               int64_t timebaseDenominator,
+                               const Timecode& start)
+: VfrTimecodeMap(timebaseNumerator, timebaseDenominator, start)
+{
+    mTimestamps = std::move(timestamps);
+    if (mTimestamps.empty())
+    {
+        throw InvalidParameter();
+    }
+    Validate();
+}
+
+VfrTimecodeMap VfrTimecodeMap::View(const int64_t* timestamps,
+                                    size_t count,
+                                    int64_t timebaseNumerator,
+                                    int64_t timebaseDenominator,
+                                    const Timecode& start)
+{
+    VfrTimecodeMap map(timebaseNumerator, timebaseDenominator, start);
+    map.mIsView   = true;
+    map.mView     = timestamps;
+    map.mViewSize = count;
+    if (count == 0)
+    {
+        throw InvalidParameter();
+    }
+    return map;
+}
+
+void VfrTimecodeMap::Validate() const
+{
+    const int64_t* timestamps = data();
+    const size_t count        = GetFrameCount();
+    if (std::adjacent_find(timestamps, timestamps + count, std::greater_equal<int64_t>()) !=
+        timestamps + count)
+    {
+        throw UnsortedTimestamps();
+    }
+}
+
+Timecode VfrTimecodeMap::TimecodeOf(int64_t frame) const
+{
+    return timecodeOfFrames(mStart.GetFramerate(), mStartFrame + frame, mStart.GetWrapMode());
+}
+
+Timecode VfrTimecodeMap::ToTimecode(size_t frame, RoundingMode roundingMode) const
+{
+    const int64_t time        = data()[frame] - data()[0];
+    const Framerate framerate = mStart.GetFramerate();
+    return TimecodeOf(roundingMode == RoundingMode::TRUNCATE
+                          ? frameForTime(time, mNumerator, mDenominator, framerate)
+                          : nearestFrameForTime(time, mNumerator, mDenominator, framerate));
+}
+
+void VfrTimecodeMap::ToTimecodes(Timecode* timecodes, RoundingMode roundingMode) const
+{
+    const size_t count = GetFrameCount();
+    for (size_t i = 0; i < count; i++)
+    {
+        timecodes[i] = ToTimecode(i, roundingMode);
+    }
+}
+
+int64_t VfrTimecodeMap::FindFrame(int64_t timestamp) const
+{
+    const int64_t* timestamps = data();
+    size_t low                = 0;
+    size_t high               = GetFrameCount() - 1;
+    if (timestamp < timestamps[low])
+    {
+        return -1;
+    }
+    if (timestamp >= timestamps[high])
+    {
+        return static_cast<int64_t>(high);
+    }
+    // interpolation search for the last timestamp not after the given one, with
+    // timestamps[low] <= timestamp < timestamps[high]; bisect when interpolation is slow
+    int slowSteps = 0;
+    while (high - low > 1)
+    {
+        const size_t size = high - low;
+        size_t middle;
+        if (slowSteps < maxSlowSteps)
+        {
+            const double fraction =
+                (static_cast<double>(timestamp) - static_cast<double>(timestamps[low])) /
+                (static_cast<double>(timestamps[high]) - static_cast<double>(timestamps[low]));
+            const auto offset = static_cast<size_t>(fraction * static_cast<double>(size));
+            middle            = low + std::min(std::max(offset, size_t(1)), size - 1);
+        }
+        else
+        {
+            middle = low + size / 2;
+        }
+        // views are not validated up front, so check the timestamps the search visits
+        if (timestamps[middle] <= timestamps[low] || timestamps[middle] >= timestamps[high])
+        {
+            throw UnsortedTimestamps();
+        }
+        if (timestamps[middle] <= timestamp)
+        {
+            low = middle;
+        }
+        else
+        {
+            high = middle;
+        }
+        slowSteps = high - low > size / 2 ? slowSteps + 1 : 0;
+    }
+    return static_cast<int64_t>(low);
+}
+
+int64_t VfrTimecodeMap::ToFrame(const Timecode& timecode, RoundingMode roundingMode) const
+{
+    const Framerate framerate = mStart.GetFramerate();
+    if (timecode.GetFramerate() != framerate)
+    {
+        throw std::logic_error("Operation requires timecodes with matching framerates");
+    }
+    if (!timecode.IsSet())
+    {
+        throw Timecode::ValueOutOfRange();
+    }
+    int64_t frame = timecode.ToFrames().GetValue() - mStartFrame;
+    if (mStart.GetWrapMode() == WrapMode::WRAP_AT_MIDNIGHT)
+    {
+        frame = floorMod(frame, mFramesPerDay);
+    }
+    // the frame starts at frame * a / b ticks after the first frame
+    const int64_t a           = mDenominator * rateDenominator(framerate);
+    const int64_t b           = mNumerator * rateNumerator(framerate);
+    const int64_t* timestamps = data();
+    const int64_t found       = FindFrame(timestamps[0] + mulDivFloor(frame, a, b));
+    if (roundingMode == RoundingMode::TRUNCATE)
+    {
+        return found;
+    }
+    if (found < 0)
+    {
+        return 0;
+    }
+    if (found + 1 == static_cast<int64_t>(GetFrameCount()))
+    {
+        return found;
+    }
+    // the next frame is nearer when its distance to the frame start is at most the distance of
+    // the found frame, i.e. when the sum of their times is at most twice the frame start
+    const int64_t sum = timestamps[found] - timestamps[0] + timestamps[found + 1] - timestamps[0];
+    return sum <= mulDivFloor(2 * frame, a, b) ? found + 1 : found;
+}
@@ -0,0 +1,726 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <tcutils/Convert.h>
+#include <tcutils/FrameBoundary.h>
+#include <tcutils/Framerate.h>
+#include <tcutils/Timecode.h>
+#include <tcutils/TimecodeSubframes.h>
+#include <tcutils/Version.h>
+#include <tcutils/tcutils_c.h>
+
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+using namespace Dolby::TcUtils;
+
+namespace
+{
+    constexpr int64_t maxFrames = std::numeric_limits<int32_t>::max();
+
+    // status of the exception being handled, to be called from a catch block
+    tcutils_status CurrentStatus()
+    {
+        try
+        {
+            throw;
+        }
+        catch (const Timecode::ValueOutOfRange&)
+        {
+            return TCUTILS_ERROR_OUT_OF_RANGE;
+        }
+        catch (const Timecode::NegativeValues&)
+        {
+            return TCUTILS_ERROR_OUT_OF_RANGE;
+        }
+        catch (const Timecode::InvalidDropFrame&)
+        {
+            return TCUTILS_ERROR_OUT_OF_RANGE;
+        }
+        catch (const Timecode::InvalidFormat&)
+        {
+            return TCUTILS_ERROR_PARSE;
+        }
+        catch (const Timecode::StringParseError&)
+        {
+            return TCUTILS_ERROR_PARSE;
+        }
+        catch (const Framerate::StringParseError&)
+        {
+            return TCUTILS_ERROR_PARSE;
+        }
+        catch (const Framerate::UnsupportedFramerate&)
+        {
+            return TCUTILS_ERROR_INVALID_ARGUMENT;
+        }
+        catch (const std::logic_error&)
+        {
+            return TCUTILS_ERROR_INVALID_ARGUMENT;
+        }
+        catch (...)
+        {
+            return TCUTILS_ERROR_INTERNAL;
+        }
+    }
+
+    tcutils_status ToFramerate(const tcutils_framerate& in, Framerate& framerate)
+    {
+        try
+        {
+            framerate = Framerate(Rational(in.numerator, in.denominator), in.drop != 0);
+            return TCUTILS_OK;
+        }
+        catch (...)
+        {
+            return CurrentStatus();
+        }
+    }
+
+    bool IsSamplerate(double samplerate)
+    {
+        return samplerate > 0.0 && samplerate <= std::numeric_limits<double>::max();
+    }
+
+    // a frame count that Timecode can represent (larger counts wrap at midnight)
+    bool IsFrames(int64_t frames)
+    {
+        return frames >= 0 && frames <= maxFrames;
+    }
+
+    // a time that converts to a frame count Timecode can represent, false for NaN too
+    bool IsSeconds(double seconds, const Framerate& framerate)
+    {
+        const double frameCount = static_cast<double>(framerate.GetFrameCount());
+        return seconds >= 0.0 && seconds * frameCount <= static_cast<double>(maxFrames - 1000);
+    }
+
+    bool IsSamples(int64_t samples, double samplerate, const Framerate& framerate)
+    {
+        return samples >= 0 && IsSeconds(static_cast<double>(samples) / samplerate, framerate);
+    }
+
+    // the frame count of a converted timecode, which is -1 when the time could not be converted
+    tcutils_status ToFrames(const Timecode& timecode, int64_t& frames)
+    {
+        frames = timecode.ToFrames().GetValue();
+        return frames >= 0 ? TCUTILS_OK : TCUTILS_ERROR_OUT_OF_RANGE;
+    }
+
+    RoundingMode ToRoundingMode(tcutils_rounding rounding)
+    {
+        return rounding == TCUTILS_ROUNDING_TRUNCATE ? RoundingMode::TRUNCATE
+                                                     : RoundingMode::NEAREST;
+    }
+
+    bool IsRounding(tcutils_rounding rounding)
+    {
+        return rounding == TCUTILS_ROUNDING_TRUNCATE || rounding == TCUTILS_ROUNDING_NEAREST;
+    }
+
+    // element i of a strided array; memcpy, as views of e.g. NumPy arrays may be unaligned
+    template <class T>
+    T Load(const T* array, ptrdiff_t stride, size_t i)
+    {
+        T value;
+        std::memcpy(&value,
+                    reinterpret_cast<const char*>(array) + static_cast<ptrdiff_t>(i) * stride,
+                    sizeof(T));
+        return value;
+    }
+
+    template <class T>
+    void Store(T* array, ptrdiff_t stride, size_t i, T value)
+    {
+        std::memcpy(
+            reinterpret_cast<char*>(array) + static_cast<ptrdiff_t>(i) * stride, &value, sizeof(T));
+    }
+
+    // whether a strided array can hold count results: with stride 0, all would go to one element
+    template <class T>
+    bool IsOutput(const T* array, ptrdiff_t stride, size_t count)
+    {
+        return count == 0 || (array != nullptr && (stride != 0 || count == 1));
+    }
+
+    // the width of the fields of an array of fixed-width strings; negative strides reverse it
+    size_t FieldWidth(ptrdiff_t stride)
+    {
+        return static_cast<size_t>(stride < 0 ? -stride : stride);
+    }
+
+    tcutils_status InvalidArgument(size_t count, size_t* firstError)
+    {
+        if (firstError != nullptr)
+        {
+            *firstError = count;
+        }
+        return TCUTILS_ERROR_INVALID_ARGUMENT;
+    }
+
+    // convert elements 0 to count - 1, calling fail for the elements that fail
+    template <class Convert, class Fail>
+    tcutils_status ForEach(size_t count, size_t* firstError, Convert convert, Fail fail)
+    {
+        tcutils_status result = TCUTILS_OK;
+        size_t first          = count;
+        for (size_t i = 0; i < count; i++)
+        {
+            tcutils_status status;
+            try
+            {
+                status = convert(i);
+            }
+            catch (...)
+            {
+                status = CurrentStatus();
+            }
+            if (status != TCUTILS_OK)
+            {
+                fail(i);
+                if (result == TCUTILS_OK)
+                {
+                    result = status;
+                    first  = i;
+                }
+            }
+        }
+        if (firstError != nullptr)
+        {
+            *firstError = first;
+        }
+        return result;
+    }
+
+    // convert each element of in to out with function(in, out), storing -1 for failed elements
+    template <class In, class Out, class Function>
+    tcutils_status Map(const In* in,
+                       ptrdiff_t inStride,
+                       size_t count,
+                       Out* out,
+                       ptrdiff_t outStride,
+                       size_t* firstError,
+                       Function function)
+    {
+        if ((count > 0 && in == nullptr) || !IsOutput(out, outStride, count))
+        {
+            return InvalidArgument(count, firstError);
+        }
+        return ForEach(
+            count,
+            firstError,
+            [&](size_t i) {
+                Out value;
+                const tcutils_status status = function(Load(in, inStride, i), value);
+                if (status == TCUTILS_OK)
+                {
+                    Store(out, outStride, i, value);
+                }
+                return status;
+            },
+            [&](size_t i) { Store(out, outStride, i, static_cast<Out>(-1)); });
+    }
+}
+
+const char* tcutils_version(void)
+{
+    return Version::GetString();
+}
+
+const char* tcutils_status_string(tcutils_status status)
+{
+    switch (status)
+    {
+        case TCUTILS_OK:
+            return "ok";
+        case TCUTILS_ERROR_INVALID_ARGUMENT:
+            return "invalid argument";
+        case TCUTILS_ERROR_PARSE:
+            return "parse error";
+        case TCUTILS_ERROR_OUT_OF_RANGE:
+            return "value out of range";
+        case TCUTILS_ERROR_INTERNAL:
+            return "internal error";
+    }
+    return "unknown status";
+}
+
+tcutils_status tcutils_framerate_parse(const char* str, tcutils_framerate* framerate)
+{
+    if (str == nullptr || framerate == nullptr)
+    {
+        return TCUTILS_ERROR_INVALID_ARGUMENT;
+    }
+    try
+    {
+        const Framerate parsed(str);
+        const Rational fps     = parsed.ToRational();
+        framerate->numerator   = fps.GetNumerator();
+        framerate->denominator = fps.GetDenominator();
+        framerate->drop        = parsed.IsDrop() ? 1 : 0;
+        return TCUTILS_OK;
+    }
+    catch (...)
+    {
+        return CurrentStatus();
+    }
+}
+
+tcutils_status tcutils_framerate_frame_count(tcutils_framerate framerate, int32_t* frameCount)
+{
+    Framerate fr;
+    if (frameCount == nullptr)
+    {
+        return TCUTILS_ERROR_INVALID_ARGUMENT;
+    }
+    const tcutils_status status = ToFramerate(framerate, fr);
+    if (status == TCUTILS_OK)
+    {
+        *frameCount = static_cast<int32_t>(fr.GetFrameCount());
+    }
+    return status;
+}
+
+tcutils_status tcutils_parse_n(tcutils_framerate framerate,
+                               const char* strings,
+                               ptrdiff_t strings_stride,
+                               size_t count,
+                               int64_t* frames,
+                               ptrdiff_t frames_stride,
+                               size_t* first_error)
+{
+    Framerate fr;
+    if (ToFramerate(framerate, fr) != TCUTILS_OK || strings_stride == 0 ||
+        (count > 0 && strings == nullptr) || !IsOutput(frames, frames_stride, count))
+    {
+        return InvalidArgument(count, first_error);
+    }
+    const size_t width = FieldWidth(strings_stride);
+    return ForEach(
+        count,
+        first_error,
+        [&](size_t i) {
+            // copy the field, which need not be terminated; no timecode string is this long
+            char str[32];
+            const char* field = strings + static_cast<ptrdiff_t>(i) * strings_stride;
+            const char* end   = static_cast<const char*>(std::memchr(field, '\0', width));
+            const size_t size = end != nullptr ? static_cast<size_t>(end - field) : width;
+            if (size >= sizeof(str))
+            {
+                return TCUTILS_ERROR_PARSE;
+            }
+            std::memcpy(str, field, size);
+            str[size] = '\0';
+
+            int64_t value;
+            const tcutils_status status = ToFrames(Timecode(fr, str), value);
+            if (status == TCUTILS_OK)
+            {
+                Store(frames, frames_stride, i, value);
+            }
+            return status;
+        },
+        [&](size_t i) { Store(frames, frames_stride, i, int64_t(-1)); });
+}
+
+tcutils_status tcutils_format_n(tcutils_framerate framerate,
+                                const int64_t* frames,
+                                ptrdiff_t frames_stride,
+                                size_t count,
+                                char* strings,
+                                ptrdiff_t strings_stride,
+                                size_t* first_error)
+{
+    Framerate fr;
+    if (ToFramerate(framerate, fr) != TCUTILS_OK ||
+        FieldWidth(strings_stride) < (fr.GetFrameCount() > 100 ? 12u : 11u) ||
+        (count > 0 && (frames == nullptr || strings == nullptr)))
+    {
+        return InvalidArgument(count, first_error);
+    }
+    const size_t width = FieldWidth(strings_stride);
+    return ForEach(
+        count,
+        first_error,
+        [&](size_t i) {
+            const int64_t value = Load(frames, frames_stride, i);
+            if (!IsFrames(value))
+            {
+                return TCUTILS_ERROR_OUT_OF_RANGE;
+            }
+            char str[16];
+            Timecode(fr, Frames(static_cast<int32_t>(value))).ToString(str, sizeof(str));
+            // pad with NUL bytes, leaving no terminator when the string fills the field
+            char* field       = strings + static_cast<ptrdiff_t>(i) * strings_stride;
+            const size_t size = std::strlen(str);
+            std::memcpy(field, str, size);
+            std::memset(field + size, '\0', width - size);
+            return TCUTILS_OK;
+        },
+        [&](size_t i) {
+            std::memset(strings + static_cast<ptrdiff_t>(i) * strings_stride, '\0', width);
+        });
+}
+
+tcutils_status tcutils_samples_to_tc_n(tcutils_framerate framerate,
+                                       double samplerate,
+                                       tcutils_rounding rounding,
+                                       const int64_t* samples,
+                                       ptrdiff_t samples_stride,
+                                       size_t count,
+                                       int64_t* frames,
+                                       ptrdiff_t frames_stride,
+                                       size_t* first_error)
+{
+    Framerate fr;
+    if (ToFramerate(framerate, fr) != TCUTILS_OK || !IsSamplerate(samplerate) ||
+        !IsRounding(rounding))
+    {
+        return InvalidArgument(count, first_error);
+    }
+    const RoundingMode roundingMode = ToRoundingMode(rounding);
+    return Map(samples,
+               samples_stride,
+               count,
+               frames,
+               frames_stride,
+               first_error,
+               [&](int64_t in, int64_t& out) {
+                   if (!IsSamples(in, samplerate, fr))
+                   {
+                       return TCUTILS_ERROR_OUT_OF_RANGE;
+                   }
+                   return ToFrames(Timecode(fr, Samples(in), Samplerate(samplerate), roundingMode),
+                                   out);
+               });
+}
+
+tcutils_status tcutils_tc_to_samples_n(tcutils_framerate framerate,
+                                       double samplerate,
+                                       const int64_t* frames,
+                                       ptrdiff_t frames_stride,
+                                       size_t count,
+                                       int64_t* samples,
+                                       ptrdiff_t samples_stride,
+                                       size_t* first_error)
+{
+    Framerate fr;
+    if (ToFramerate(framerate, fr) != TCUTILS_OK || !IsSamplerate(samplerate))
+    {
+        return InvalidArgument(count, first_error);
+    }
+    return Map(frames,
+               frames_stride,
+               count,
+               samples,
+               samples_stride,
+               first_error,
+               [&](int64_t in, int64_t& out) {
+                   if (!IsFrames(in))
+                   {
+                       return TCUTILS_ERROR_OUT_OF_RANGE;
+                   }
+                   const Timecode timecode(fr, Frames(static_cast<int32_t>(in)));
+                   out = timecode.ToSamples(Samplerate(samplerate)).GetValue();
+                   return TCUTILS_OK;
+               });
+}
+
+tcutils_status tcutils_seconds_to_tc_n(tcutils_framerate framerate,
+                                       tcutils_rounding rounding,
+                                       const double* seconds,
+                                       ptrdiff_t seconds_stride,
+                                       size_t count,
+                                       int64_t* frames,
+                                       ptrdiff_t frames_stride,
+                                       size_t* first_error)
+{
+    Framerate fr;
+    if (ToFramerate(framerate, fr) != TCUTILS_OK || !IsRounding(rounding))
+    {
+        return InvalidArgument(count, first_error);
+    }
+    const RoundingMode roundingMode = ToRoundingMode(rounding);
+    return Map(seconds,
+               seconds_stride,
+               count,
+               frames,
+               frames_stride,
+               first_error,
+               [&](double in, int64_t& out) {
+                   if (!IsSeconds(in, fr))
+                   {
+                       return TCUTILS_ERROR_OUT_OF_RANGE;
+                   }
+                   return ToFrames(Timecode(fr, Seconds(in), roundingMode), out);
+               });
+}
+
+tcutils_status tcutils_tc_to_seconds_n(tcutils_framerate framerate,
+                                       const int64_t* frames,
+                                       ptrdiff_t frames_stride,
+                                       size_t count,
+                                       double* seconds,
+                                       ptrdiff_t seconds_stride,
+                                       size_t* first_error)
+{
+    Framerate fr;
+    if (ToFramerate(framerate, fr) != TCUTILS_OK)
+    {
+        return InvalidArgument(count, first_error);
+    }
+    return Map(frames,
+               frames_stride,
+               count,
+               seconds,
+               seconds_stride,
+               first_error,
+               [&](int64_t in, double& out) {
+                   if (!IsFrames(in))
+                   {
+                       return TCUTILS_ERROR_OUT_OF_RANGE;
+                   }
+                   out = Timecode(fr, Frames(static_cast<int32_t>(in))).ToSeconds().GetValue();
+                   return TCUTILS_OK;
+               });
+}
+
+tcutils_status tcutils_damf_to_tc_n(tcutils_framerate framerate,
+                                    tcutils_rounding rounding,
+                                    const double* damf_seconds,
+                                    ptrdiff_t damf_seconds_stride,
+                                    size_t count,
+                                    int64_t* frames,
+                                    ptrdiff_t frames_stride,
+                                    size_t* first_error)
+{
+    Framerate fr;
+    if (ToFramerate(framerate, fr) != TCUTILS_OK || !IsRounding(rounding))
+    {
+        return InvalidArgument(count, first_error);
+    }
+    const RoundingMode roundingMode = ToRoundingMode(rounding);
+    return Map(damf_seconds,
+               damf_seconds_stride,
+               count,
+               frames,
+               frames_stride,
+               first_error,
+               [&](double in, int64_t& out) {
+                   if (!IsSeconds(in, fr))
+                   {
+                       return TCUTILS_ERROR_OUT_OF_RANGE;
+                   }
+                   return ToFrames(Timecode(fr, DAMFSeconds(in), roundingMode), out);
+               });
+}
+
+tcutils_status tcutils_tc_to_damf_n(tcutils_framerate framerate,
+                                    const int64_t* frames,
+                                    ptrdiff_t frames_stride,
+                                    size_t count,
+                                    double* damf_seconds,
+                                    ptrdiff_t damf_seconds_stride,
+                                    size_t* first_error)
+{
+    Framerate fr;
+    if (ToFramerate(framerate, fr) != TCUTILS_OK)
+    {
+        return InvalidArgument(count, first_error);
+    }
+    return Map(frames,
+               frames_stride,
+               count,
+               damf_seconds,
+               damf_seconds_stride,
+               first_error,
+               [&](int64_t in, double& out) {
+                   if (!IsFrames(in))
+                   {
+                       return TCUTILS_ERROR_OUT_OF_RANGE;
+                   }
+                   const Timecode timecode(fr, Frames(static_cast<int32_t>(in)));
+                   out = timecode.ToDAMFSeconds().GetValue();
+                   return TCUTILS_OK;
+               });
+}
+
+tcutils_status tcutils_samples_to_damf_n(tcutils_framerate framerate,
+                                         double samplerate,
+                                         const int64_t* samples,
+                                         ptrdiff_t samples_stride,
+                                         size_t count,
+                                         double* damf_seconds,
+                                         ptrdiff_t damf_seconds_stride,
+                                         size_t* first_error)
+{
+    Framerate fr;
+    if (ToFramerate(framerate, fr) != TCUTILS_OK || !IsSamplerate(samplerate))
+    {
+        return InvalidArgument(count, first_error);
+    }
+    return Map(samples,
+               samples_stride,
+               count,
+               damf_seconds,
+               damf_seconds_stride,
+               first_error,
+               [&](int64_t in, double& out) {
+                   if (in < 0)
+                   {
+                       return TCUTILS_ERROR_OUT_OF_RANGE;
+                   }
+                   out = Convert::ToDAMFSeconds(fr, Samples(in), Samplerate(samplerate))
+                             .GetValue();
+                   return TCUTILS_OK;
+               });
+}
+
+tcutils_status tcutils_damf_to_samples_n(tcutils_framerate framerate,
+                                         double samplerate,
+                                         const double* damf_seconds,
+                                         ptrdiff_t damf_seconds_stride,
+                                         size_t count,
+                                         int64_t* samples,
+                                         ptrdiff_t samples_stride,
+                                         size_t* first_error)
+{
+    Framerate fr;
+    if (ToFramerate(framerate, fr) != TCUTILS_OK || !IsSamplerate(samplerate))
+    {
+        return InvalidArgument(count, first_error);
+    }
+    // leave headroom for the 1001/1000 ratio, so that the samples fit in an int64_t
+    const double maxSamples = static_cast<double>(int64_t(1) << 62);
+    return Map(damf_seconds,
+               damf_seconds_stride,
+               count,
+               samples,
+               samples_stride,
+               first_error,
+               [&](double in, int64_t& out) {
+                   if (!(in >= 0.0 && in * samplerate < maxSamples))
+                   {
+                       return TCUTILS_ERROR_OUT_OF_RANGE;
+                   }
+                   out = Convert::ToSamples(fr, DAMFSeconds(in), Samplerate(samplerate))
+                             .GetValue();
+                   return TCUTILS_OK;
+               });
+}
+
+tcutils_status tcutils_frame_boundary_n(tcutils_framerate framerate,
+                                        double samplerate,
+                                        tcutils_boundary boundary,
+                                        const int64_t* samples,
+                                        ptrdiff_t samples_stride,
+                                        size_t count,
+                                        int64_t* boundaries,
+                                        ptrdiff_t boundaries_stride,
+                                        size_t* first_error)
+{
+    Framerate fr;
+    if (ToFramerate(framerate, fr) != TCUTILS_OK || !IsSamplerate(samplerate) ||
+        (boundary != TCUTILS_BOUNDARY_FLOOR && boundary != TCUTILS_BOUNDARY_ROUND &&
+         boundary != TCUTILS_BOUNDARY_CEILING))
+    {
+        return InvalidArgument(count, first_error);
+    }
+    const Samplerate sr(samplerate);
+    return Map(samples,
+               samples_stride,
+               count,
+               boundaries,
+               boundaries_stride,
+               first_error,
+               [&](int64_t in, int64_t& out) {
+                   if (!IsSamples(in, samplerate, fr))
+                   {
+                       return TCUTILS_ERROR_OUT_OF_RANGE;
+                   }
+                   switch (boundary)
+                   {
+                       case TCUTILS_BOUNDARY_FLOOR:
+                           out = FrameBoundary::Floor(fr, Samples(in), sr).GetValue();
+                           break;
+                       case TCUTILS_BOUNDARY_ROUND:
+                           out = FrameBoundary::Round(fr, Samples(in), sr).GetValue();
+                           break;
+                       case TCUTILS_BOUNDARY_CEILING:
+                           out = FrameBoundary::Ceiling(fr, Samples(in), sr).GetValue();
+                           break;
+                   }
+                   return TCUTILS_OK;
+               });
+}
+
+tcutils_status tcutils_samples_to_subframes_n(tcutils_framerate framerate,
+                                              double samplerate,
+                                              int32_t subframes_denominator,
+                                              const int64_t* samples,
+                                              ptrdiff_t samples_stride,
+                                              size_t count,
+                                              int64_t* frames,
+                                              ptrdiff_t frames_stride,
+                                              int32_t* subframes,
+                                              ptrdiff_t subframes_stride,
+                                              size_t* first_error)
+{
+    Framerate fr;
+    if (ToFramerate(framerate, fr) != TCUTILS_OK || !IsSamplerate(samplerate) ||
+        subframes_denominator < 2 ||
+        (count > 0 && samples == nullptr) || !IsOutput(frames, frames_stride, count) ||
+        !IsOutput(subframes, subframes_stride, count))
+    {
+        return InvalidArgument(count, first_error);
+    }
+    const Samplerate sr(samplerate);
+    return ForEach(
+        count,
+        first_error,
+        [&](size_t i) {
+            const int64_t in = Load(samples, samples_stride, i);
+            if (!IsSamples(in, samplerate, fr))
+            {
+                return TCUTILS_ERROR_OUT_OF_RANGE;
+            }
+            const TimecodeSubframes value(fr, Samples(in), sr, subframes_denominator);
+            int64_t valueFrames;
+            const tcutils_status status = ToFrames(value.GetTimecode(), valueFrames);
+            if (status == TCUTILS_OK)
+            {
+                Store(frames, frames_stride, i, valueFrames);
+                Store(subframes, subframes_stride, i, int32_t(value.GetSubframesNum()));
+            }
+            return status;
+        },
+        [&](size_t i) {
+            Store(frames, frames_stride, i, int64_t(-1));
+            Store(subframes, subframes_stride, i, int32_t(-1));
+        });
+}
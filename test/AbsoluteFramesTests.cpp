@@ -0,0 +1,163 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "FullStressTest.h"
+
+#include <gtest/gtest.h>
+#include <tcutils/AbsoluteFrames.h>
+
+using namespace testing;
+using namespace Dolby::TcUtils;
+
+// test AbsoluteFrames methods
+
+class AbsoluteFramesTests : public Test
+{
+};
+
+TEST_F(AbsoluteFramesTests, Day)
+{
+    const Framerate df(Framerate::FPS_2997DF);
+
+    // clang-format off
+    ASSERT_EQ(AbsoluteFrames::FramesPerDay(Framerate::FPS_25),  2160000);
+    ASSERT_EQ(AbsoluteFrames::FramesPerDay(Framerate::FPS_2997), 2592000);
+    ASSERT_EQ(AbsoluteFrames::FramesPerDay(df),                  2589408);
+    ASSERT_EQ(AbsoluteFrames::FramesPerDay(Framerate::FPS_30DF), 2589408);
+
+    ASSERT_EQ(AbsoluteFrames(df, 2589408).GetDay(),        1);
+    ASSERT_EQ(AbsoluteFrames(df, 2589408).GetFrameOfDay(), 0);
+    ASSERT_EQ(AbsoluteFrames(df, 2589407).GetDay(),        0);
+    ASSERT_EQ(AbsoluteFrames(df, -1).GetDay(),             -1);
+    ASSERT_EQ(AbsoluteFrames(df, -1).ToTimecode(),         Timecode(df, "23:59:59;29"));
+    ASSERT_EQ(AbsoluteFrames(df, 2589408 * 40 + 17982).ToTimecode(), Timecode(df, "00:10:00;00"));
+    // clang-format on
+
+    ASSERT_EQ(AbsoluteFrames(Timecode(df, "00:10:00;00"), 40).GetValue(), 2589408 * 40 + 17982);
+    ASSERT_EQ(AbsoluteFrames(Timecode(df, "25:00:00;00", WrapMode::CONTINUE)),
+              AbsoluteFrames(Timecode(df, "01:00:00;00"), 1));
+
+    ASSERT_THROW(AbsoluteFrames(Framerate::UNDEFINED, 0), AbsoluteFrames::UndefinedFramerate);
+    ASSERT_THROW(AbsoluteFrames(Timecode(df)), Timecode::ValueOutOfRange);
+}
+
+TEST_F(AbsoluteFramesTests, Label)
+{
+    for (auto framerate : Framerate::values())
+    {
+        const int64_t framesPerDay = AbsoluteFrames::FramesPerDay(framerate);
+        Timecode tc(framerate, 0, 0, 0, 0);
+        for (int64_t n = 0; n < framesPerDay; n++, ++tc)
+        {
+            if (!FullStressTest::Active() && n % 97 != 0)
+            {
+                continue;
+            }
+            // some weeks into the timeline
+            const AbsoluteFrames position(framerate, framesPerDay * 30 + n);
+            ASSERT_EQ(position.GetDay(), 30);
+            ASSERT_EQ(position.ToTimecode(), tc);
+            ASSERT_EQ(AbsoluteFrames(tc, 30), position);
+        }
+    }
+}
+
+TEST_F(AbsoluteFramesTests, Samples)
+{
+    const Samplerate samplerates[] = {Samplerate(44100.0), Samplerate(48000.0),
+                                      Samplerate(48000.0 / 1.001), Samplerate(192000.0)};
+    for (auto framerate : Framerate::values())
+    {
+        for (const Samplerate samplerate : samplerates)
+        {
+            // matches Timecode within a day
+            for (int64_t samples = 0; samples < int64_t(86400) * 44100; samples += 9973)
+            {
+                for (auto mode : {RoundingMode::TRUNCATE, RoundingMode::NEAREST})
+                {
+                    const AbsoluteFrames position(framerate, Samples(samples), samplerate, mode);
+                    const Timecode expected(framerate, Samples(samples), samplerate, mode);
+                    if (position.ToTimecode() != expected)
+                    {
+                        // except when the next frame starts exactly half way the sample and the
+                        // next, Timecode then puts the sample in the next frame
+                        ASSERT_EQ((position + 1).ToTimecode(), expected);
+                        ASSERT_EQ((position + 1).ToSamples(samplerate), Samples(samples + 1));
+                    }
+                }
+            }
+
+            // frame boundaries are exact and symmetrical over weeks
+            const int64_t start = AbsoluteFrames::FramesPerDay(framerate) * 60;
+            for (int64_t n = start; n < start + 1000; n++)
+            {
+                const AbsoluteFrames position(framerate, n);
+                const Samples samples = position.ToSamples(samplerate);
+                const Samples before(samples.GetValue() - 1);
+                ASSERT_EQ(AbsoluteFrames(framerate, samples, samplerate), position);
+                ASSERT_EQ(AbsoluteFrames(framerate, samples, samplerate, RoundingMode::TRUNCATE),
+                          position);
+                ASSERT_EQ(AbsoluteFrames(framerate, before, samplerate, RoundingMode::TRUNCATE),
+                          position - 1);
+            }
+        }
+    }
+
+    // 60 days of 29.97 at 48 kHz: 155369880 frames of exactly 1601.6 samples
+    const AbsoluteFrames position(Framerate::FPS_2997, 155369880);
+    ASSERT_EQ(position.ToSamples(Samplerate(48000.0)), Samples(248840399808));
+    ASSERT_EQ(AbsoluteFrames(Framerate::FPS_2997, -5).ToSamples(Samplerate(48000.0)),
+              Samples(-8008));
+}
+
+TEST_F(AbsoluteFramesTests, Ticks)
+{
+    const Framerate framerate(Framerate::FPS_23976);
+    const AbsoluteFrames position(framerate, int64_t(1) << 32);
+
+    ASSERT_EQ(AbsoluteFrames(framerate, position.ToTicks<1000000000>()), position);
+    ASSERT_EQ(AbsoluteFrames(framerate, Ticks<48000>(48048)), AbsoluteFrames(framerate, 24));
+    ASSERT_EQ(AbsoluteFrames(framerate, Ticks<48000>(48047), RoundingMode::TRUNCATE),
+              AbsoluteFrames(framerate, 23));
+    ASSERT_EQ(AbsoluteFrames(framerate, 24).ToTicks<48000>(), Ticks<48000>(48048));
+}
+
+TEST_F(AbsoluteFramesTests, Operators)
+{
+    const AbsoluteFrames a(Framerate::FPS_25, 100);
+    AbsoluteFrames b = a + 50;
+
+    ASSERT_EQ(b - a, 50);
+    ASSERT_TRUE(a < b);
+    ASSERT_TRUE(b > a);
+    ASSERT_TRUE(a <= a);
+    ASSERT_TRUE(a >= a);
+    ASSERT_EQ(--b, a + 49);
+    ASSERT_EQ(++b - 50, a);
+    ASSERT_NE(a, AbsoluteFrames(Framerate::FPS_50, 100));
+    ASSERT_THROW(a < AbsoluteFrames(Framerate::FPS_50, 100), std::logic_error);
+}
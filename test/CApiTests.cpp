@@ -0,0 +1,440 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+#include <tcutils/Convert.h>
+#include <tcutils/FrameBoundary.h>
+#include <tcutils/TimecodeSubframes.h>
+#include <tcutils/Version.h>
+#include <tcutils/tcutils_c.h>
+
+using namespace testing;
+using namespace Dolby::TcUtils;
+
+namespace
+{
+    // the strides of contiguous arrays
+    const ptrdiff_t int32Stride  = sizeof(int32_t);
+    const ptrdiff_t int64Stride  = sizeof(int64_t);
+    const ptrdiff_t doubleStride = sizeof(double);
+}
+
+class CApiTests : public Test
+{
+protected:
+    static tcutils_framerate Parse(const char* str)
+    {
+        tcutils_framerate framerate{};
+        EXPECT_EQ(tcutils_framerate_parse(str, &framerate), TCUTILS_OK);
+        return framerate;
+    }
+};
+
+// Test framerates and the version
+TEST_F(CApiTests, Framerates)
+{
+    const tcutils_framerate ntsc = Parse("29.97df");
+    ASSERT_EQ(ntsc.numerator, 30000);
+    ASSERT_EQ(ntsc.denominator, 1001);
+    ASSERT_EQ(ntsc.drop, 1);
+    int32_t frameCount = 0;
+    ASSERT_EQ(tcutils_framerate_frame_count(ntsc, &frameCount), TCUTILS_OK);
+    ASSERT_EQ(frameCount, 30);
+
+    tcutils_framerate framerate{};
+    ASSERT_EQ(tcutils_framerate_parse("31.5", &framerate), TCUTILS_ERROR_PARSE);
+    ASSERT_EQ(tcutils_framerate_parse(nullptr, &framerate), TCUTILS_ERROR_INVALID_ARGUMENT);
+    ASSERT_EQ(tcutils_framerate_frame_count({25, 0, 0}, &frameCount),
+              TCUTILS_ERROR_INVALID_ARGUMENT);
+    ASSERT_EQ(tcutils_framerate_frame_count({25, 1, 1}, &frameCount),
+              TCUTILS_ERROR_INVALID_ARGUMENT);
+    ASSERT_STREQ(tcutils_version(), Version::GetString());
+    ASSERT_STREQ(tcutils_status_string(TCUTILS_ERROR_PARSE), "parse error");
+}
+
+// Test parsing and formatting fixed-width strings, as e.g. a NumPy array of dtype S11
+TEST_F(CApiTests, Strings)
+{
+    const tcutils_framerate ntsc = Parse("29.97df");
+    const char strings[]         = "01:00:00;0000:00:01;0000:00:02;00";
+    std::vector<int64_t> frames(3);
+    size_t firstError = 0;
+    ASSERT_EQ(tcutils_parse_n(ntsc,
+                              strings,
+                              11,
+                              3,
+                              frames.data(),
+                              int64Stride,
+                              &firstError),
+              TCUTILS_OK);
+    ASSERT_EQ(firstError, 3u);
+    ASSERT_EQ(frames, std::vector<int64_t>({107892, 30, 60}));
+
+    // wider fields, padded with NUL bytes
+    std::vector<char> formatted(3 * 16, 'x');
+    ASSERT_EQ(tcutils_format_n(ntsc,
+                               frames.data(),
+                               int64Stride,
+                               3,
+                               formatted.data(),
+                               16,
+                               &firstError),
+              TCUTILS_OK);
+    ASSERT_STREQ(&formatted[0], "01:00:00;00");
+    ASSERT_STREQ(&formatted[16], "00:00:01;00");
+    ASSERT_STREQ(&formatted[32], "00:00:02;00");
+    ASSERT_EQ(formatted[47], '\0');
+    std::vector<int64_t> parsed(3);
+    ASSERT_EQ(tcutils_parse_n(ntsc,
+                              formatted.data(),
+                              16,
+                              3,
+                              parsed.data(),
+                              int64Stride,
+                              &firstError),
+              TCUTILS_OK);
+    ASSERT_EQ(parsed, frames);
+
+    // reversed views, with negative strides
+    std::vector<char> reversed(3 * 12, 'x');
+    ASSERT_EQ(tcutils_format_n(ntsc,
+                               frames.data(),
+                               int64Stride,
+                               3,
+                               &reversed[24],
+                               -12,
+                               &firstError),
+              TCUTILS_OK);
+    ASSERT_STREQ(&reversed[0], "00:00:02;00");
+    ASSERT_STREQ(&reversed[24], "01:00:00;00");
+    ASSERT_EQ(tcutils_parse_n(ntsc, &strings[22], -11, 3, parsed.data(), int64Stride, &firstError),
+              TCUTILS_OK);
+    ASSERT_EQ(parsed, std::vector<int64_t>({60, 30, 107892}));
+
+    // too narrow for a timecode
+    ASSERT_EQ(tcutils_format_n(ntsc,
+                               frames.data(),
+                               int64Stride,
+                               3,
+                               formatted.data(),
+                               10,
+                               &firstError),
+              TCUTILS_ERROR_INVALID_ARGUMENT);
+    ASSERT_EQ(firstError, 3u);
+    ASSERT_EQ(tcutils_format_n(ntsc,
+                               frames.data(),
+                               int64Stride,
+                               3,
+                               &formatted[20],
+                               -10,
+                               &firstError),
+              TCUTILS_ERROR_INVALID_ARGUMENT);
+    ASSERT_EQ(tcutils_parse_n(ntsc, strings, 0, 3, parsed.data(), int64Stride, &firstError),
+              TCUTILS_ERROR_INVALID_ARGUMENT);
+}
+
+// Test conversions of contiguous arrays, against the C++ classes
+TEST_F(CApiTests, Conversions)
+{
+    const tcutils_framerate ntsc = Parse("29.97df");
+    const Framerate framerate(Framerate::FPS_2997DF);
+    const Samplerate samplerate(48000.0);
+    std::vector<int64_t> samples;
+    for (int64_t i = 0; i < 1000; i++)
+    {
+        samples.push_back(i * 160160 + i % 7 * 1000);
+    }
+    const size_t count = samples.size();
+
+    std::vector<int64_t> frames(count);
+    ASSERT_EQ(tcutils_samples_to_tc_n(ntsc,
+                                      48000.0,
+                                      TCUTILS_ROUNDING_NEAREST,
+                                      samples.data(),
+                                      int64Stride,
+                                      count,
+                                      frames.data(),
+                                      int64Stride,
+                                      nullptr),
+              TCUTILS_OK);
+    std::vector<int64_t> tcSamples(count);
+    ASSERT_EQ(tcutils_tc_to_samples_n(ntsc,
+                                      48000.0,
+                                      frames.data(),
+                                      int64Stride,
+                                      count,
+                                      tcSamples.data(),
+                                      int64Stride,
+                                      nullptr),
+              TCUTILS_OK);
+    std::vector<double> damf(count);
+    ASSERT_EQ(tcutils_samples_to_damf_n(ntsc,
+                                        48000.0,
+                                        samples.data(),
+                                        int64Stride,
+                                        count,
+                                        damf.data(),
+                                        doubleStride,
+                                        nullptr),
+              TCUTILS_OK);
+    std::vector<int64_t> damfSamples(count);
+    ASSERT_EQ(tcutils_damf_to_samples_n(ntsc,
+                                        48000.0,
+                                        damf.data(),
+                                        doubleStride,
+                                        count,
+                                        damfSamples.data(),
+                                        int64Stride,
+                                        nullptr),
+              TCUTILS_OK);
+    std::vector<double> seconds(count);
+    ASSERT_EQ(tcutils_tc_to_seconds_n(ntsc,
+                                      frames.data(),
+                                      int64Stride,
+                                      count,
+                                      seconds.data(),
+                                      doubleStride,
+                                      nullptr),
+              TCUTILS_OK);
+    std::vector<int64_t> secondsFrames(count);
+    ASSERT_EQ(tcutils_seconds_to_tc_n(ntsc,
+                                      TCUTILS_ROUNDING_NEAREST,
+                                      seconds.data(),
+                                      doubleStride,
+                                      count,
+                                      secondsFrames.data(),
+                                      int64Stride,
+                                      nullptr),
+              TCUTILS_OK);
+    std::vector<int64_t> ceilings(count);
+    ASSERT_EQ(tcutils_frame_boundary_n(ntsc,
+                                       48000.0,
+                                       TCUTILS_BOUNDARY_CEILING,
+                                       samples.data(),
+                                       int64Stride,
+                                       count,
+                                       ceilings.data(),
+                                       int64Stride,
+                                       nullptr),
+              TCUTILS_OK);
+    std::vector<int64_t> subframeFrames(count);
+    std::vector<int32_t> subframes(count);
+    ASSERT_EQ(tcutils_samples_to_subframes_n(ntsc,
+                                             48000.0,
+                                             80,
+                                             samples.data(),
+                                             int64Stride,
+                                             count,
+                                             subframeFrames.data(),
+                                             int64Stride,
+                                             subframes.data(),
+                                             int32Stride,
+                                             nullptr),
+              TCUTILS_OK);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const Samples position(samples[i]);
+        const Timecode timecode(framerate, position, samplerate, RoundingMode::NEAREST);
+        ASSERT_EQ(frames[i], timecode.ToFrames().GetValue());
+        ASSERT_EQ(tcSamples[i], timecode.ToSamples(samplerate).GetValue());
+        ASSERT_EQ(damf[i], Convert::ToDAMFSeconds(framerate, position, samplerate).GetValue());
+        ASSERT_EQ(damfSamples[i], samples[i]);
+        ASSERT_EQ(seconds[i], timecode.ToSeconds().GetValue());
+        ASSERT_EQ(secondsFrames[i], frames[i]);
+        ASSERT_EQ(ceilings[i], FrameBoundary::Ceiling(framerate, position, samplerate).GetValue());
+        const TimecodeSubframes expected(framerate, position, samplerate, 80);
+        ASSERT_EQ(subframeFrames[i], expected.GetTimecode().ToFrames().GetValue());
+        ASSERT_EQ(subframes[i], expected.GetSubframesNum());
+    }
+}
+
+// Test strided arrays: a column of an array of structs, converted in place
+TEST_F(CApiTests, Strides)
+{
+    struct Event
+    {
+        int64_t samples;
+        int32_t id;
+        int64_t frames;
+        double damf;
+    };
+    std::vector<Event> events;
+    for (int32_t i = 0; i < 100; i++)
+    {
+        events.push_back({i * 48000LL, i, 0, 0.0});
+    }
+    const tcutils_framerate film = Parse("24");
+    const ptrdiff_t stride       = sizeof(Event);
+    ASSERT_EQ(tcutils_samples_to_tc_n(film,
+                                      48000.0,
+                                      TCUTILS_ROUNDING_TRUNCATE,
+                                      &events[0].samples,
+                                      stride,
+                                      events.size(),
+                                      &events[0].frames,
+                                      stride,
+                                      nullptr),
+              TCUTILS_OK);
+    ASSERT_EQ(tcutils_tc_to_damf_n(
+                  film, &events[0].frames, stride, events.size(), &events[0].damf, stride, nullptr),
+              TCUTILS_OK);
+    for (int32_t i = 0; i < 100; i++)
+    {
+        ASSERT_EQ(events[i].id, i);
+        ASSERT_EQ(events[i].frames, i * 24);
+        ASSERT_EQ(events[i].damf, i);
+    }
+
+    // a reversed view, with a negative stride
+    std::vector<int64_t> reversed(events.size());
+    ASSERT_EQ(tcutils_tc_to_samples_n(film,
+                                      48000.0,
+                                      &events.back().frames,
+                                      -stride,
+                                      events.size(),
+                                      reversed.data(),
+                                      int64Stride,
+                                      nullptr),
+              TCUTILS_OK);
+    ASSERT_EQ(reversed.front(), 99 * 48000);
+    ASSERT_EQ(reversed.back(), 0);
+
+    // a broadcast input, with stride 0, repeats its one element
+    const int64_t second = 24;
+    std::vector<double> seconds(events.size(), -1.0);
+    ASSERT_EQ(tcutils_tc_to_seconds_n(
+                  film, &second, 0, seconds.size(), seconds.data(), doubleStride, nullptr),
+              TCUTILS_OK);
+    ASSERT_EQ(seconds, std::vector<double>(events.size(), 1.0));
+
+    // outputs of more than one element can't have stride 0
+    size_t firstError = 0;
+    double output     = -1.0;
+    ASSERT_EQ(tcutils_tc_to_seconds_n(film, &second, 0, 2, &output, 0, &firstError),
+              TCUTILS_ERROR_INVALID_ARGUMENT);
+    ASSERT_EQ(firstError, 2u);
+    ASSERT_EQ(output, -1.0);
+    ASSERT_EQ(tcutils_tc_to_seconds_n(film, &second, 0, 1, &output, 0, &firstError), TCUTILS_OK);
+    ASSERT_EQ(output, 1.0);
+}
+
+// Test that errors come back as codes, with -1 for the elements that failed
+TEST_F(CApiTests, Errors)
+{
+    const tcutils_framerate ntsc = Parse("29.97df");
+    size_t firstError            = 0;
+
+    const char strings[] = "01:00:00;0000:01:00;0001:00:00:xx";
+    std::vector<int64_t> frames(3);
+    ASSERT_EQ(tcutils_parse_n(ntsc, strings, 11, 3, frames.data(), int64Stride, &firstError),
+              TCUTILS_ERROR_OUT_OF_RANGE);
+    ASSERT_EQ(firstError, 1u);
+    ASSERT_EQ(frames, std::vector<int64_t>({107892, -1, -1}));
+
+    const std::vector<double> seconds({1.0, -1.0, NAN, 1e12, INFINITY});
+    frames.resize(seconds.size());
+    ASSERT_EQ(tcutils_seconds_to_tc_n(ntsc,
+                                      TCUTILS_ROUNDING_NEAREST,
+                                      seconds.data(),
+                                      doubleStride,
+                                      seconds.size(),
+                                      frames.data(),
+                                      int64Stride,
+                                      &firstError),
+              TCUTILS_ERROR_OUT_OF_RANGE);
+    ASSERT_EQ(firstError, 1u);
+    ASSERT_EQ(frames[0], 30);
+    ASSERT_EQ(frames[2], -1);
+    ASSERT_EQ(frames[4], -1);
+
+    const std::vector<int64_t> invalid({-1, 2000000000000LL, 24});
+    std::vector<double> damf(3);
+    ASSERT_EQ(tcutils_tc_to_damf_n(ntsc,
+                                   invalid.data(),
+                                   int64Stride,
+                                   3,
+                                   damf.data(),
+                                   doubleStride,
+                                   &firstError),
+              TCUTILS_ERROR_OUT_OF_RANGE);
+    ASSERT_EQ(firstError, 0u);
+    ASSERT_EQ(damf[0], -1.0);
+    ASSERT_EQ(damf[1], -1.0);
+    ASSERT_DOUBLE_EQ(damf[2], 0.8);
+
+    // invalid arguments of the call
+    ASSERT_EQ(tcutils_tc_to_damf_n({25, 1, 1},
+                                   invalid.data(),
+                                   int64Stride,
+                                   3,
+                                   damf.data(),
+                                   doubleStride,
+                                   &firstError),
+              TCUTILS_ERROR_INVALID_ARGUMENT);
+    ASSERT_EQ(tcutils_tc_to_damf_n(ntsc,
+                                   nullptr,
+                                   int64Stride,
+                                   3,
+                                   damf.data(),
+                                   doubleStride,
+                                   &firstError),
+              TCUTILS_ERROR_INVALID_ARGUMENT);
+    ASSERT_EQ(tcutils_tc_to_damf_n(ntsc,
+                                   nullptr,
+                                   int64Stride,
+                                   0,
+                                   nullptr,
+                                   doubleStride,
+                                   &firstError),
+              TCUTILS_OK);
+    ASSERT_EQ(tcutils_frame_boundary_n(ntsc,
+                                       0.0,
+                                       TCUTILS_BOUNDARY_FLOOR,
+                                       invalid.data(),
+                                       int64Stride,
+                                       3,
+                                       frames.data(),
+                                       int64Stride,
+                                       &firstError),
+              TCUTILS_ERROR_INVALID_ARGUMENT);
+    ASSERT_EQ(firstError, 3u);
+    ASSERT_EQ(tcutils_samples_to_subframes_n(ntsc,
+                                             48000.0,
+                                             1,
+                                             invalid.data(),
+                                             int64Stride,
+                                             3,
+                                             frames.data(),
+                                             int64Stride,
+                                             nullptr,
+                                             int32Stride,
+                                             nullptr),
+              TCUTILS_ERROR_INVALID_ARGUMENT);
+}
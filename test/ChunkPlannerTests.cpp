@@ -0,0 +1,128 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <vector>
+#include <tcutils/ChunkPlanner.h>
+#include <tcutils/FrameBoundary.h>
+#include <tcutils/SessionTimeline.h>
+
+using namespace testing;
+using namespace Dolby::TcUtils;
+
+class ChunkPlannerTests : public Test
+{
+};
+
+// Test that chunks are consecutive, on frame boundaries, and balanced to within one frame
+TEST_F(ChunkPlannerTests, Balanced)
+{
+    const Samplerate samplerate(48000);
+    for (Framerate framerate : Framerate::Range())
+    {
+        const Timecode start(framerate, 0, 59, 50, 0);
+        const int64_t origin = start.ToSamples(samplerate).GetValue();
+        const SessionTimeline timeline(start, samplerate);
+        // two hours and a partial frame
+        const Samples length(int64_t(48000) * 7200 + 1000);
+        const ChunkPlanner planner(start, samplerate, length);
+
+        for (size_t count : {1, 7, 64})
+        {
+            const std::vector<ChunkPlanner::Chunk> plan = planner.PlanCount(count);
+            ASSERT_EQ(plan.size(), count);
+            ASSERT_EQ(plan.front().start.GetValue(), 0);
+            ASSERT_EQ(plan.back().end.GetValue(), length.GetValue());
+
+            int64_t minFrames = INT64_MAX;
+            int64_t maxFrames = 0;
+            int64_t frames    = 0;
+            for (size_t i = 0; i < plan.size(); i++)
+            {
+                const ChunkPlanner::Chunk& chunk = plan[i];
+                if (i > 0)
+                {
+                    ASSERT_EQ(chunk.start.GetValue(), plan[i - 1].end.GetValue());
+                }
+                ASSERT_EQ(timeline.ToSamples(chunk.timecode).GetValue(), chunk.start.GetValue());
+                ASSERT_TRUE(FrameBoundary::IsOnBoundary(
+                    framerate, Samples(chunk.start.GetValue() + origin), samplerate));
+                ASSERT_EQ(chunk.handleStart.GetValue(), chunk.start.GetValue());
+                ASSERT_EQ(chunk.handleEnd.GetValue(), chunk.end.GetValue());
+
+                const int64_t chunkFrames =
+                    i + 1 < plan.size()
+                        ? plan[i + 1].timecode.ToFrames().GetValue() -
+                              chunk.timecode.ToFrames().GetValue()
+                        : planner.GetFrameCount() - frames;
+                minFrames = std::min(minFrames, chunkFrames);
+                maxFrames = std::max(maxFrames, chunkFrames);
+                frames += chunkFrames;
+            }
+            ASSERT_LE(maxFrames - minFrames, 1);
+            ASSERT_EQ(frames, planner.GetFrameCount());
+        }
+    }
+}
+
+// Test handles and planning by duration
+TEST_F(ChunkPlannerTests, HandlesAndDuration)
+{
+    // at 25 fps and 48 kHz, a frame is 1920 samples; one hour and one sample is 90001 frames
+    const Timecode start(Framerate::FPS_25, 10, 0, 0, 0);
+    const ChunkPlanner planner(start, Samplerate(48000), Samples(int64_t(1920) * 90000 + 1));
+    ASSERT_EQ(planner.GetFrameCount(), 90001);
+
+    const TimecodeDuration tenMinutes(Framerate::FPS_25, "00:10:00:00");
+    const std::vector<ChunkPlanner::Chunk> plan = planner.PlanDuration(tenMinutes, Frames(5));
+    ASSERT_EQ(plan.size(), 7u);
+    // clang-format off
+    ASSERT_EQ(plan[0].timecode.ToString(),    "10:00:00:00");
+    ASSERT_EQ(plan[1].timecode.ToString(),    "10:08:34:07");
+    ASSERT_EQ(plan[0].handleStart.GetValue(), 0);
+    ASSERT_EQ(plan[0].handleEnd.GetValue(),   plan[0].end.GetValue() + 5 * 1920);
+    ASSERT_EQ(plan[1].handleStart.GetValue(), plan[1].start.GetValue() - 5 * 1920);
+    ASSERT_EQ(plan[6].handleEnd.GetValue(),   int64_t(1920) * 90000 + 1);
+    // clang-format on
+
+    // one chunk per frame for short programs, and no chunks for empty programs
+    ASSERT_EQ(ChunkPlanner(start, Samplerate(48000), Samples(3000)).PlanCount(8).size(), 2u);
+    const ChunkPlanner empty(start, Samplerate(48000), Samples(0));
+    ASSERT_TRUE(empty.PlanDuration(tenMinutes).empty());
+
+    ASSERT_THROW(planner.PlanCount(0), ChunkPlanner::InvalidParameter);
+    ASSERT_THROW(planner.PlanCount(2, Frames(-1)), ChunkPlanner::InvalidParameter);
+    ASSERT_THROW(planner.PlanDuration(TimecodeDuration(Framerate::FPS_25, int64_t(0))),
+                 ChunkPlanner::InvalidParameter);
+    ASSERT_THROW(planner.PlanDuration(TimecodeDuration(Framerate::FPS_24, int64_t(100))),
+                 std::logic_error);
+    ASSERT_THROW(ChunkPlanner(Timecode(), Samplerate(48000), Samples(0)),
+                 ChunkPlanner::InvalidParameter);
+    ASSERT_THROW(ChunkPlanner(start, Samplerate(48000), Samples(-1)),
+                 ChunkPlanner::InvalidParameter);
+}
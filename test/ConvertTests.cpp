@@ -227,3 +227,38 @@ TEST_F(ConvertTests, Hour24)
         }
     }
 }
+
+TEST_F(ConvertTests, TicksToSamples)
+{
+    using std::chrono::hours;
+    using std::chrono::microseconds;
+    using std::chrono::milliseconds;
+    const Samplerate sr(48000.0);
+
+    // clang-format off
+    ASSERT_EQ(Convert::ToSamples(Nanoseconds(1000000000), sr),          Samples(48000));
+    ASSERT_EQ(Convert::ToSamples(milliseconds(1), Samplerate(44100.0)), Samples(44));
+    ASSERT_EQ(Convert::ToSamples(Nanoseconds(10416), sr),               Samples(0));
+    ASSERT_EQ(Convert::ToSamples(Nanoseconds(10417), sr),               Samples(1));
+    ASSERT_EQ(Convert::ToSamples(Nanoseconds(-10416), sr),              Samples(0));
+    ASSERT_EQ(Convert::ToSamples(Nanoseconds(-10417), sr),              Samples(-1));
+    // 30 days at 48000/1.001 Hz is 124291708291.708... samples, exactly represented
+    ASSERT_EQ(Convert::ToSamples(hours(24 * 30), Samplerate(48000.0 / 1.001)),
+              Samples(124291708292));
+
+    ASSERT_EQ(Convert::ToTicks<48000>(Samples(123456789), sr),         Ticks<48000>(123456789));
+    ASSERT_EQ(Convert::ToTicks<1000000000>(Samples(1), sr),            Nanoseconds(20833));
+    ASSERT_EQ(Convert::ToDuration<microseconds>(Samples(48), sr).count(), 1000);
+    // clang-format on
+
+    // samples to nanoseconds and back is exact for any sample position
+    const Samplerate srs[] = {Samplerate(44100.0), sr, Samplerate(96000.0 / 1.001)};
+    for (const Samplerate samplerate : srs)
+    {
+        for (int64_t samples = 0; samples < int64_t(1) << 40; samples = samples * 3 + 7)
+        {
+            const Nanoseconds ns = Convert::ToTicks<1000000000>(Samples(samples), samplerate);
+            ASSERT_EQ(Convert::ToSamples(ns, samplerate), Samples(samples));
+        }
+    }
+}
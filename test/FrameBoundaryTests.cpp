@@ -173,3 +173,40 @@ TEST_F(FrameBoundaryTests, Round)
         } while (tc != tcEnd);
     }
 }
+
+TEST_F(FrameBoundaryTests, Ticks)
+{
+    using std::chrono::milliseconds;
+
+    // clang-format off
+    // 29.97: frame 1 starts at 33.3666... ms, frame 2 at 66.7333... ms
+    const Framerate ntsc(Framerate::FPS_2997);
+    ASSERT_EQ(FrameBoundary::Floor(ntsc, milliseconds(66)),       milliseconds(34));
+    ASSERT_EQ(FrameBoundary::Ceiling(ntsc, milliseconds(66)),     milliseconds(67));
+    ASSERT_EQ(FrameBoundary::Round(ntsc, milliseconds(50)),       milliseconds(34));
+    ASSERT_EQ(FrameBoundary::Round(ntsc, milliseconds(51)),       milliseconds(67));
+    ASSERT_EQ(FrameBoundary::Ceiling(ntsc, milliseconds(34)),     milliseconds(34));
+    ASSERT_TRUE(FrameBoundary::IsOnBoundary(ntsc, milliseconds(1001)));
+    ASSERT_FALSE(FrameBoundary::IsOnBoundary(ntsc, milliseconds(1000)));
+    ASSERT_EQ(FrameBoundary::Floor(ntsc, Nanoseconds(33366667)),  Nanoseconds(33366667));
+    ASSERT_EQ(FrameBoundary::Floor(ntsc, Nanoseconds(33366666)),  Nanoseconds(0));
+    // clang-format on
+
+    // boundaries are the ticks returned by Timecode::ToTicks
+    for (auto framerate : Framerate::values())
+    {
+        Timecode tc(framerate, 23, 50, 0, 0, WrapMode::CONTINUE);
+        Timecode tcEnd(framerate, 24, 0, 0, 0, WrapMode::CONTINUE);
+        do
+        {
+            typedef Ticks<48000> T;
+            const T ticks = tc.ToTicks<48000>();
+            ASSERT_TRUE(FrameBoundary::IsOnBoundary(framerate, ticks));
+            ASSERT_FALSE(FrameBoundary::IsOnBoundary(framerate, T(ticks.GetValue() + 1)));
+            ASSERT_EQ(FrameBoundary::Floor(framerate, T(ticks.GetValue() + 1)), ticks);
+            ASSERT_EQ(FrameBoundary::Ceiling(framerate, T(ticks.GetValue() - 1)), ticks);
+            ASSERT_EQ(FrameBoundary::Round(framerate, T(ticks.GetValue() - 10)), ticks);
+            ++tc;
+        } while (tc != tcEnd);
+    }
+}
@@ -0,0 +1,238 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include <tcutils/FrameCoverage.h>
+
+using namespace testing;
+using namespace Dolby::TcUtils;
+
+class FrameCoverageTests : public Test
+{
+};
+
+namespace
+{
+    const Framerate fps120(Framerate::FPS_120);
+
+    Timecode At(int32_t frame)
+    {
+        return Timecode(fps120, Frames(frame), WrapMode::CONTINUE);
+    }
+
+    // The runs of a plain bool array, as frame pairs
+    std::vector<std::pair<int32_t, int32_t>> Runs(const std::vector<bool>& present)
+    {
+        std::vector<std::pair<int32_t, int32_t>> runs;
+        for (size_t i = 0; i < present.size(); i++)
+        {
+            if (present[i] && (i == 0 || !present[i - 1]))
+            {
+                runs.emplace_back(static_cast<int32_t>(i), 0);
+            }
+            if (present[i] && (i + 1 == present.size() || !present[i + 1]))
+            {
+                runs.back().second = static_cast<int32_t>(i + 1);
+            }
+        }
+        return runs;
+    }
+
+    std::vector<std::pair<int32_t, int32_t>> Runs(const std::vector<FrameCoverage::Run>& runs)
+    {
+        std::vector<std::pair<int32_t, int32_t>> frames;
+        for (const FrameCoverage::Run& run : runs)
+        {
+            frames.emplace_back(run.in.ToFrames().GetValue(), run.out.ToFrames().GetValue());
+        }
+        return frames;
+    }
+}
+
+// Test adding and removing ranges, and the resulting runs and gaps
+TEST_F(FrameCoverageTests, Ranges)
+{
+    FrameCoverage coverage(Framerate::FPS_25);
+    ASSERT_TRUE(coverage.IsEmpty());
+
+    coverage.Add(Timecode(Framerate::FPS_25, "01:00:00:00"),
+                 Timecode(Framerate::FPS_25, "02:00:00:00"));
+    coverage.Add(Timecode(Framerate::FPS_25, "02:30:00:00"));
+    coverage.Remove(Timecode(Framerate::FPS_25, "01:10:00:00"),
+                    Timecode(Framerate::FPS_25, "01:20:00:00"));
+    ASSERT_EQ(coverage.Count(), 50 * 60 * 25 + 1);
+    ASSERT_TRUE(coverage.Contains(Timecode(Framerate::FPS_25, "01:09:59:24")));
+    ASSERT_FALSE(coverage.Contains(Timecode(Framerate::FPS_25, "01:10:00:00")));
+    ASSERT_TRUE(coverage.Contains(Timecode(Framerate::FPS_25, "02:30:00:00")));
+
+    const std::vector<FrameCoverage::Run> runs = coverage.GetRuns();
+    ASSERT_EQ(runs.size(), 3u);
+    ASSERT_EQ(runs[0].in.ToString(), "01:00:00:00");
+    ASSERT_EQ(runs[0].out.ToString(), "01:10:00:00");
+    ASSERT_EQ(runs[1].in.ToString(), "01:20:00:00");
+    ASSERT_EQ(runs[1].out.ToString(), "02:00:00:00");
+    ASSERT_EQ(runs[2].in.ToString(), "02:30:00:00");
+    ASSERT_EQ(runs[2].out.ToString(), "02:30:00:01");
+
+    const std::vector<FrameCoverage::Run> gaps = coverage.GetGaps(
+        Timecode(Framerate::FPS_25, "00:59:00:00"), Timecode(Framerate::FPS_25, "01:30:00:00"));
+    ASSERT_EQ(gaps.size(), 2u);
+    ASSERT_EQ(gaps[0].in.ToString(), "00:59:00:00");
+    ASSERT_EQ(gaps[0].out.ToString(), "01:00:00:00");
+    ASSERT_EQ(gaps[1].in.ToString(), "01:10:00:00");
+    ASSERT_EQ(gaps[1].out.ToString(), "01:20:00:00");
+
+    // a run up to the end of the day
+    FrameCoverage day(Framerate::FPS_2997DF);
+    day.Add(Timecode(Framerate::FPS_2997DF, "23:00:00;00"),
+            Timecode(Framerate::FPS_2997DF, "24:00:00;00", WrapMode::CONTINUE));
+    ASSERT_EQ(day.GetRuns()[0].out.ToString(), "24:00:00;00");
+    ASSERT_EQ(day.Count(), 107892);
+
+    ASSERT_THROW(coverage.Add(At(0)), std::logic_error);
+    ASSERT_THROW(coverage.Add(Timecode(Framerate::FPS_25)), Timecode::ValueOutOfRange);
+}
+
+// Test against a plain bool array with random ranges over four hours at 120 fps
+TEST_F(FrameCoverageTests, Random)
+{
+    const int32_t frames = 4 * 3600 * 120;
+    std::mt19937 random(38);
+    std::uniform_int_distribution<int32_t> start(0, frames - 1);
+    std::uniform_int_distribution<int32_t> length(0, 100000);
+
+    std::vector<bool> expected[3];
+    FrameCoverage coverages[3] = {
+        FrameCoverage(fps120), FrameCoverage(fps120), FrameCoverage(fps120)};
+    for (int c = 0; c < 3; c++)
+    {
+        expected[c].assign(frames, false);
+        for (int i = 0; i < 200; i++)
+        {
+            const int32_t in  = start(random);
+            const int32_t out = std::min(in + (i % 4 == 0 ? length(random) : length(random) / 1000),
+                                         frames);
+            const bool add = i % 5 != 4;
+            for (int32_t frame = in; frame < out; frame++)
+            {
+                expected[c][frame] = add;
+            }
+            if (add)
+            {
+                coverages[c].Add(At(in), At(out));
+            }
+            else
+            {
+                coverages[c].Remove(At(in), At(out));
+            }
+        }
+        ASSERT_EQ(Runs(coverages[c].GetRuns()), Runs(expected[c]));
+    }
+
+    std::vector<bool> unionExpected(frames);
+    std::vector<bool> intersectionExpected(frames);
+    std::vector<bool> differenceExpected(frames);
+    std::vector<bool> notExpected(frames);
+    int64_t count = 0;
+    for (int32_t frame = 0; frame < frames; frame++)
+    {
+        unionExpected[frame]        = expected[0][frame] || expected[1][frame];
+        intersectionExpected[frame] = expected[0][frame] && expected[1][frame];
+        differenceExpected[frame]   = expected[0][frame] && !expected[2][frame];
+        notExpected[frame]          = !expected[0][frame];
+        count += expected[0][frame] ? 1 : 0;
+    }
+    ASSERT_EQ(coverages[0].Count(), count);
+    ASSERT_EQ(Runs((coverages[0] | coverages[1]).GetRuns()), Runs(unionExpected));
+    ASSERT_EQ(Runs((coverages[0] & coverages[1]).GetRuns()), Runs(intersectionExpected));
+    ASSERT_EQ(Runs((coverages[0] - coverages[2]).GetRuns()), Runs(differenceExpected));
+    ASSERT_EQ(Runs(coverages[0].GetGaps(At(0), At(frames))), Runs(notExpected));
+    ASSERT_EQ(coverages[0] | coverages[1], coverages[1] | coverages[0]);
+    ASSERT_EQ((coverages[0] - coverages[1]) | (coverages[0] & coverages[1]), coverages[0]);
+}
+
+// Test that adding and removing frame by frame fills and clears chunks as ranges do
+TEST_F(FrameCoverageTests, FrameByFrame)
+{
+    FrameCoverage coverage(fps120);
+    FrameCoverage range(fps120);
+    range.Add(At(65536 - 10), At(2 * 65536 + 10));
+    for (int32_t frame = 65536 - 10; frame < 2 * 65536 + 10; frame++)
+    {
+        coverage.Add(At(frame));
+    }
+    ASSERT_EQ(coverage, range);
+    ASSERT_EQ(coverage.Count(), 65536 + 20);
+
+    // overlapping ranges only count the frames that change
+    coverage.Add(At(0), At(65536 - 5));
+    range.Add(At(0), At(65536 - 5));
+    ASSERT_EQ(coverage, range);
+    ASSERT_EQ(coverage.Count(), 2 * 65536 + 10);
+
+    for (int32_t frame = 0; frame < 2 * 65536 + 10; frame += 2)
+    {
+        coverage.Remove(At(frame), At(frame + 1));
+    }
+    ASSERT_EQ(coverage.Count(), 65536 + 5);
+    for (int32_t frame = 1; frame < 2 * 65536 + 10; frame += 2)
+    {
+        coverage.Remove(At(frame), At(frame + 1));
+    }
+    ASSERT_TRUE(coverage.IsEmpty());
+}
+
+// Test set algebra with whole chunks and with itself
+TEST_F(FrameCoverageTests, Algebra)
+{
+    FrameCoverage a(fps120);
+    FrameCoverage b(fps120);
+    a.Add(At(0), At(3 * 65536));
+    b.Add(At(65536 + 5), At(65536 + 7));
+    b.Add(At(5 * 65536), At(6 * 65536));
+
+    ASSERT_EQ((a & b).Count(), 2);
+    ASSERT_EQ((a | b).Count(), 4 * 65536);
+    ASSERT_EQ((a - b).Count(), 3 * 65536 - 2);
+    ASSERT_EQ((b - a).Count(), 65536);
+    ASSERT_EQ(Runs((a - b).GetRuns()),
+              (std::vector<std::pair<int32_t, int32_t>>{{0, 65541}, {65543, 3 * 65536}}));
+
+    FrameCoverage c = a;
+    c |= c;
+    ASSERT_EQ(c, a);
+    c &= c;
+    ASSERT_EQ(c, a);
+    c -= c;
+    ASSERT_TRUE(c.IsEmpty());
+    a.Remove(At(0), At(3 * 65536));
+    ASSERT_TRUE(a.IsEmpty());
+    ASSERT_NE(a, FrameCoverage(Framerate::FPS_25));
+    ASSERT_THROW(a |= FrameCoverage(Framerate::FPS_25), std::logic_error);
+}
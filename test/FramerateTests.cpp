@@ -26,6 +26,7 @@
 // WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <gtest/gtest.h>
+#include <string>
 #include <tcutils/Framerate.h>
 
 using namespace testing;
@@ -202,6 +203,83 @@ TEST_F(FramerateTests, IsDefined)
     ASSERT_FALSE(Framerate().IsDefined());
 }
 
+// Test constructing custom framerates from a Rational
+TEST_F(FramerateTests, FromRational)
+{
+    const Framerate fps47952(Rational(48000, 1001));
+    ASSERT_EQ(fps47952.GetEnum(), Framerate::CUSTOM);
+    ASSERT_EQ(fps47952.GetFrameCount(), 48);
+    ASSERT_TRUE(fps47952.IsRatio1001());
+    ASSERT_FALSE(fps47952.IsDrop());
+    ASSERT_TRUE(fps47952.IsHighFramerate());
+    ASSERT_TRUE(fps47952.IsDefined());
+    ASSERT_STREQ(fps47952.ToString(), "47.952");
+    ASSERT_NE(fps47952, Framerate(Framerate::FPS_48));
+    ASSERT_EQ(fps47952.ToRational().GetNumerator(), 48000);
+    ASSERT_EQ(fps47952.ToRational().GetDenominator(), 1001);
+
+    // clang-format off
+    ASSERT_EQ(Framerate(Rational(24000, 1001)),      Framerate(Framerate::FPS_23976));
+    ASSERT_EQ(Framerate(Rational(48000, 2002)),      Framerate(Framerate::FPS_23976));
+    ASSERT_EQ(Framerate(Rational(30000, 1001), true), Framerate(Framerate::FPS_2997DF));
+    ASSERT_EQ(Framerate(Rational(30), true),         Framerate(Framerate::FPS_30DF));
+    ASSERT_EQ(Framerate(Rational(120)),              Framerate(Framerate::FPS_120));
+    ASSERT_EQ(Framerate(Rational(72)),               Framerate("72"));
+    ASSERT_EQ(Framerate(Rational(60000, 1001)),      Framerate("59.94"));
+    ASSERT_EQ(Framerate(Rational(120000, 1001)),     Framerate(119.88));
+    ASSERT_EQ(Framerate(Rational(144)),              Framerate(144.0, false));
+    ASSERT_STREQ(Framerate(Rational(72)).ToString(),             "72");
+    ASSERT_STREQ(Framerate(Rational(60000, 1001)).ToString(),    "59.94");
+    ASSERT_STREQ(Framerate(Rational(120000, 1001)).ToString(),   "119.88");
+    ASSERT_STREQ(Framerate(Rational(240)).ToString(),            "240");
+    // clang-format on
+
+    ASSERT_EQ(Framerate(Rational(72)).GetEnum(), Framerate::CUSTOM);
+
+    // 1000/1001 ratios of frame counts with a factor 7, 11 or 13 in common with 1001
+    for (int64_t count : {7, 11, 13, 14, 28, 77, 91, 143, 286, 858, 924, 998})
+    {
+        const Framerate framerate(Rational(count * 1000, 1001));
+        ASSERT_EQ(framerate.GetFrameCount(), count);
+        ASSERT_TRUE(framerate.IsRatio1001());
+        ASSERT_EQ(framerate.ToRational().GetNumerator(), count * 1000);
+        ASSERT_EQ(framerate.ToRational().GetDenominator(), 1001);
+    }
+    ASSERT_EQ(Framerate(Rational(4000, 143)), Framerate(Rational(28000, 1001)));
+    ASSERT_EQ(Framerate(Rational(1000, 7)).GetFrameCount(), 143);
+    ASSERT_THROW(Framerate(Rational(999, 7)), Framerate::UnsupportedFramerate);
+    ASSERT_THROW(Framerate(Rational(1000000, 1001)), Framerate::UnsupportedFramerate);
+    ASSERT_EQ(Framerate(Framerate::FPS_2997).ToRational().GetNumerator(), 30000);
+    ASSERT_EQ(Framerate(Framerate::FPS_25).ToRational().GetDenominator(), 1);
+
+    ASSERT_THROW(Framerate(Rational(25, 2)), Framerate::UnsupportedFramerate);
+    ASSERT_THROW(Framerate(Rational(1000)), Framerate::UnsupportedFramerate);
+    ASSERT_THROW(Framerate(Rational(0)), Framerate::UnsupportedFramerate);
+    ASSERT_THROW(Framerate(Rational(-24)), Framerate::UnsupportedFramerate);
+    ASSERT_THROW(Framerate(Rational(60000, 1001), true), Framerate::UnsupportedFramerate);
+    ASSERT_THROW(Framerate(Rational(24), true), Framerate::UnsupportedFramerate);
+    ASSERT_THROW(Framerate("23.98"), Framerate::StringParseError);
+    ASSERT_ANY_THROW(Framerate(1000.0));
+}
+
+// Test that the names of all custom framerates parse back to the same framerate
+TEST_F(FramerateTests, CustomStringRoundTrip)
+{
+    for (int64_t count = 1; count <= Framerate::MAX_FRAME_COUNT; count++)
+    {
+        for (const Framerate framerate :
+             {Framerate(Rational(count)), Framerate(Rational(count * 1000, 1001))})
+        {
+            const std::string name = framerate.ToString();
+            ASSERT_EQ(Framerate(name), framerate) << name;
+            ASSERT_EQ(Framerate(std::stod(name)), framerate) << name;
+        }
+    }
+    ASSERT_STREQ(Framerate(Rational(997000, 1001)).ToString(), "996.004");
+    ASSERT_THROW(Framerate("0.4"), Framerate::StringParseError);
+    ASSERT_THROW(Framerate("999.5"), Framerate::StringParseError);
+}
+
 // Test iterator
 TEST_F(FramerateTests, IterateFramerates)
 {
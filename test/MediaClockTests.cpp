@@ -0,0 +1,172 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <gtest/gtest.h>
+#include <tcutils/MediaClock.h>
+#include <vector>
+
+using namespace testing;
+using namespace Dolby::TcUtils;
+
+// test MediaClock methods
+
+class MediaClockTests : public Test
+{
+};
+
+namespace
+{
+    // 2026-10-18 00:00:00 UTC in TAI nanoseconds since the PTP epoch
+    const int64_t midnight = (int64_t(20744) * 86400 + 37) * 1000000000;
+    // 12:34:56.5 later
+    const int64_t afternoon = midnight + (int64_t(12 * 3600 + 34 * 60 + 56) * 1000 + 500) * 1000000;
+}
+
+TEST_F(MediaClockTests, TimeOfDay)
+{
+    const Framerate df(Framerate::FPS_2997DF);
+    const Framerate fps25(Framerate::FPS_25);
+
+    // clang-format off
+    ASSERT_EQ(MediaClock(fps25).ToTimecode(afternoon),    Timecode(fps25, "12:34:56:12"));
+    ASSERT_EQ(MediaClock(df).ToTimecode(afternoon),       Timecode(df, "12:34:56;15"));
+    ASSERT_EQ(MediaClock(fps25).ToTimecode(midnight),     Timecode(fps25, "00:00:00:00"));
+    ASSERT_EQ(MediaClock(fps25).ToTimecode(midnight - 1), Timecode(fps25, "23:59:59:24"));
+    ASSERT_EQ(MediaClock(Framerate::FPS_120).ToTimecode(afternoon),
+              Timecode(Framerate::FPS_120, "12:34:56:060"));
+
+    // local time one hour ahead of UTC and a jam at 02:00 local time
+    ASSERT_EQ(MediaClock(Framerate::FPS_25, 37, 3600).ToTimecode(afternoon),
+              Timecode(Framerate::FPS_25, "13:34:56:12"));
+    ASSERT_EQ(MediaClock(Framerate::FPS_25, 37, 3600, 7200).ToTimecode(afternoon),
+              Timecode(Framerate::FPS_25, "11:34:56:12"));
+    // a leap second moves the jam
+    ASSERT_EQ(MediaClock(Framerate::FPS_25, 38).ToTimecode(afternoon),
+              Timecode(Framerate::FPS_25, "12:34:55:12"));
+    // clang-format on
+
+    ASSERT_THROW(MediaClock(Framerate::UNDEFINED), MediaClock::InvalidParameter);
+}
+
+TEST_F(MediaClockTests, DropFrameJam)
+{
+    const MediaClock clock(Framerate::FPS_2997DF);
+
+    // the jam is at the first frame starting at or after midnight: frame 53714734376 starts at
+    // 1792281637.0125333... seconds
+    const int64_t jamFrameCount = 53714734376;
+    ASSERT_EQ(clock.ToFrameCount(midnight), jamFrameCount - 1);
+    ASSERT_EQ(clock.GetJamFrameCount(jamFrameCount), jamFrameCount);
+    ASSERT_EQ(clock.GetJamFrameCount(jamFrameCount - 1), clock.GetJamFrameCount(jamFrameCount - 2));
+    ASSERT_EQ(clock.ToNanoseconds(jamFrameCount), midnight + 12533333);
+
+    const int64_t jam = clock.ToNanoseconds(jamFrameCount);
+    ASSERT_EQ(clock.ToTimecode(jam), Timecode(Framerate::FPS_2997DF, "00:00:00;00"));
+    ASSERT_EQ(clock.ToTimecode(jam + clock.ToNanoseconds(17982) - clock.ToNanoseconds(0)),
+              Timecode(Framerate::FPS_2997DF, "00:10:00;00"));
+
+    // a real-time day holds 2589410.6 frames at 29.97 fps, but the drop-frame counter counts
+    // 2589408 frames a day, so the counter wraps shortly before the jam
+    const int64_t previousJam = clock.GetJamFrameCount(jamFrameCount - 1);
+    ASSERT_EQ(jamFrameCount - previousJam, 2589410);
+    ASSERT_EQ(clock.ToTimecode(jam - 1), Timecode(Framerate::FPS_2997DF, "00:00:00;01"));
+}
+
+TEST_F(MediaClockTests, FrameCount)
+{
+    for (auto framerate : Framerate::values())
+    {
+        const MediaClock clock(framerate);
+        const int64_t frameCount = clock.ToFrameCount(afternoon);
+        for (int64_t n = frameCount; n < frameCount + 1000; n++)
+        {
+            const int64_t start = clock.ToNanoseconds(n);
+            ASSERT_EQ(clock.ToFrameCount(start), n);
+            ASSERT_EQ(clock.ToFrameCount(start - 1), n - 1);
+        }
+        ASSERT_LE(clock.ToNanoseconds(frameCount), afternoon);
+        ASSERT_GT(clock.ToNanoseconds(frameCount + 1), afternoon);
+    }
+}
+
+TEST_F(MediaClockTests, Rtp)
+{
+    const int64_t afternoonTicks = afternoon / 1000000 * 48;
+    ASSERT_EQ(MediaClock::ToRtpTimestamp(afternoon, 48000), uint32_t(afternoonTicks));
+    ASSERT_EQ(MediaClock::ToRtpTimestamp(1000000000, 90000), 90000u);
+    ASSERT_THROW(MediaClock::ToRtpTimestamp(0, 0), MediaClock::InvalidParameter);
+
+    // unwrapping selects the nearest tick count
+    ASSERT_EQ(MediaClock::UnwrapRtpTimestamp(0xFFFFFFF0u, 48000, 1000000000), -16);
+    for (uint32_t rtp : {0u, 16u, 0x7FFFFFFFu, 0x80000001u, 0xFFFFFFFFu})
+    {
+        const int64_t ticks = MediaClock::UnwrapRtpTimestamp(rtp, 48000, afternoon);
+        ASSERT_EQ(uint32_t(ticks), rtp);
+        ASSERT_LE(std::abs(ticks - afternoonTicks), int64_t(0x80000000));
+    }
+
+    // the RTP timestamp of a video frame is its start time truncated to the 90 kHz clock; at
+    // 23.976 fps frame N starts at N * 3753.75 ticks
+    const MediaClock clock(Framerate::FPS_23976);
+    const int64_t frameCount = clock.ToFrameCount(afternoon);
+    std::vector<uint32_t> rtpTimestamps;
+    std::vector<Timecode> expected;
+    for (int64_t n = frameCount; n < frameCount + 200; n++)
+    {
+        rtpTimestamps.push_back(static_cast<uint32_t>(n * 15015 / 4));
+        // the reference time is the arrival time, a few milliseconds later
+        const int64_t arrival = clock.ToNanoseconds(n) + 5000000;
+        const Timecode tc     = clock.ToTimecode(rtpTimestamps.back(), 90000, arrival);
+        ASSERT_EQ(tc, clock.ToTimecode(clock.ToNanoseconds(n)));
+        expected.push_back(tc);
+    }
+
+    std::vector<Timecode> timecodes(rtpTimestamps.size());
+    clock.ToTimecodes(
+        rtpTimestamps.data(), rtpTimestamps.size(), 90000, afternoon, timecodes.data());
+    ASSERT_EQ(timecodes, expected);
+}
+
+TEST_F(MediaClockTests, ArrayAcrossJam)
+{
+    for (auto framerate : Framerate::values())
+    {
+        const MediaClock clock(framerate, 37, -5 * 3600);
+        std::vector<int64_t> times;
+        for (int64_t t = midnight - 86400000000000LL; t < midnight + 86400000000000LL;
+             t += 3599999999)
+        {
+            times.push_back(t);
+        }
+        std::vector<Timecode> timecodes(times.size());
+        clock.ToTimecodes(times.data(), times.size(), timecodes.data());
+        for (size_t i = 0; i < times.size(); i++)
+        {
+            ASSERT_EQ(timecodes[i], clock.ToTimecode(times[i]));
+        }
+    }
+}
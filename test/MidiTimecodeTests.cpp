@@ -0,0 +1,245 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <gtest/gtest.h>
+#include <tcutils/MidiTimecode.h>
+#include <vector>
+
+using namespace testing;
+using namespace Dolby::TcUtils;
+
+// test MidiTimecode methods
+
+class MidiTimecodeTests : public Test
+{
+};
+
+TEST_F(MidiTimecodeTests, WriteMessages)
+{
+    uint8_t buffer[MidiTimecode::FULL_FRAME_SIZE];
+
+    const Timecode tc(Framerate::FPS_2997DF, "17:42:33;21");
+    const uint8_t expectedQuarterFrames[8] = {0x05, 0x11, 0x21, 0x32, 0x4A, 0x52, 0x61, 0x75};
+    for (int piece = 0; piece < 8; piece++)
+    {
+        ASSERT_EQ(MidiTimecode::WriteQuarterFrame(tc, piece, buffer, sizeof(buffer)), 2u);
+        ASSERT_EQ(buffer[0], 0xF1);
+        ASSERT_EQ(buffer[1], expectedQuarterFrames[piece]);
+    }
+    ASSERT_EQ(MidiTimecode::WriteQuarterFrame(tc, 0, buffer, 1), 0u);
+    ASSERT_THROW(MidiTimecode::WriteQuarterFrame(tc, 8, buffer, sizeof(buffer)),
+                 Timecode::ValueOutOfRange);
+
+    const uint8_t expectedFullFrame[] = {0xF0, 0x7F, 0x7F, 0x01, 0x01, 0x51, 42, 33, 21, 0xF7};
+    ASSERT_EQ(MidiTimecode::WriteFullFrame(tc, buffer, sizeof(buffer)), sizeof(buffer));
+    ASSERT_EQ(std::vector<uint8_t>(buffer, buffer + sizeof(buffer)),
+              std::vector<uint8_t>(expectedFullFrame, expectedFullFrame + sizeof(buffer)));
+    ASSERT_EQ(MidiTimecode::WriteFullFrame(tc, buffer, sizeof(buffer) - 1), 0u);
+
+    // clang-format off
+    ASSERT_EQ(MidiTimecode::ToRateCode(Framerate::FPS_23976),  MidiTimecode::RATE_24);
+    ASSERT_EQ(MidiTimecode::ToRateCode(Framerate::FPS_25),     MidiTimecode::RATE_25);
+    ASSERT_EQ(MidiTimecode::ToRateCode(Framerate::FPS_2997),   MidiTimecode::RATE_30);
+    ASSERT_THROW(MidiTimecode::ToRateCode(Framerate::FPS_30DF), MidiTimecode::UnsupportedFramerate);
+    ASSERT_THROW(MidiTimecode::ToRateCode(Framerate::FPS_50),   MidiTimecode::UnsupportedFramerate);
+    // clang-format on
+}
+
+TEST_F(MidiTimecodeTests, ParseFullFrame)
+{
+    MidiTimecode::Parser parser(Framerate::FPS_23976);
+
+    // real-time bytes interleaved with the message are ignored
+    const uint8_t data[] = {0x90, 0x40, 0xF0, 0x7F, 0x01, 0x01, 0xF8, 0x01, 0x17, 0x3B, 0x3B, 0x17,
+                            0xF7, 0xF0, 0x7F, 0x01, 0x01, 0x01, 0x20, 0x00, 0x00, 0x00, 0xF7};
+    ASSERT_EQ(parser.Parse(data, sizeof(data)), 13u);
+    ASSERT_TRUE(parser.IsUpdated());
+    ASSERT_TRUE(parser.IsFullFrame());
+    ASSERT_EQ(parser.GetTimecode(), Timecode(Framerate::FPS_23976, "23:59:59:23"));
+
+    ASSERT_EQ(parser.Parse(data + 13, sizeof(data) - 13), sizeof(data) - 13);
+    ASSERT_TRUE(parser.IsUpdated());
+    ASSERT_EQ(parser.GetTimecode(), Timecode(Framerate::FPS_25, "00:00:00:00"));
+
+    // invalid values, other SysEx messages and truncated messages are ignored
+    const uint8_t invalid[] = {0xF0, 0x7F, 0x01, 0x01, 0x01, 0x18, 0x00, 0x00, 0x00, 0xF7,
+                               0xF0, 0x7F, 0x01, 0x01, 0x01, 0x40, 0x01, 0x00, 0x00, 0xF7,
+                               0xF0, 0x7F, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF7,
+                               0xF0, 0x7F, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0xF7,
+                               0xF0, 0x7F, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7};
+    ASSERT_EQ(parser.Parse(invalid, sizeof(invalid)), sizeof(invalid));
+    ASSERT_FALSE(parser.IsUpdated());
+    ASSERT_EQ(parser.GetTimecode(), Timecode(Framerate::FPS_25, "00:00:00:00"));
+}
+
+TEST_F(MidiTimecodeTests, ParseQuarterFrames)
+{
+    MidiTimecode::Parser parser;
+    const Timecode tc(Framerate::FPS_2997DF, "00:00:59;28");
+
+    std::vector<uint8_t> data;
+    for (Timecode sequence = tc; sequence != Timecode(Framerate::FPS_2997DF, "00:01:00;06");)
+    {
+        for (int piece = 0; piece < 8; piece++)
+        {
+            uint8_t message[2];
+            MidiTimecode::WriteQuarterFrame(sequence, piece, message, sizeof(message));
+            data.push_back(message[0]);
+            data.push_back(message[1]);
+            // real-time clock bytes in between
+            data.push_back(0xF8);
+        }
+        ++sequence;
+        ++sequence;
+    }
+
+    // the first update is at the last piece of the first sequence, compensated by two frames;
+    // after that, an update follows each frame
+    std::vector<Timecode> updates;
+    const uint8_t* position = data.data();
+    size_t remaining        = data.size();
+    while (remaining > 0)
+    {
+        const size_t consumed = parser.Parse(position, remaining);
+        if (parser.IsUpdated())
+        {
+            ASSERT_FALSE(parser.IsFullFrame());
+            updates.push_back(parser.GetTimecode());
+        }
+        position += consumed;
+        remaining -= consumed;
+    }
+    const std::vector<Timecode> expected = {Timecode(Framerate::FPS_2997DF, "00:01:00;02"),
+                                            Timecode(Framerate::FPS_2997DF, "00:01:00;03"),
+                                            Timecode(Framerate::FPS_2997DF, "00:01:00;04"),
+                                            Timecode(Framerate::FPS_2997DF, "00:01:00;05"),
+                                            Timecode(Framerate::FPS_2997DF, "00:01:00;06")};
+    ASSERT_EQ(updates, expected);
+
+    // pieces in reverse order (rewinding) are not assembled, and unlock the parser
+    parser.Reset();
+    for (int piece = 7; piece >= 0; piece--)
+    {
+        uint8_t message[2];
+        MidiTimecode::WriteQuarterFrame(tc, piece, message, sizeof(message));
+        ASSERT_FALSE(parser.Parse(message[0]));
+        ASSERT_FALSE(parser.Parse(message[1]));
+    }
+    // a data byte without the F1 status byte is ignored
+    ASSERT_FALSE(parser.Parse(0x00));
+}
+
+TEST_F(MidiTimecodeTests, GeneratorPositions)
+{
+    const Timecode start(Framerate::FPS_2997, "00:59:59:25");
+    const Samplerate samplerate(48000);
+    MidiTimecode::Generator generator(start, samplerate);
+
+    // generate 10 seconds (rounded up to whole blocks) in blocks of 512 samples
+    std::vector<int64_t> positions;
+    std::vector<uint8_t> data;
+    MidiTimecode::Generator::Message messages[4];
+    for (int64_t block = 0; block < 480000; block += 512)
+    {
+        const size_t count = generator.Generate(Samples(block), 512, messages, 4);
+        for (size_t i = 0; i < count; i++)
+        {
+            ASSERT_GE(messages[i].sampleOffset, 0);
+            ASSERT_LT(messages[i].sampleOffset, 512);
+            positions.push_back(block + messages[i].sampleOffset);
+            data.push_back(messages[i].bytes[0]);
+            data.push_back(messages[i].bytes[1]);
+        }
+    }
+
+    // frame boundaries are 1601.6 samples apart (starting on a sample), rounded to the nearest
+    // sample; quarter frames divide each frame and are also rounded to the nearest sample
+    auto boundary = [](int64_t frame) { return (frame * 16016 + 5) / 10; };
+    auto quarter  = [&](int64_t i) {
+        const int64_t frame = i / 4;
+        return boundary(frame) + ((i % 4) * (boundary(frame + 1) - boundary(frame)) + 2) / 4;
+    };
+    ASSERT_EQ(positions.size(), 1200u);
+    for (size_t i = 0; i < positions.size(); i++)
+    {
+        ASSERT_EQ(positions[i], quarter(static_cast<int64_t>(i)));
+    }
+
+    // the parser follows the generator, with an update at the start of each frame
+    MidiTimecode::Parser parser(Framerate::FPS_24, Framerate::FPS_2997);
+    Timecode expected = start;
+    ++expected;
+    for (size_t i = 0; i < positions.size(); i++)
+    {
+        parser.Parse(data[2 * i]);
+        if (parser.Parse(data[2 * i + 1]))
+        {
+            ASSERT_EQ(i % 4, 3u);
+            ++expected;
+            ASSERT_EQ(parser.GetTimecode(), expected);
+            const int64_t samples = expected.ToSamples(samplerate).GetValue() -
+                                    start.ToSamples(samplerate).GetValue();
+            ASSERT_EQ(samples, quarter(static_cast<int64_t>(i + 1)));
+        }
+    }
+    ASSERT_EQ(expected, Timecode(Framerate::FPS_2997, "01:00:09:25"));
+}
+
+TEST_F(MidiTimecodeTests, GeneratorSeek)
+{
+    const Timecode start(Framerate::FPS_25, "23:59:59:24");
+    MidiTimecode::Generator generator(start, Samplerate(48000));
+    MidiTimecode::Generator::Message messages[8];
+
+    // quarter frames every 480 samples; seeking into the middle of a sequence
+    ASSERT_EQ(generator.Generate(Samples(2000), 1000, messages, 8), 2u);
+    ASSERT_EQ(messages[0].sampleOffset, 400);
+    ASSERT_EQ(messages[0].bytes[1], 0x53);
+    ASSERT_EQ(messages[1].sampleOffset, 880);
+    ASSERT_EQ(messages[1].bytes[1], 0x67);
+
+    // the next block continues; the second sequence encodes 00:00:00:01, wrapped at midnight
+    ASSERT_EQ(generator.Generate(Samples(3000), 1000, messages, 8), 2u);
+    ASSERT_EQ(messages[0].sampleOffset, 360);
+    ASSERT_EQ(messages[0].bytes[1], 0x73);
+    ASSERT_EQ(messages[1].sampleOffset, 840);
+    ASSERT_EQ(messages[1].bytes[1], 0x01);
+
+    // limited message space continues after the last written message
+    ASSERT_EQ(generator.Generate(Samples(0), 4000, messages, 3), 3u);
+    ASSERT_EQ(messages[2].sampleOffset, 960);
+    ASSERT_EQ(generator.Generate(Samples(961), 3039, messages, 8), 6u);
+    ASSERT_EQ(messages[0].sampleOffset, 479);
+    ASSERT_EQ(messages[0].bytes[1], 0x33);
+    ASSERT_EQ(generator.Generate(Samples(0), 4000, messages, 0), 0u);
+
+    const Timecode unsupported(Framerate::FPS_48, "00:00:00:00");
+    ASSERT_THROW(MidiTimecode::Generator(unsupported, Samplerate(48000)),
+                 MidiTimecode::UnsupportedFramerate);
+    ASSERT_THROW(MidiTimecode::Generator(Timecode(Framerate::FPS_25), Samplerate(48000)),
+                 Timecode::ValueOutOfRange);
+}
@@ -0,0 +1,148 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include <tcutils/PiecewiseTimecodeMap.h>
+#include <tcutils/TimecodeDuration.h>
+
+using namespace testing;
+using namespace Dolby::TcUtils;
+
+class PiecewiseTimecodeMapTests : public Test
+{
+};
+
+// Test a recording with a jump, a framerate change and a restart, fed per frame with jitter
+TEST_F(PiecewiseTimecodeMapTests, Segments)
+{
+    const Framerate fps25(Framerate::FPS_25);
+    const Framerate fps2997DF(Framerate::FPS_2997DF);
+    PiecewiseTimecodeMap map(Samplerate(48000));
+
+    std::mt19937 random(41);
+    std::uniform_int_distribution<int64_t> jitter(-100, 100);
+    struct Part
+    {
+        int64_t start;
+        Timecode timecode;
+        int64_t frames;
+        int64_t samplesPerFrame;
+    };
+    // 29.97 fps frames are 1601.6 samples; feed only frames that start on a sample
+    const Part parts[] = {{0, Timecode(fps25, "01:00:00:00"), 250, 1920},
+                          {480000, Timecode(fps25, "10:00:00:00"), 250, 1920},
+                          {960000, Timecode(fps2997DF, "10:00:10;00"), 50, 8008},
+                          {1400000, Timecode(fps25, "01:00:05:00"), 250, 1920}};
+    for (const Part& part : parts)
+    {
+        for (int64_t frame = 0; frame < part.frames; frame++)
+        {
+            const TimecodeDuration offset(part.timecode.GetFramerate(),
+                                          frame * (part.samplesPerFrame == 8008 ? 5 : 1));
+            const int64_t position = part.start + frame * part.samplesPerFrame +
+                                     (frame == 0 ? 0 : jitter(random));
+            ASSERT_EQ(map.AddAnchor(Samples(position), part.timecode + offset), frame == 0);
+        }
+    }
+    ASSERT_EQ(map.GetSegmentCount(), 4u);
+    ASSERT_EQ(map.GetSegment(2).start.GetValue(), 960000);
+    ASSERT_EQ(map.GetSegment(2).timecode.ToString(), "10:00:10;00");
+
+    // clang-format off
+    ASSERT_FALSE(map.ToTimecode(Samples(-1)).IsValid());
+    ASSERT_EQ(map.ToTimecode(Samples(0)).ToString(),                   "01:00:00:00");
+    ASSERT_EQ(map.ToTimecode(Samples(1919)).ToString(),                "01:00:00:00");
+    ASSERT_EQ(map.ToTimecode(Samples(1920)).ToString(),                "01:00:00:01");
+    ASSERT_EQ(map.ToTimecode(Samples(479999)).ToString(),              "01:00:09:24");
+    ASSERT_EQ(map.ToTimecode(Samples(480000)).ToString(),              "10:00:00:00");
+    ASSERT_EQ(map.ToTimecode(Samples(960000 + 1601)).ToString(),       "10:00:10;00");
+    ASSERT_EQ(map.ToTimecode(Samples(960000 + 1602)).ToString(),       "10:00:10;01");
+    ASSERT_EQ(map.ToTimecode(Samples(960000 + 48048)).ToString(),      "10:00:11;00");
+    ASSERT_EQ(map.ToTimecode(Samples(1400000)).ToString(),             "01:00:05:00");
+    ASSERT_EQ(map.ToTimecode(Samples(1400000 + 48000 * 3600)).ToString(), "02:00:05:00");
+    // clang-format on
+
+    // 01:00:05:00 occurs in the first segment and after the restart
+    std::vector<int64_t> samples;
+    map.ToSamples(Timecode(fps25, "01:00:05:00"), samples);
+    ASSERT_EQ(samples, (std::vector<int64_t>{240000, 1400000}));
+    samples.clear();
+    map.ToSamples(Timecode(fps2997DF, "10:00:10;02"), samples);
+    ASSERT_EQ(samples, (std::vector<int64_t>{960000 + 3203}));
+
+    // bulk lookup is the same as lookup per position
+    std::vector<int64_t> positions;
+    for (int64_t position = -5000; position < 2000000; position += 997)
+    {
+        positions.push_back(position);
+    }
+    positions.push_back(10);
+    positions.push_back(1500000);
+    std::vector<Timecode> timecodes(positions.size());
+    map.ToTimecodes(positions.data(), positions.size(), timecodes.data());
+    for (size_t i = 0; i < positions.size(); i++)
+    {
+        ASSERT_EQ(timecodes[i], map.ToTimecode(Samples(positions[i])));
+    }
+
+    // without an end, the last segment reaches every timecode of the day
+    samples.clear();
+    map.ToSamples(Timecode(fps25, "00:59:59:24"), samples);
+    ASSERT_EQ(samples.size(), 1u);
+    map.SetEnd(Samples(2000000));
+    ASSERT_FALSE(map.ToTimecode(Samples(2000000)).IsValid());
+    samples.clear();
+    map.ToSamples(Timecode(fps25, "00:59:59:24"), samples);
+    ASSERT_TRUE(samples.empty());
+    ASSERT_THROW(map.AddAnchor(Samples(2000000), Timecode(fps25, "00:00:00:00")),
+                 PiecewiseTimecodeMap::UnorderedAnchor);
+}
+
+// Test labels that repeat within a segment of more than a day, and invalid use
+TEST_F(PiecewiseTimecodeMapTests, RepeatedLabels)
+{
+    PiecewiseTimecodeMap map(Samplerate(48000));
+    ASSERT_FALSE(map.ToTimecode(Samples(0)).IsValid());
+    map.AddAnchor(Samples(0), Timecode(Framerate::FPS_24, "23:00:00:00"));
+    map.SetEnd(Samples(int64_t(48000) * 3600 * 50));
+
+    std::vector<int64_t> samples;
+    map.ToSamples(Timecode(Framerate::FPS_24, "23:30:00:00"), samples);
+    ASSERT_EQ(samples,
+              (std::vector<int64_t>{int64_t(48000) * 1800,
+                                    int64_t(48000) * (1800 + 24 * 3600),
+                                    int64_t(48000) * (1800 + 48 * 3600)}));
+    ASSERT_EQ(map.ToTimecode(Samples(int64_t(48000) * 3600)).ToString(), "00:00:00:00");
+
+    ASSERT_THROW(map.AddAnchor(Samples(0), Timecode(Framerate::FPS_24, "00:00:00:00")),
+                 PiecewiseTimecodeMap::UnorderedAnchor);
+    ASSERT_THROW(map.AddAnchor(Samples(10), Timecode(Framerate::FPS_24)),
+                 Timecode::ValueOutOfRange);
+    ASSERT_THROW(PiecewiseTimecodeMap(Samplerate(0)), PiecewiseTimecodeMap::InvalidParameter);
+}
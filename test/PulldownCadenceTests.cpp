@@ -0,0 +1,130 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <gtest/gtest.h>
+#include <tcutils/PulldownCadence.h>
+#include <vector>
+
+using namespace testing;
+using namespace Dolby::TcUtils;
+
+// test PulldownCadence methods
+
+class PulldownCadenceTests : public Test
+{
+};
+
+TEST_F(PulldownCadenceTests, Cadence)
+{
+    typedef PulldownCadence::Phase Phase;
+    typedef PulldownCadence::Field Field;
+    const Framerate film(Framerate::FPS_23976);
+    const Framerate ntsc(Framerate::FPS_2997);
+    const PulldownCadence cadence(Timecode(film, "01:00:00:00"), Timecode(ntsc, "01:00:00:00"));
+
+    // clang-format off
+    ASSERT_EQ(cadence.ToVideo(Timecode(film, "01:00:00:01")),      Timecode(ntsc, "01:00:00:01"));
+    ASSERT_EQ(cadence.ToVideo(Timecode(film, "01:00:00:03")),      Timecode(ntsc, "01:00:00:03"));
+    ASSERT_EQ(cadence.ToVideo(Timecode(film, "01:00:00:04")),      Timecode(ntsc, "01:00:00:05"));
+    ASSERT_EQ(cadence.ToVideo(Timecode(film, "01:00:01:00")),      Timecode(ntsc, "01:00:01:00"));
+    ASSERT_EQ(cadence.ToVideo(Timecode(film, "00:59:59:23")),      Timecode(ntsc, "00:59:59:28"));
+    ASSERT_EQ(cadence.ToFilm(Timecode(ntsc, "01:00:00:02")),       Timecode(film, "01:00:00:01"));
+    ASSERT_EQ(cadence.ToFilm(Timecode(ntsc, "01:00:00:02"), Field::SECOND),
+              Timecode(film, "01:00:00:02"));
+    ASSERT_EQ(cadence.GetPhase(Timecode(film, "01:00:00:02")),     Phase::C);
+    ASSERT_EQ(cadence.GetPhase(Timecode(film, "00:59:59:23")),     Phase::D);
+    ASSERT_EQ(cadence.GetFirstField(Timecode(film, "01:00:00:01")), Field::FIRST);
+    ASSERT_EQ(cadence.GetFirstField(Timecode(film, "01:00:00:02")), Field::SECOND);
+    ASSERT_EQ(cadence.GetFieldCount(Timecode(film, "01:00:00:01")), 3);
+    ASSERT_TRUE(cadence.IsSplitFrame(Timecode(ntsc, "01:00:00:03")));
+    ASSERT_FALSE(cadence.IsSplitFrame(Timecode(ntsc, "01:00:00:04")));
+    // wraps at midnight
+    ASSERT_EQ(PulldownCadence(Timecode(film, "23:59:59:20"), Timecode(ntsc, "23:59:59:29"))
+                  .ToVideo(Timecode(film, "23:59:59:23")),
+              Timecode(ntsc, "00:00:00:02"));
+    // clang-format on
+
+    ASSERT_THROW(PulldownCadence(Timecode(ntsc, "01:00:00:00"), Timecode(ntsc, "01:00:00:00")),
+                 PulldownCadence::InvalidFramerate);
+    ASSERT_THROW(PulldownCadence(Timecode(Framerate::FPS_24, "01:00:00:00"),
+                                 Timecode(ntsc, "01:00:00:00")),
+                 PulldownCadence::InvalidFramerate);
+    ASSERT_THROW(cadence.ToVideo(Timecode(ntsc, "01:00:00:00")), PulldownCadence::InvalidFramerate);
+    ASSERT_FALSE(cadence.ToVideo(Timecode(film)).IsSet());
+}
+
+TEST_F(PulldownCadenceTests, DropFrame)
+{
+    const Framerate film(Framerate::FPS_23976);
+    const Framerate df(Framerate::FPS_2997DF);
+    const PulldownCadence cadence(Timecode(film, "01:00:00:00"), Timecode(df, "01:00:00;00"));
+
+    // 10 minutes of film are 18000 video frames, 18 frames after 01:10:00;00 drop-frame
+    ASSERT_EQ(cadence.ToVideo(Timecode(film, "01:10:00:00")), Timecode(df, "01:10:00;18"));
+    ASSERT_EQ(cadence.ToFilm(Timecode(df, "01:10:00;18")), Timecode(film, "01:10:00:00"));
+}
+
+TEST_F(PulldownCadenceTests, Fields)
+{
+    const Framerate film(Framerate::FPS_23976);
+    const Framerate df(Framerate::FPS_2997DF);
+    const PulldownCadence cadence(Timecode(film, "00:59:59:22"), Timecode(df, "01:00:00;03"));
+
+    // every film frame covers 2 or 3 consecutive fields, in order
+    std::vector<Timecode> films;
+    Timecode tc(film, "01:00:00:00");
+    for (int i = 0; i < 100000; i++, ++tc)
+    {
+        films.push_back(tc);
+    }
+    std::vector<Timecode> videos(films.size());
+    cadence.ToVideo(films.data(), films.size(), videos.data());
+
+    int64_t nextField = -1;
+    for (size_t i = 0; i < films.size(); i++)
+    {
+        ASSERT_EQ(videos[i], cadence.ToVideo(films[i]));
+        const int64_t firstField = int64_t(videos[i].ToFrames().GetValue()) * 2 +
+                                   static_cast<int>(cadence.GetFirstField(films[i]));
+        if (nextField >= 0)
+        {
+            ASSERT_EQ(firstField, nextField);
+        }
+        nextField = firstField + cadence.GetFieldCount(films[i]);
+        for (int64_t field = firstField; field < nextField; field++)
+        {
+            const Timecode video(df, Frames(static_cast<int32_t>(field / 2)));
+            ASSERT_EQ(cadence.ToFilm(video, static_cast<PulldownCadence::Field>(field % 2)),
+                      films[i]);
+        }
+    }
+
+    // the first video frame of each film frame shows it in its second field
+    std::vector<Timecode> back(videos.size());
+    cadence.ToFilm(videos.data(), videos.size(), back.data(), PulldownCadence::Field::SECOND);
+    ASSERT_EQ(back, films);
+}
@@ -0,0 +1,142 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <gtest/gtest.h>
+#include <tcutils/AbsoluteFrames.h>
+#include <tcutils/SampleRemapper.h>
+#include <vector>
+
+using namespace testing;
+using namespace Dolby::TcUtils;
+
+// test SampleRemapper methods
+
+class SampleRemapperTests : public Test
+{
+};
+
+TEST_F(SampleRemapperTests, Remap)
+{
+    typedef SampleRemapper::Pull Pull;
+    const Samplerate sr44(44100.0);
+    const Samplerate sr48(48000.0);
+
+    // clang-format off
+    ASSERT_EQ(SampleRemapper(sr48, Samplerate(96000.0)).Remap(Samples(12345)), Samples(24690));
+    ASSERT_EQ(SampleRemapper(sr44, sr48).Remap(Samples(44100)),                 Samples(48000));
+    ASSERT_EQ(SampleRemapper(sr44, sr48).Remap(Samples(3)),                     Samples(3));
+    ASSERT_EQ(SampleRemapper(sr44, sr48).Remap(Samples(6)),                     Samples(7));
+    ASSERT_EQ(SampleRemapper(sr44, sr48, Pull::NONE, RoundingMode::TRUNCATE).Remap(Samples(6)),
+              Samples(6));
+    ASSERT_EQ(SampleRemapper(sr48, sr48, Pull::DOWN).Remap(Samples(48000)),     Samples(48048));
+    ASSERT_EQ(SampleRemapper(sr48, sr48, Pull::UP).Remap(Samples(48048)),       Samples(48000));
+    ASSERT_EQ(SampleRemapper(sr48, sr48, Pull::UP).Remap(Samples(-48048)),      Samples(-48000));
+    // 48.048 kHz is 48 kHz pulled up; a day of samples remapped without drift
+    ASSERT_EQ(SampleRemapper(Samplerate(48048.0), sr48, Pull::DOWN)
+                  .Remap(Samples(int64_t(48048) * 86400)),
+              Samples(int64_t(48048) * 86400));
+    ASSERT_EQ(SampleRemapper(Samplerate(48000.0 / 1.001), sr48).Remap(Samples(48000 * 3600)),
+              Samples(int64_t(48048) * 3600));
+    // clang-format on
+
+    ASSERT_THROW(SampleRemapper(Samplerate(0.0), sr48), SampleRemapper::InvalidParameter);
+    ASSERT_THROW(SampleRemapper(sr48, sr48, Pull::DOWN, Framerate::UNDEFINED),
+                 SampleRemapper::InvalidParameter);
+}
+
+TEST_F(SampleRemapperTests, FrameAligned)
+{
+    typedef SampleRemapper::Pull Pull;
+    struct Case
+    {
+        Framerate from;
+        Pull pull;
+        Framerate to;
+    };
+    const Case cases[] = {{Framerate::FPS_24, Pull::DOWN, Framerate::FPS_23976},
+                          {Framerate::FPS_23976, Pull::UP, Framerate::FPS_24},
+                          {Framerate::FPS_30, Pull::DOWN, Framerate::FPS_2997},
+                          {Framerate::FPS_25, Pull::NONE, Framerate::FPS_25}};
+    const Samplerate samplerates[] = {Samplerate(44100.0), Samplerate(48000.0),
+                                      Samplerate(96000.0 / 1.001)};
+
+    for (const Case& c : cases)
+    {
+        for (const Samplerate from : samplerates)
+        {
+            for (const Samplerate to : samplerates)
+            {
+                const SampleRemapper remapper(from, to, c.pull, c.from);
+                const SampleRemapper inverse = remapper.Inverse();
+                int64_t previous             = 0;
+                for (int64_t frame = 0; frame < 2000; frame++)
+                {
+                    const Samples start = AbsoluteFrames(c.from, frame).ToSamples(from);
+                    const Samples end   = AbsoluteFrames(c.from, frame + 1).ToSamples(from);
+                    const Samples expected = AbsoluteFrames(c.to, frame).ToSamples(to);
+                    ASSERT_EQ(remapper.Remap(start), expected);
+                    ASSERT_EQ(inverse.Remap(expected), start);
+                    for (int64_t samples = start.GetValue(); samples < end.GetValue(); samples++)
+                    {
+                        const int64_t remapped = remapper.Remap(Samples(samples)).GetValue();
+                        ASSERT_GE(remapped, previous);
+                        previous = remapped;
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_F(SampleRemapperTests, Batch)
+{
+    typedef SampleRemapper::Pull Pull;
+    std::vector<int64_t> samples;
+    for (int64_t s = -1000000; s < 1000000; s += 997)
+    {
+        samples.push_back(s * 1237);
+    }
+    std::vector<int64_t> large(samples);
+    large.push_back(int64_t(1) << 55);
+
+    const SampleRemapper remappers[] = {
+        SampleRemapper(Samplerate(44100.0), Samplerate(48000.0 / 1.001), Pull::DOWN),
+        SampleRemapper(Samplerate(48000.0), Samplerate(96000.0), Pull::UP, RoundingMode::TRUNCATE),
+        SampleRemapper(Samplerate(48000.0), Samplerate(44100.0), Pull::NONE, Framerate::FPS_25)};
+    for (const SampleRemapper& remapper : remappers)
+    {
+        for (const std::vector<int64_t>* input : {&samples, &large})
+        {
+            std::vector<int64_t> remapped(input->size());
+            remapper.Remap(input->data(), input->size(), remapped.data());
+            for (size_t i = 0; i < input->size(); i++)
+            {
+                ASSERT_EQ(Samples(remapped[i]), remapper.Remap(Samples((*input)[i])));
+            }
+        }
+    }
+}
@@ -0,0 +1,134 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <gtest/gtest.h>
+#include <vector>
+#include <tcutils/SessionTimeline.h>
+
+using namespace testing;
+using namespace Dolby::TcUtils;
+
+class SessionTimelineTests : public Test
+{
+};
+
+// Test that the timeline matches counting from 00:00:00:00 with Timecode::ToSamples
+TEST_F(SessionTimelineTests, MatchesTimecode)
+{
+    const Samplerate samplerate(48000);
+    for (Framerate framerate : Framerate::Range())
+    {
+        const Timecode start(framerate, 0, 59, 50, 0);
+        const SessionTimeline timeline(start, samplerate);
+        const int64_t origin = start.ToSamples(samplerate).GetValue();
+        ASSERT_EQ(timeline.ToTimecode(Samples(0)), start);
+        ASSERT_EQ(timeline.ToSamples(start).GetValue(), 0);
+
+        Timecode timecode = start;
+        for (int i = 0; i < 2000; i++, ++timecode)
+        {
+            const int64_t samples = timecode.ToSamples(samplerate).GetValue() - origin;
+            ASSERT_EQ(timeline.ToSamples(timecode).GetValue(), samples) << timecode;
+            ASSERT_EQ(timeline.ToTimecode(Samples(samples)), timecode);
+            ASSERT_EQ(timeline.ToTimecode(Samples(samples - 1)), Timecode(timecode).operator--());
+            ASSERT_EQ(timeline.ToSamples(timeline.ToDAMFSeconds(Samples(samples))).GetValue(),
+                      samples);
+            ASSERT_NEAR(timeline.ToDAMFSeconds(Samples(samples)).GetValue(),
+                        timecode.ToDAMFSeconds().GetValue(),
+                        1e-9);
+        }
+    }
+}
+
+// Test sessions across midnight
+TEST_F(SessionTimelineTests, Midnight)
+{
+    const Framerate framerate(Framerate::FPS_2997DF);
+    const Samplerate samplerate(48000);
+    const SessionTimeline wrapping(Timecode(framerate, "23:59:50;00"), samplerate);
+    const SessionTimeline continuing(
+        Timecode(framerate, "23:59:50;00", WrapMode::CONTINUE), samplerate);
+
+    // 10 seconds of 29.97 DF timecode are 300 frames of 1601.6 samples
+    // clang-format off
+    ASSERT_EQ(wrapping.ToTimecode(Samples(480480)).ToString(),                     "00:00:00;00");
+    ASSERT_EQ(continuing.ToTimecode(Samples(480480)).ToString(),                   "24:00:00;00");
+    ASSERT_EQ(wrapping.ToSamples(Timecode(framerate, "00:00:05;00")).GetValue(),   720720);
+    ASSERT_EQ(continuing.ToSamples(Timecode(framerate, "23:59:49;29")).GetValue(), -1602);
+    ASSERT_EQ(wrapping.ToTimecode(Samples(-1)).ToString(),                         "23:59:49;29");
+    ASSERT_EQ(wrapping.ToDAMFSeconds(Samples(480480)).GetValue(),                  0.0);
+    ASSERT_EQ(wrapping.ToSamples(DAMFSeconds(5.0)).GetValue(),                     720720);
+    ASSERT_NEAR(wrapping.ToDAMFSeconds(Samples(480480 + 800)).GetValue(),         0.5 / 30, 1e-4);
+    // clang-format on
+
+    // the timecode before the start is nearly a day later when wrapping
+    const Samples beforeStart = wrapping.ToSamples(Timecode(framerate, "23:59:49;29"));
+    ASSERT_GT(beforeStart.GetValue(), int64_t(48000) * 86300);
+    ASSERT_EQ(wrapping.ToTimecode(beforeStart).ToString(), "23:59:49;29");
+
+    ASSERT_THROW(continuing.ToTimecode(Samples(int64_t(-48000) * 86400)),
+                 Timecode::ValueOutOfRange);
+    ASSERT_THROW(wrapping.ToSamples(Timecode(Framerate::FPS_30, "00:00:00:00")), std::logic_error);
+    ASSERT_THROW(SessionTimeline(Timecode(framerate), samplerate),
+                 SessionTimeline::InvalidParameter);
+    ASSERT_THROW(SessionTimeline(Timecode(framerate, "01:00:00;00"), Samplerate(-1)),
+                 SessionTimeline::InvalidParameter);
+}
+
+// Test that the batch conversions match the conversions of single values
+TEST_F(SessionTimelineTests, Batch)
+{
+    const SessionTimeline timeline(Timecode(Framerate::FPS_23976, "23:59:00:00"),
+                                   Samplerate(96000));
+    std::vector<int64_t> samples;
+    for (int64_t position = -100000; position < 20000000; position += 77777)
+    {
+        samples.push_back(position);
+    }
+    const size_t count = samples.size();
+    std::vector<Timecode> timecodes(count);
+    std::vector<double> seconds(count);
+    std::vector<int64_t> starts(count);
+    std::vector<DAMFSeconds> damfSeconds;
+    std::vector<int64_t> positions(count);
+    timeline.ToTimecodes(samples.data(), count, timecodes.data());
+    timeline.ToSamples(timecodes.data(), count, starts.data());
+    timeline.ToDAMFSeconds(samples.data(), count, seconds.data());
+    for (double value : seconds)
+    {
+        damfSeconds.push_back(DAMFSeconds(value));
+    }
+    timeline.ToSamples(damfSeconds.data(), count, positions.data());
+    for (size_t i = 0; i < count; i++)
+    {
+        ASSERT_EQ(timecodes[i], timeline.ToTimecode(Samples(samples[i])));
+        ASSERT_EQ(starts[i], timeline.ToSamples(timecodes[i]).GetValue());
+        ASSERT_EQ(seconds[i], timeline.ToDAMFSeconds(Samples(samples[i])).GetValue());
+        ASSERT_EQ(positions[i], samples[i] < 0 ? samples[i] + int64_t(96000) * 86400 * 1001 / 1000
+                                               : samples[i]);
+    }
+}
@@ -0,0 +1,176 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include <tcutils/SyncAligner.h>
+
+using namespace testing;
+using namespace Dolby::TcUtils;
+
+class SyncAlignerTests : public Test
+{
+};
+
+namespace
+{
+    SyncAligner::File MakeFile(const char* start, double seconds, double samplerate)
+    {
+        return SyncAligner::File{Timecode(Framerate::FPS_25, start),
+                                 Samples(static_cast<int64_t>(seconds * samplerate)),
+                                 Samplerate(samplerate)};
+    }
+}
+
+// Test clusters and offsets of files at different samplerates
+TEST_F(SyncAlignerTests, Clusters)
+{
+    const std::vector<SyncAligner::File> files = {MakeFile("11:00:00:00", 60, 48000),
+                                                  MakeFile("10:05:00:00", 600, 96000),
+                                                  MakeFile("10:00:00:00", 600, 48000),
+                                                  MakeFile("10:15:00:00", 60, 44100)};
+    const SyncAligner aligner(files);
+    ASSERT_EQ(aligner.GetClusterCount(), 2u);
+    ASSERT_EQ(aligner.GetCluster(0), std::vector<size_t>({2, 1, 3}));
+    ASSERT_EQ(aligner.GetCluster(1), std::vector<size_t>({0}));
+    ASSERT_EQ(aligner.GetClusterOf(3), 0u);
+
+    // clang-format off
+    ASSERT_EQ(aligner.GetOffset(2, 1).GetValue(),  int64_t(48000) * 300);
+    ASSERT_EQ(aligner.GetOffset(1, 2).GetValue(), -int64_t(96000) * 300);
+    ASSERT_EQ(aligner.GetOffset(1, 3).GetValue(),  int64_t(96000) * 600);
+    ASSERT_EQ(aligner.GetOverlap(2, 1).GetValue(), int64_t(48000) * 300);
+    ASSERT_EQ(aligner.GetOverlap(1, 2).GetValue(), int64_t(96000) * 300);
+    ASSERT_EQ(aligner.GetOverlap(1, 3).GetValue(), 0);
+    ASSERT_EQ(aligner.GetOverlap(2, 0).GetValue(), 0);
+    // clang-format on
+}
+
+// Test that the ends of files are compared exactly
+TEST_F(SyncAlignerTests, ExactEnds)
+{
+    // 1001 frames at 29.97 fps are 1472941.47 samples at 44.1 kHz
+    const Framerate framerate(Framerate::FPS_2997);
+    const Timecode first(framerate, 1, 0, 0, 0);
+    const Timecode second = Timecode(framerate, Frames(first.ToFrames().GetValue() + 1001));
+    for (int64_t length : {1472941, 1472942})
+    {
+        const SyncAligner aligner({SyncAligner::File{first, Samples(length), Samplerate(44100)},
+                                   SyncAligner::File{second, Samples(10), Samplerate(48000)}});
+        ASSERT_EQ(aligner.GetClusterCount(), length == 1472941 ? 2u : 1u);
+        ASSERT_EQ(aligner.GetOffset(0, 1).GetValue(), 1472941);
+    }
+}
+
+// Test a shoot across midnight
+TEST_F(SyncAlignerTests, Midnight)
+{
+    std::vector<SyncAligner::File> files = {MakeFile("00:05:00:00", 600, 48000),
+                                            MakeFile("23:50:00:00", 1200, 48000),
+                                            MakeFile("01:00:00:00", 60, 48000)};
+    const SyncAligner wrapping(files);
+    ASSERT_EQ(wrapping.GetClusterCount(), 2u);
+    ASSERT_EQ(wrapping.GetCluster(0), std::vector<size_t>({1, 0}));
+    ASSERT_EQ(wrapping.GetOffset(1, 0).GetValue(), int64_t(48000) * 900);
+    ASSERT_EQ(wrapping.GetOverlap(1, 0).GetValue(), int64_t(48000) * 300);
+
+    // timecodes that don't wrap are ordered as they are
+    for (SyncAligner::File& file : files)
+    {
+        file.start = Timecode(Framerate::FPS_25, file.start.ToFrames(), WrapMode::CONTINUE);
+    }
+    const SyncAligner continuing(files);
+    ASSERT_EQ(continuing.GetClusterCount(), 3u);
+    ASSERT_EQ(continuing.GetCluster(0), std::vector<size_t>({0}));
+    ASSERT_EQ(continuing.GetOffset(1, 0).GetValue(), -int64_t(48000) * 85500);
+
+    ASSERT_THROW(SyncAligner({MakeFile("10:00:00:00", 1, 48000),
+                              SyncAligner::File{Timecode(Framerate::FPS_24, "10:00:00:00"),
+                                                Samples(1),
+                                                Samplerate(48000)}}),
+                 std::logic_error);
+    ASSERT_THROW(SyncAligner({MakeFile("10:00:00:00", 1, 0)}), SyncAligner::InvalidParameter);
+}
+
+// Test the clusters of many random files against pairwise comparisons
+TEST_F(SyncAlignerTests, Random)
+{
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<int> startSeconds(0, 6 * 3600);
+    std::uniform_int_distribution<int> lengthSeconds(1, 600);
+    std::uniform_int_distribution<int> rate(0, 2);
+    const double samplerates[] = {44100, 48000, 96000};
+
+    std::vector<SyncAligner::File> files;
+    std::vector<int> starts;
+    std::vector<int> ends;
+    for (int i = 0; i < 400; i++)
+    {
+        const int start         = startSeconds(generator) + 3600;
+        const int length        = lengthSeconds(generator);
+        const double samplerate = samplerates[rate(generator)];
+        files.push_back(SyncAligner::File{Timecode(Framerate::FPS_25, Frames(start * 25)),
+                                          Samples(static_cast<int64_t>(length * samplerate)),
+                                          Samplerate(samplerate)});
+        starts.push_back(start);
+        ends.push_back(start + length);
+    }
+    const SyncAligner aligner(files);
+
+    // connected components of the overlap graph
+    std::vector<size_t> component(files.size());
+    for (size_t i = 0; i < files.size(); i++)
+    {
+        component[i] = i;
+    }
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (size_t i = 0; i < files.size(); i++)
+        {
+            for (size_t j = 0; j < files.size(); j++)
+            {
+                if (starts[i] <= ends[j] && starts[j] <= ends[i] && component[j] < component[i])
+                {
+                    component[i] = component[j];
+                    changed      = true;
+                }
+            }
+        }
+    }
+    for (size_t i = 0; i < files.size(); i++)
+    {
+        for (size_t j = 0; j < files.size(); j++)
+        {
+            ASSERT_EQ(component[i] == component[j],
+                      aligner.GetClusterOf(i) == aligner.GetClusterOf(j));
+        }
+    }
+}
@@ -0,0 +1,188 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "FullStressTest.h"
+#include <gtest/gtest.h>
+#include <tcutils/TimecodeBCD.h>
+#include <vector>
+
+using namespace testing;
+using namespace Dolby::TcUtils;
+
+// test TimecodeBCD methods
+
+class TimecodeBCDTests : public Test
+{
+};
+
+TEST_F(TimecodeBCDTests, Pack)
+{
+    // clang-format off
+    ASSERT_EQ(TimecodeBCD::Pack(Timecode(Framerate::FPS_25,     "01:02:03:04")), 0x01020304u);
+    ASSERT_EQ(TimecodeBCD::Pack(Timecode(Framerate::FPS_24,     "23:59:59:23")), 0x23595923u);
+    ASSERT_EQ(TimecodeBCD::Pack(Timecode(Framerate::FPS_2997DF, "10:20:30;15")), 0x10203055u);
+    ASSERT_EQ(TimecodeBCD::Pack(Timecode(Framerate::FPS_30,     "00:00:00:00"),
+                                TimecodeBCD::COLOR_FRAME | TimecodeBCD::BGF1),   0x40000080u);
+    // the drop-frame flag follows the framerate, not the given flags
+    ASSERT_EQ(TimecodeBCD::Pack(Timecode(Framerate::FPS_30,     "00:00:00:00"),
+                                TimecodeBCD::DROP_FRAME),                        0x00000000u);
+    // clang-format on
+
+    ASSERT_THROW(TimecodeBCD::Pack(Timecode(Framerate::FPS_60, "00:00:00:00")),
+                 TimecodeBCD::UnsupportedFramerate);
+    ASSERT_THROW(TimecodeBCD::Pack(Timecode(Framerate::FPS_25)), Timecode::ValueOutOfRange);
+}
+
+TEST_F(TimecodeBCDTests, Unpack)
+{
+    // clang-format off
+    ASSERT_EQ(TimecodeBCD::Unpack(0x01020304u, Framerate::FPS_25),
+              Timecode(Framerate::FPS_25, "01:02:03:04"));
+    ASSERT_EQ(TimecodeBCD::Unpack(0xC0A080C0u | 0x10203015u, Framerate::FPS_2997DF),
+              Timecode(Framerate::FPS_2997DF, "10:20:30;15"));
+    ASSERT_EQ(TimecodeBCD::GetFlags(0xC0A080C0u | 0x10203015u), 0xC08080C0u);
+
+    const Framerate df(Framerate::FPS_2997DF);
+    ASSERT_THROW(TimecodeBCD::Unpack(0x0000000Au, Framerate::FPS_25), Timecode::InvalidFormat);
+    ASSERT_THROW(TimecodeBCD::Unpack(0x24000000u, Framerate::FPS_25), Timecode::ValueOutOfRange);
+    ASSERT_THROW(TimecodeBCD::Unpack(0x00010040u, df),                Timecode::InvalidDropFrame);
+    ASSERT_THROW(TimecodeBCD::Unpack(0x00000000u, df),                Timecode::InvalidFormat);
+    ASSERT_THROW(TimecodeBCD::Unpack(0x00000000u, Framerate::FPS_50),
+                 TimecodeBCD::UnsupportedFramerate);
+    // clang-format on
+}
+
+TEST_F(TimecodeBCDTests, DecodeStatus)
+{
+    using Status = TimecodeBCD::Status;
+    Timecode tc;
+
+    // clang-format off
+    const Framerate df(Framerate::FPS_2997DF);
+    ASSERT_EQ(TimecodeBCD::Decode(0x12345620u, Framerate::FPS_24,  tc), Status::OK);
+    ASSERT_EQ(tc, Timecode(Framerate::FPS_24, "12:34:56:20"));
+    ASSERT_EQ(TimecodeBCD::Decode(0x0000000Fu, Framerate::FPS_24,  tc), Status::INVALID_DIGIT);
+    ASSERT_EQ(TimecodeBCD::Decode(0x000A0000u, Framerate::FPS_24,  tc), Status::INVALID_DIGIT);
+    ASSERT_EQ(TimecodeBCD::Decode(0x00600000u, Framerate::FPS_24,  tc), Status::VALUE_OUT_OF_RANGE);
+    ASSERT_EQ(TimecodeBCD::Decode(0x00000024u, Framerate::FPS_24,  tc), Status::VALUE_OUT_OF_RANGE);
+    ASSERT_EQ(TimecodeBCD::Decode(0x00000024u, Framerate::FPS_25,  tc), Status::OK);
+    ASSERT_EQ(TimecodeBCD::Decode(0x00000040u, Framerate::FPS_25,  tc), Status::DROP_FLAG_MISMATCH);
+    ASSERT_EQ(TimecodeBCD::Decode(0x00010041u, df,                 tc), Status::INVALID_DROP_FRAME);
+    ASSERT_EQ(TimecodeBCD::Decode(0x00010042u, df,                 tc), Status::OK);
+    ASSERT_EQ(TimecodeBCD::Decode(0x00100040u, df,                 tc), Status::OK);
+    ASSERT_EQ(TimecodeBCD::Decode(0x00000000u, Framerate::FPS_100, tc),
+              Status::UNSUPPORTED_FRAMERATE);
+    // clang-format on
+
+    // the timecode is left untouched when decoding fails
+    ASSERT_EQ(tc, Timecode(Framerate::FPS_2997DF, "00:10:00;00"));
+}
+
+TEST_F(TimecodeBCDTests, RoundTripAllFrames)
+{
+    for (auto framerate : Framerate::values())
+    {
+        if (framerate.GetFrameCount() > 30)
+        {
+            continue;
+        }
+        std::vector<Timecode> timecodes;
+        std::vector<int32_t> expectedFrames;
+        Timecode tc(framerate, 0, 0, 0, 0);
+        int i = 0;
+        do
+        {
+            // check every frame for the first 100000 frames, after that check every 7th frame,
+            // unless env var TCUTILS_FULL_STRESS_TEST is set to YES.
+            if (FullStressTest::Active() || i < 100000 || (i % 7) == 0)
+            {
+                timecodes.push_back(tc);
+                expectedFrames.push_back(tc.ToFrames().GetValue());
+            }
+            ++tc;
+            i++;
+        } while (tc != Timecode(framerate, 0, 0, 0, 0));
+
+        std::vector<uint32_t> words(timecodes.size());
+        TimecodeBCD::Pack(timecodes.data(), timecodes.size(), words.data());
+
+        std::vector<uint32_t> wordsFromFrames(timecodes.size());
+        TimecodeBCD::PackFrames(
+            expectedFrames.data(), expectedFrames.size(), framerate, wordsFromFrames.data());
+        ASSERT_EQ(words, wordsFromFrames);
+
+        std::vector<Timecode> decoded(words.size());
+        ASSERT_EQ(TimecodeBCD::Decode(words.data(), words.size(), framerate, decoded.data()),
+                  words.size());
+        ASSERT_EQ(decoded, timecodes);
+
+        std::vector<int32_t> frames(words.size());
+        ASSERT_EQ(TimecodeBCD::DecodeFrames(words.data(), words.size(), framerate, frames.data()),
+                  words.size());
+        ASSERT_EQ(frames, expectedFrames);
+    }
+}
+
+TEST_F(TimecodeBCDTests, DecodeFramesMatchesDecode)
+{
+    // a deterministic mix of valid and invalid words, with a count that is not a multiple of 4
+    std::vector<uint32_t> words;
+    uint32_t x = 0x12345678;
+    for (int i = 0; i < 100003; i++)
+    {
+        x = x * 1664525u + 1013904223u;
+        // clear the tens bits that are most likely to be out of range, to get more valid words
+        words.push_back((i % 3) == 0 ? x : x & 0x1F4F4F5F);
+    }
+
+    for (auto framerate : Framerate::values())
+    {
+        std::vector<int32_t> frames(words.size());
+        const size_t decoded =
+            TimecodeBCD::DecodeFrames(words.data(), words.size(), framerate, frames.data());
+
+        size_t expectedDecoded = 0;
+        for (size_t i = 0; i < words.size(); i++)
+        {
+            Timecode tc;
+            if (TimecodeBCD::Decode(words[i], framerate, tc) == TimecodeBCD::Status::OK)
+            {
+                expectedDecoded++;
+                ASSERT_EQ(frames[i], tc.ToFrames().GetValue());
+            }
+            else
+            {
+                ASSERT_EQ(frames[i], -1);
+            }
+        }
+        ASSERT_EQ(decoded, expectedDecoded);
+        if (framerate.GetFrameCount() <= 30)
+        {
+            ASSERT_GT(decoded, 0u);
+        }
+    }
+}
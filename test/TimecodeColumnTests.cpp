@@ -0,0 +1,180 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include <tcutils/AbsoluteFrames.h>
+#include <tcutils/TimecodeColumn.h>
+
+using namespace testing;
+using namespace Dolby::TcUtils;
+
+class TimecodeColumnTests : public Test
+{
+};
+
+namespace
+{
+    std::vector<Timecode> RandomTimecodes(Framerate framerate, size_t count, WrapMode wrapMode)
+    {
+        std::mt19937 random(40);
+        std::uniform_int_distribution<int32_t> frame(
+            0, static_cast<int32_t>(AbsoluteFrames::FramesPerDay(framerate) - 1));
+        std::vector<Timecode> timecodes;
+        for (size_t i = 0; i < count; i++)
+        {
+            timecodes.emplace_back(framerate, Frames(frame(random)), wrapMode);
+        }
+        return timecodes;
+    }
+}
+
+// Test the bulk operations against the operations on Timecode
+TEST_F(TimecodeColumnTests, BulkOperations)
+{
+    const Samplerate samplerate(48000);
+    for (Framerate framerate : Framerate::Range())
+    {
+        for (WrapMode wrapMode : {WrapMode::WRAP_AT_MIDNIGHT, WrapMode::CONTINUE})
+        {
+            const std::vector<Timecode> timecodes = RandomTimecodes(framerate, 1000, wrapMode);
+            TimecodeColumn column(timecodes.data(), timecodes.size());
+            ASSERT_EQ(column.size(), timecodes.size());
+            ASSERT_EQ(column.GetWrapMode(), wrapMode);
+
+            std::vector<int64_t> samples(column.size());
+            std::vector<double> seconds(column.size());
+            std::vector<std::string> strings;
+            std::vector<int8_t> results(column.size());
+            column.ToSamples(samplerate, samples.data());
+            column.ToSeconds(seconds.data());
+            column.ToStrings(strings);
+            column.Compare(timecodes[0], results.data());
+            for (size_t i = 0; i < timecodes.size(); i++)
+            {
+                ASSERT_EQ(column[i], timecodes[i]);
+                ASSERT_EQ(samples[i], timecodes[i].ToSamples(samplerate).GetValue());
+                ASSERT_EQ(seconds[i], timecodes[i].ToSeconds().GetValue());
+                ASSERT_EQ(strings[i], timecodes[i].ToString());
+                ASSERT_EQ(results[i], timecodes[i] < timecodes[0]   ? -1
+                                      : timecodes[i] == timecodes[0] ? 0
+                                                                     : 1);
+            }
+
+            // offset by more than a day wraps, or throws when continuing
+            const TimecodeDuration offset(framerate, AbsoluteFrames::FramesPerDay(framerate) + 5);
+            if (wrapMode == WrapMode::WRAP_AT_MIDNIGHT)
+            {
+                TimecodeColumn offsetColumn = column;
+                offsetColumn.Offset(offset);
+                offsetColumn.Offset(-offset);
+                offsetColumn.Offset(offset);
+                for (size_t i = 0; i < timecodes.size(); i++)
+                {
+                    ASSERT_EQ(offsetColumn[i], timecodes[i] + offset);
+                }
+            }
+            else
+            {
+                TimecodeColumn offsetColumn = column;
+                offsetColumn.Offset(offset);
+                for (size_t i = 0; i < timecodes.size(); i++)
+                {
+                    ASSERT_EQ(offsetColumn[i], timecodes[i] + offset);
+                }
+                ASSERT_THROW(offsetColumn.Offset(-offset * 2), Timecode::ValueOutOfRange);
+                ASSERT_EQ(offsetColumn[0], timecodes[0] + offset);
+            }
+        }
+    }
+}
+
+// Test filtering and comparing columns
+TEST_F(TimecodeColumnTests, FilterAndCompare)
+{
+    const Framerate framerate(Framerate::FPS_2997DF);
+    TimecodeColumn column(framerate);
+    column.PushBack(Timecode(framerate, "00:59:59;29"));
+    column.PushBack(Timecode(framerate, "01:00:00;00"));
+    column.PushBack(Timecode(framerate, "01:30:00;00"));
+    column.PushBack(Timecode(framerate, "02:00:00;00"));
+
+    std::vector<size_t> indices;
+    column.Filter(Timecode(framerate, "01:00:00;00"), Timecode(framerate, "02:00:00;00"), indices);
+    ASSERT_EQ(indices, (std::vector<size_t>{1, 2}));
+
+    TimecodeColumn other = column;
+    other.Set(0, Timecode(framerate, "00:00:00;00"));
+    other.Set(3, Timecode(framerate, "03:00:00;00"));
+    std::vector<int8_t> results(column.size());
+    column.Compare(other, results.data());
+    ASSERT_EQ(results, (std::vector<int8_t>{1, 0, 0, -1}));
+
+    ASSERT_THROW(column.PushBack(Timecode(Framerate::FPS_30, "01:00:00:00")), std::logic_error);
+    ASSERT_THROW(column.PushBack(Timecode(framerate)), Timecode::ValueOutOfRange);
+    ASSERT_THROW(column.Compare(TimecodeColumn(framerate), results.data()), std::logic_error);
+    ASSERT_THROW(TimecodeColumn(framerate, std::vector<int32_t>{-1}), Timecode::ValueOutOfRange);
+    ASSERT_THROW(TimecodeColumn(framerate, std::vector<int32_t>{2589408}),
+                 Timecode::ValueOutOfRange);
+    ASSERT_EQ(TimecodeColumn(framerate, std::vector<int32_t>{2589408}, WrapMode::CONTINUE)[0]
+                  .ToString(),
+              "24:00:00;00");
+    // continuous timecodes after midnight in a column that wraps at midnight
+    const Timecode late(framerate, "30:00:00;00", WrapMode::CONTINUE);
+    ASSERT_THROW(column.PushBack(late), Timecode::ValueOutOfRange);
+    ASSERT_THROW(column.Set(0, late), Timecode::ValueOutOfRange);
+    ASSERT_EQ(column[0].ToString(), "00:59:59;29");
+    const Timecode mixed[] = {Timecode(framerate, "01:00:00;00"), late};
+    ASSERT_THROW(TimecodeColumn(mixed, 2), Timecode::ValueOutOfRange);
+    TimecodeColumn continuous(framerate, WrapMode::CONTINUE);
+    continuous.PushBack(late);
+    continuous.PushBack(Timecode(framerate, "01:00:00;00"));
+    ASSERT_EQ(continuous[0].ToString(), "30:00:00;00");
+}
+
+// Test columns that are views of arrays owned elsewhere
+TEST_F(TimecodeColumnTests, View)
+{
+    std::vector<int32_t> frames = {0, 25, 90000};
+    TimecodeColumn view = TimecodeColumn::View(Framerate::FPS_25, frames.data(), frames.size());
+    ASSERT_TRUE(view.IsView());
+    ASSERT_EQ(view.data(), frames.data());
+    ASSERT_EQ(view[2].ToString(), "01:00:00:00");
+
+    // modified in place, also through copies
+    TimecodeColumn copy = view;
+    copy.Offset(TimecodeDuration(Framerate::FPS_25, -25));
+    ASSERT_EQ(frames, (std::vector<int32_t>{2159975, 0, 89975}));
+    view.Set(1, Timecode(Framerate::FPS_25, "00:00:10:00"));
+    ASSERT_EQ(frames[1], 250);
+
+    ASSERT_THROW(view.PushBack(Timecode(Framerate::FPS_25, "00:00:00:00")), std::logic_error);
+    frames[0] = -1;
+    ASSERT_THROW(TimecodeColumn::View(Framerate::FPS_25, frames.data(), frames.size()),
+                 Timecode::ValueOutOfRange);
+}
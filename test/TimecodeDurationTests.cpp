@@ -0,0 +1,184 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <tcutils/TimecodeDuration.h>
+
+using namespace testing;
+using namespace Dolby::TcUtils;
+
+class TimecodeDurationTests : public Test
+{
+};
+
+// Test the difference between timecodes
+TEST_F(TimecodeDurationTests, Subtract)
+{
+    const Timecode a(Framerate::FPS_25, "01:00:00:00");
+    const Timecode b(Framerate::FPS_25, "00:59:58:10");
+
+    ASSERT_EQ((a - b).GetValue(), 40);
+    ASSERT_EQ((b - a).GetValue(), -40);
+    ASSERT_EQ((a - b).GetFramerate(), Framerate(Framerate::FPS_25));
+    ASSERT_EQ((a - a).GetValue(), 0);
+
+    ASSERT_THROW(a - Timecode(Framerate::FPS_24, "00:00:00:00"), std::logic_error);
+    ASSERT_THROW(a - Timecode(Framerate::FPS_25), Timecode::ValueOutOfRange);
+}
+
+// Test the duration crossing midnight
+TEST_F(TimecodeDurationTests, Between)
+{
+    const Timecode beforeMidnight(Framerate::FPS_2997DF, "23:59:59;28");
+    const Timecode afterMidnight(Framerate::FPS_2997DF, "00:00:00;03");
+
+    // clang-format off
+    ASSERT_EQ(TimecodeDuration::Between(beforeMidnight, afterMidnight).GetValue(),  5);
+    ASSERT_EQ(TimecodeDuration::Between(afterMidnight, beforeMidnight).GetValue(),  2589408 - 5);
+    ASSERT_EQ(TimecodeDuration::Between(afterMidnight, afterMidnight).GetValue(),   0);
+    ASSERT_EQ((afterMidnight - beforeMidnight).GetValue(),                          5 - 2589408);
+    // clang-format on
+
+    const Timecode continued(Framerate::FPS_25, "25:00:00:00", WrapMode::CONTINUE);
+    const Timecode start(Framerate::FPS_25, "23:00:00:00");
+    ASSERT_EQ(TimecodeDuration::Between(start, continued).ToString(), "02:00:00:00");
+}
+
+// Test adding durations to timecodes
+TEST_F(TimecodeDurationTests, AddToTimecode)
+{
+    const Timecode start(Framerate::FPS_2997DF, "00:00:59;29");
+    const TimecodeDuration oneFrame(Framerate::FPS_2997DF, 1);
+
+    ASSERT_EQ((start + oneFrame).ToString(), "00:01:00;02");
+    ASSERT_EQ((start + oneFrame - oneFrame), start);
+    ASSERT_EQ(Timecode(Framerate::FPS_2997DF, "00:00:00;00") - oneFrame,
+              Timecode(Framerate::FPS_2997DF, "23:59:59;29"));
+
+    Timecode timecode(Framerate::FPS_24, "23:00:00:00");
+    timecode += TimecodeDuration(Framerate::FPS_24, "02:00:00:01");
+    ASSERT_EQ(timecode.ToString(), "01:00:00:01");
+    timecode -= TimecodeDuration(Framerate::FPS_24, "01:00:00:02");
+    ASSERT_EQ(timecode.ToString(), "23:59:59:23");
+
+    const Timecode continued(Framerate::FPS_24, "98:00:00:00", WrapMode::CONTINUE);
+    ASSERT_EQ((continued + TimecodeDuration(Framerate::FPS_24, "01:00:00:00")).ToString(),
+              "99:00:00:00");
+    ASSERT_THROW(continued + TimecodeDuration(Framerate::FPS_24, "02:00:00:00"),
+                 Timecode::ValueOutOfRange);
+    ASSERT_THROW(continued - TimecodeDuration(Framerate::FPS_24, "99:00:00:00"),
+                 Timecode::ValueOutOfRange);
+    ASSERT_THROW(continued + oneFrame, std::logic_error);
+}
+
+// Test formatting durations
+TEST_F(TimecodeDurationTests, ToString)
+{
+    // clang-format off
+    ASSERT_EQ(TimecodeDuration(Framerate::FPS_25, int64_t(0)).ToString(),       "00:00:00:00");
+    ASSERT_EQ(TimecodeDuration(Framerate::FPS_25, 90001).ToString(),            "01:00:00:01");
+    ASSERT_EQ(TimecodeDuration(Framerate::FPS_25, -90001).ToString(),           "-01:00:00:01");
+    ASSERT_EQ(TimecodeDuration(Framerate::FPS_25, 90000LL * 123).ToString(),    "123:00:00:00");
+    ASSERT_EQ(TimecodeDuration(Framerate::FPS_2997DF, 1800).ToString(),         "00:01:00;02");
+    ASSERT_EQ(TimecodeDuration(Framerate::FPS_2997DF, 17982).ToString(),        "00:10:00;00");
+    ASSERT_EQ(TimecodeDuration(Framerate::FPS_2997DF, 2589408).ToString(),      "24:00:00;00");
+    ASSERT_EQ(TimecodeDuration(Framerate::FPS_2997DF, 2589408 * 10).ToString(), "240:00:00;00");
+    ASSERT_EQ(TimecodeDuration(Framerate::FPS_120, 119).ToString(),             "00:00:00:119");
+    // clang-format on
+
+    const TimecodeDuration duration(Framerate::FPS_2997DF, -(2589408 * 5 + 1800));
+    ASSERT_EQ(duration.GetUnitHours(), 120);
+    ASSERT_EQ(duration.GetUnitMinutes(), 1);
+    ASSERT_EQ(duration.GetUnitSeconds(), 0);
+    ASSERT_EQ(duration.GetUnitFrames(), 2);
+
+    std::stringstream stream;
+    stream << TimecodeDuration(Framerate::FPS_24, 25);
+    ASSERT_EQ(stream.str(), "00:00:01:01");
+}
+
+// Test parsing durations, symmetrical with formatting and with timecode for drop-frame
+TEST_F(TimecodeDurationTests, FromString)
+{
+    // clang-format off
+    ASSERT_EQ(TimecodeDuration(Framerate::FPS_25, "01:00:00:01").GetValue(),        90001);
+    ASSERT_EQ(TimecodeDuration(Framerate::FPS_25, "-01:00:00:01").GetValue(),       -90001);
+    ASSERT_EQ(TimecodeDuration(Framerate::FPS_25, "123:00:00:00").GetValue(),       90000LL * 123);
+    ASSERT_EQ(TimecodeDuration(Framerate::FPS_2997DF, "00:01:00;02").GetValue(),    1800);
+    ASSERT_EQ(TimecodeDuration(Framerate::FPS_120, "00:00:01:001").GetValue(),      121);
+    ASSERT_EQ(TimecodeDuration(Framerate::FPS_24, std::string("00:00:01:01")).GetValue(), 25);
+    // clang-format on
+
+    for (int32_t frames = 0; frames < 2589408; frames += 97)
+    {
+        const TimecodeDuration duration(Framerate::FPS_2997DF, frames);
+        ASSERT_EQ(duration.ToString(), Timecode(Framerate::FPS_2997DF, Frames(frames)).ToString());
+        ASSERT_EQ(TimecodeDuration(Framerate::FPS_2997DF, duration.ToString()), duration);
+    }
+
+    ASSERT_THROW(TimecodeDuration(Framerate::FPS_25, "00:00:00"), Timecode::StringParseError);
+    ASSERT_THROW(TimecodeDuration(Framerate::FPS_25, "0:00:00:00"), Timecode::StringParseError);
+    ASSERT_THROW(TimecodeDuration(Framerate::FPS_25, "00:00:00:00 "), Timecode::StringParseError);
+    ASSERT_THROW(TimecodeDuration(Framerate::FPS_25, "00:00:01:024"), Timecode::StringParseError);
+    ASSERT_THROW(TimecodeDuration(Framerate::FPS_120, "00:00:01:0024"), Timecode::StringParseError);
+    ASSERT_THROW(TimecodeDuration(Framerate(Rational(240)), "00:00:01:24"),
+                 Timecode::StringParseError);
+    ASSERT_THROW(TimecodeDuration(Framerate::FPS_2997DF, "00:00:00:00"),
+                 Timecode::StringParseError);
+    ASSERT_THROW(TimecodeDuration(Framerate::FPS_25, "00:60:00:00"), Timecode::ValueOutOfRange);
+    ASSERT_THROW(TimecodeDuration(Framerate::FPS_25, "00:00:00:25"), Timecode::ValueOutOfRange);
+    ASSERT_THROW(TimecodeDuration(Framerate::FPS_2997DF, "00:01:00;00"),
+                 Timecode::InvalidDropFrame);
+    ASSERT_THROW(TimecodeDuration(Framerate(), "00:00:00:00"),
+                 TimecodeDuration::UndefinedFramerate);
+}
+
+// Test arithmetic and comparison of durations
+TEST_F(TimecodeDurationTests, Arithmetic)
+{
+    const TimecodeDuration a(Framerate::FPS_30, 100);
+    const TimecodeDuration b(Framerate::FPS_30, 40);
+
+    // clang-format off
+    ASSERT_EQ((a + b).GetValue(), 140);
+    ASSERT_EQ((a - b).GetValue(), 60);
+    ASSERT_EQ((b - a).GetValue(), -60);
+    ASSERT_EQ((-a).GetValue(),    -100);
+    ASSERT_EQ((a * 3).GetValue(), 300);
+    // clang-format on
+
+    ASSERT_TRUE(b < a);
+    ASSERT_TRUE(a > b);
+    ASSERT_TRUE(a <= a);
+    ASSERT_TRUE(b >= b);
+    ASSERT_NE(a, TimecodeDuration(Framerate::FPS_2997, 100));
+    ASSERT_THROW(a + TimecodeDuration(Framerate::FPS_2997, 1), std::logic_error);
+    ASSERT_THROW(a < TimecodeDuration(Framerate::FPS_2997, 1), std::logic_error);
+    ASSERT_THROW(TimecodeDuration(Framerate(), int64_t(0)),
+                 TimecodeDuration::UndefinedFramerate);
+}
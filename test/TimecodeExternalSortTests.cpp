@@ -0,0 +1,122 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include <tcutils/TimecodeExternalSort.h>
+
+using namespace testing;
+using namespace Dolby::TcUtils;
+
+namespace
+{
+    // compare the real-time start of the frames, as TimecodeMerger does
+    bool startsBefore(const TimecodeEvent& a, const TimecodeEvent& b)
+    {
+        const auto rate = [](const Framerate& framerate, bool numerator) -> int64_t {
+            const bool ratio = framerate.IsRatio1001();
+            return numerator ? framerate.GetFrameCount() * (ratio ? 1000 : 1) : (ratio ? 1001 : 1);
+        };
+        const Framerate rateA = a.timecode.GetFramerate();
+        const Framerate rateB = b.timecode.GetFramerate();
+        return a.timecode.ToFrames().GetValue() * rate(rateA, false) * rate(rateB, true) <
+               b.timecode.ToFrames().GetValue() * rate(rateB, false) * rate(rateA, true);
+    }
+}
+
+class TimecodeExternalSortTests : public Test
+{
+protected:
+    // sort random events of mixed framerates, returning the number of runs
+    static size_t SortRandom(size_t memoryLimit)
+    {
+        std::mt19937 generator(5);
+        std::uniform_int_distribution<int32_t> seconds(0, 599);
+        const Framerate framerates[] = {
+            Framerate::FPS_24, Framerate::FPS_2997DF, Framerate::FPS_25};
+
+        TimecodeExternalSort sort(TempDir(), memoryLimit);
+        std::vector<TimecodeEvent> events;
+        for (int i = 0; i < 5000; i++)
+        {
+            const Framerate framerate = framerates[i % 3];
+            // whole seconds, so that events of different framerates start at the same time
+            const int64_t frames      = seconds(generator) * framerate.GetFrameCount();
+            events.push_back({Timecode(framerate, Frames(frames)), std::to_string(i)});
+            sort.Add(events.back());
+        }
+        // events at the same time are in the order in which they were added
+        std::stable_sort(events.begin(), events.end(), startsBefore);
+
+        TimecodeEvent event;
+        for (const TimecodeEvent& expected : events)
+        {
+            EXPECT_TRUE(sort.Next(event));
+            EXPECT_EQ(event.timecode, expected.timecode);
+            EXPECT_EQ(event.data, expected.data);
+        }
+        EXPECT_FALSE(sort.Next(event));
+        EXPECT_THROW(sort.Add(events.front()), std::logic_error);
+        return sort.GetRunCount();
+    }
+};
+
+// Test sorting in memory
+TEST_F(TimecodeExternalSortTests, InMemory)
+{
+    ASSERT_EQ(SortRandom(64 << 20), 0u);
+}
+
+// Test sorting with runs in temporary files
+TEST_F(TimecodeExternalSortTests, Runs)
+{
+    ASSERT_GT(SortRandom(16 << 10), 10u);
+}
+
+// Test events with empty data and timecodes that continue past midnight
+TEST_F(TimecodeExternalSortTests, Records)
+{
+    TimecodeExternalSort sort(TempDir(), 1);
+    const Timecode late(Framerate::FPS_2997DF, Frames(2589410), WrapMode::CONTINUE);
+    const Timecode early(Framerate::FPS_30, "00:00:01:00");
+    sort.Add({late, std::string()});
+    sort.Add({early, std::string(1000, 'x')});
+    ASSERT_EQ(sort.GetRunCount(), 2u);
+    ASSERT_THROW(sort.Add({Timecode(), std::string()}), Timecode::ValueOutOfRange);
+
+    TimecodeEvent event;
+    ASSERT_TRUE(sort.Next(event));
+    ASSERT_EQ(event.timecode, early);
+    ASSERT_EQ(event.data, std::string(1000, 'x'));
+    ASSERT_TRUE(sort.Next(event));
+    ASSERT_EQ(event.timecode, late);
+    ASSERT_EQ(event.timecode.GetWrapMode(), WrapMode::CONTINUE);
+    ASSERT_TRUE(event.data.empty());
+    ASSERT_FALSE(sort.Next(event));
+}
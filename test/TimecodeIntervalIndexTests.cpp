@@ -0,0 +1,234 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include <tcutils/TimecodeIntervalIndex.h>
+
+using namespace testing;
+using namespace Dolby::TcUtils;
+
+class TimecodeIntervalIndexTests : public Test
+{
+};
+
+namespace
+{
+    // The intervals sharing a frame with [begin, end) by linear scan, ordered as the index results
+    std::vector<size_t> Scan(const std::vector<Timecode>& in,
+                             const std::vector<Timecode>& out,
+                             int32_t begin,
+                             int32_t end)
+    {
+        std::vector<size_t> indices;
+        for (size_t i = 0; i < in.size(); i++)
+        {
+            const int32_t first = std::max(in[i].ToFrames().GetValue(), begin);
+            const int32_t limit = std::min(out[i].ToFrames().GetValue(), end);
+            if (first < limit)
+            {
+                indices.push_back(i);
+            }
+        }
+        std::stable_sort(indices.begin(),
+                         indices.end(),
+                         [&in](size_t a, size_t b)
+                         { return in[a].ToFrames().GetValue() < in[b].ToFrames().GetValue(); });
+        return indices;
+    }
+}
+
+// Test stabbing queries on a small event list
+TEST_F(TimecodeIntervalIndexTests, Stabbing)
+{
+    const Framerate framerate(Framerate::FPS_25);
+    const std::vector<Timecode> in = {Timecode(framerate, "01:00:00:00"),
+                                      Timecode(framerate, "01:00:05:00"),
+                                      Timecode(framerate, "00:59:59:00"),
+                                      Timecode(framerate, "01:00:10:00")};
+    const std::vector<Timecode> out = {Timecode(framerate, "01:00:10:00"),
+                                       Timecode(framerate, "01:00:06:00"),
+                                       Timecode(framerate, "01:00:00:01"),
+                                       Timecode(framerate, "01:00:10:00")};
+    const TimecodeIntervalIndex index(in.data(), out.data(), in.size());
+    ASSERT_EQ(index.size(), 4u);
+    ASSERT_EQ(index.GetFramerate(), framerate);
+
+    std::vector<size_t> indices;
+    index.FindOverlapping(Timecode(framerate, "01:00:00:00"), indices);
+    ASSERT_EQ(indices, std::vector<size_t>({2, 0}));
+
+    indices.clear();
+    index.FindOverlapping(Timecode(framerate, "01:00:05:10"), indices);
+    ASSERT_EQ(indices, std::vector<size_t>({0, 1}));
+
+    // out points are not included, and empty intervals contain no frames
+    indices.clear();
+    index.FindOverlapping(Timecode(framerate, "01:00:10:00"), indices);
+    ASSERT_TRUE(indices.empty());
+
+    index.FindOverlapping(Timecode(framerate, "01:00:06:00"), Timecode(framerate, "02:00:00:00"),
+                          indices);
+    ASSERT_EQ(indices, std::vector<size_t>({0}));
+    ASSERT_EQ(index.CountOverlapping(Timecode(framerate, "00:00:00:00"),
+                                     Timecode(framerate, "23:59:59:24")),
+              3u);
+    ASSERT_EQ(index.CountOverlapping(Timecode(framerate, "01:00:00:00"),
+                                     Timecode(framerate, "01:00:00:00")),
+              0u);
+}
+
+// Test queries against a linear scan for random intervals
+TEST_F(TimecodeIntervalIndexTests, Random)
+{
+    const Framerate framerate(Framerate::FPS_2997DF);
+    std::mt19937 random(37);
+    std::uniform_int_distribution<int32_t> start(0, 200000);
+    std::uniform_int_distribution<int32_t> length(0, 3000);
+
+    for (size_t count : {0, 1, 2, 7, 8, 9, 15, 16, 17, 100, 1000, 5000})
+    {
+        std::vector<Timecode> in;
+        std::vector<Timecode> out;
+        for (size_t i = 0; i < count; i++)
+        {
+            const int32_t frame = start(random);
+            in.emplace_back(framerate, Frames(frame));
+            out.emplace_back(framerate, Frames(frame + length(random)));
+        }
+        const TimecodeIntervalIndex index(in.data(), out.data(), count);
+
+        for (int query = 0; query < 200; query++)
+        {
+            const int32_t begin = start(random);
+            const int32_t end   = begin + length(random) / 10;
+            std::vector<size_t> indices;
+            index.FindOverlapping(Timecode(framerate, Frames(begin)),
+                                  Timecode(framerate, Frames(end)),
+                                  indices);
+            ASSERT_EQ(indices, Scan(in, out, begin, end));
+            ASSERT_EQ(index.CountOverlapping(Timecode(framerate, Frames(begin)),
+                                             Timecode(framerate, Frames(end))),
+                      indices.size());
+
+            indices.clear();
+            index.FindOverlapping(Timecode(framerate, Frames(begin)), indices);
+            ASSERT_EQ(indices, Scan(in, out, begin, begin + 1));
+        }
+    }
+}
+
+// Test bulk stabbing queries
+TEST_F(TimecodeIntervalIndexTests, Bulk)
+{
+    const Framerate framerate(Framerate::FPS_24);
+    std::vector<Timecode> in;
+    std::vector<Timecode> out;
+    for (int32_t i = 0; i < 100; i++)
+    {
+        in.emplace_back(framerate, Frames(i * 10));
+        out.emplace_back(framerate, Frames(i * 10 + 25));
+    }
+    const TimecodeIntervalIndex index(in.data(), out.data(), in.size());
+
+    std::vector<Timecode> queries;
+    for (int32_t frame = 0; frame < 1100; frame += 3)
+    {
+        queries.emplace_back(framerate, Frames(frame));
+    }
+    std::vector<size_t> offsets = {42};
+    std::vector<size_t> indices = {42};
+    index.FindOverlapping(queries.data(), queries.size(), offsets, indices);
+    ASSERT_EQ(offsets.size(), queries.size() + 1);
+    ASSERT_EQ(offsets.front(), 0u);
+    ASSERT_EQ(offsets.back(), indices.size());
+    for (size_t i = 0; i < queries.size(); i++)
+    {
+        const auto frame = queries[i].ToFrames().GetValue();
+        ASSERT_EQ(std::vector<size_t>(indices.begin() + static_cast<ptrdiff_t>(offsets[i]),
+                                      indices.begin() + static_cast<ptrdiff_t>(offsets[i + 1])),
+                  Scan(in, out, frame, frame + 1));
+    }
+}
+
+// Test that an index built on multiple threads gives the same results as one built on one thread
+TEST_F(TimecodeIntervalIndexTests, Parallel)
+{
+    const Framerate framerate(Framerate::FPS_25);
+    std::mt19937 random(39);
+    std::uniform_int_distribution<int32_t> start(0, 100000);
+    std::uniform_int_distribution<int32_t> length(1, 500);
+    std::vector<Timecode> in;
+    std::vector<Timecode> out;
+    for (size_t i = 0; i < 300000; i++)
+    {
+        const int32_t frame = start(random);
+        in.emplace_back(framerate, Frames(frame));
+        out.emplace_back(framerate, Frames(frame + length(random)));
+    }
+    const TimecodeIntervalIndex serial(in.data(), out.data(), in.size(), 1);
+    const TimecodeIntervalIndex parallel(in.data(), out.data(), in.size(), 4);
+
+    std::vector<Timecode> queries;
+    for (int32_t frame = 0; frame < 101000; frame += 997)
+    {
+        queries.emplace_back(framerate, Frames(frame));
+    }
+    std::vector<size_t> serialOffsets;
+    std::vector<size_t> serialIndices;
+    serial.FindOverlapping(queries.data(), queries.size(), serialOffsets, serialIndices);
+    std::vector<size_t> parallelOffsets;
+    std::vector<size_t> parallelIndices;
+    parallel.FindOverlapping(queries.data(), queries.size(), parallelOffsets, parallelIndices);
+    ASSERT_EQ(parallelOffsets, serialOffsets);
+    ASSERT_EQ(parallelIndices, serialIndices);
+    ASSERT_GT(serialIndices.size(), 0u);
+}
+
+// Test intervals crossing midnight as continuous timecode, and invalid input
+TEST_F(TimecodeIntervalIndexTests, Errors)
+{
+    const Framerate framerate(Framerate::FPS_30);
+    const Timecode in[]  = {Timecode(framerate, "23:00:00:00", WrapMode::CONTINUE)};
+    const Timecode out[] = {Timecode(framerate, "25:00:00:00", WrapMode::CONTINUE)};
+    const TimecodeIntervalIndex index(in, out, 1);
+    ASSERT_EQ(index.CountOverlapping(Timecode(framerate, "24:30:00:00", WrapMode::CONTINUE),
+                                     Timecode(framerate, "24:30:00:01", WrapMode::CONTINUE)),
+              1u);
+
+    std::vector<size_t> indices;
+    ASSERT_THROW(TimecodeIntervalIndex(out, in, 1), TimecodeIntervalIndex::InvalidInterval);
+    ASSERT_THROW(index.FindOverlapping(Timecode(Framerate::FPS_25, "00:00:00:00"), indices),
+                 std::logic_error);
+    ASSERT_THROW(index.FindOverlapping(Timecode(framerate), indices), Timecode::ValueOutOfRange);
+
+    const TimecodeIntervalIndex empty(nullptr, nullptr, 0);
+    empty.FindOverlapping(Timecode(Framerate::FPS_25, "00:00:00:00"), indices);
+    ASSERT_TRUE(indices.empty());
+}
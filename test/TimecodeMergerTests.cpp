@@ -0,0 +1,151 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include <tcutils/TimecodeMerger.h>
+
+using namespace testing;
+using namespace Dolby::TcUtils;
+
+class TimecodeMergerTests : public Test
+{
+};
+
+namespace
+{
+    class VectorSource : public TimecodeEventSource
+    {
+    public:
+        explicit VectorSource(std::vector<TimecodeEvent> events)
+        : mEvents(std::move(events))
+        {
+        }
+
+        bool Next(TimecodeEvent& event) override
+        {
+            if (mNext == mEvents.size())
+            {
+                return false;
+            }
+            event = mEvents[mNext++];
+            return true;
+        }
+
+    private:
+        std::vector<TimecodeEvent> mEvents;
+        size_t mNext{0};
+    };
+
+    // compare the real-time start of the frames, without ordering by framerate as Compare does
+    bool startsBefore(const TimecodeEvent& a, const TimecodeEvent& b)
+    {
+        const auto rate = [](const Framerate& framerate, bool numerator) -> int64_t {
+            const bool ratio = framerate.IsRatio1001();
+            return numerator ? framerate.GetFrameCount() * (ratio ? 1000 : 1) : (ratio ? 1001 : 1);
+        };
+        const Framerate rateA = a.timecode.GetFramerate();
+        const Framerate rateB = b.timecode.GetFramerate();
+        return a.timecode.ToFrames().GetValue() * rate(rateA, false) * rate(rateB, true) <
+               b.timecode.ToFrames().GetValue() * rate(rateB, false) * rate(rateA, true);
+    }
+}
+
+// Test merging streams of different framerates
+TEST_F(TimecodeMergerTests, Framerates)
+{
+    VectorSource film({{Timecode(Framerate::FPS_24, "01:00:00:00"), "a"},
+                       {Timecode(Framerate::FPS_24, "01:00:00:12"), "b"},
+                       {Timecode(Framerate::FPS_24, "01:00:01:00"), "c"}});
+    VectorSource video({{Timecode(Framerate::FPS_25, "01:00:00:00"), "d"},
+                        {Timecode(Framerate::FPS_25, "01:00:00:10"), "e"},
+                        {Timecode(Framerate::FPS_25, "01:00:00:13"), "f"}});
+    // 01:00:00;00 at 29.97 DF starts 3.6 ms before 01:00:00:00 in real-time
+    VectorSource ntsc({{Timecode(Framerate::FPS_2997DF, "01:00:00;00"), "g"}});
+    VectorSource empty({});
+
+    TimecodeMerger merger({&film, &empty, &video, &ntsc});
+    std::string order;
+    std::vector<size_t> sources;
+    TimecodeEvent event;
+    while (merger.Next(event))
+    {
+        order += event.data;
+        sources.push_back(merger.GetSource());
+    }
+    ASSERT_EQ(order, "gadebfc");
+    ASSERT_EQ(sources, std::vector<size_t>({3, 0, 2, 2, 0, 2, 0}));
+}
+
+// Test merging many sorted streams against sorting all events
+TEST_F(TimecodeMergerTests, Random)
+{
+    std::mt19937 generator(3);
+    std::uniform_int_distribution<int32_t> frames(0, 1999);
+    const Framerate framerates[] = {Framerate::FPS_24, Framerate::FPS_2997DF, Framerate::FPS_50};
+
+    for (size_t count : {1, 2, 3, 5, 8, 17})
+    {
+        std::vector<VectorSource> sources;
+        std::vector<TimecodeEvent> all;
+        for (size_t i = 0; i < count; i++)
+        {
+            const Framerate framerate = framerates[i % 3];
+            std::vector<TimecodeEvent> events;
+            for (int j = 0; j < 500; j++)
+            {
+                events.push_back(
+                    {Timecode(framerate, Frames(frames(generator) * 1000)), std::string()});
+            }
+            std::sort(events.begin(), events.end(), startsBefore);
+            for (size_t j = 0; j < events.size(); j++)
+            {
+                events[j].data = std::to_string(i) + "." + std::to_string(j);
+            }
+            all.insert(all.end(), events.begin(), events.end());
+            sources.emplace_back(events);
+        }
+        // events at the same time are in the order of their streams
+        std::stable_sort(all.begin(), all.end(), startsBefore);
+
+        std::vector<TimecodeEventSource*> pointers;
+        for (VectorSource& source : sources)
+        {
+            pointers.push_back(&source);
+        }
+        TimecodeMerger merger(pointers);
+        TimecodeEvent event;
+        for (const TimecodeEvent& expected : all)
+        {
+            ASSERT_TRUE(merger.Next(event));
+            ASSERT_EQ(event.data, expected.data);
+        }
+        ASSERT_FALSE(merger.Next(event));
+    }
+}
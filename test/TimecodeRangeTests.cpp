@@ -0,0 +1,182 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <vector>
+#include <tcutils/TimecodeRange.h>
+#ifdef TCUTILS_TEST_PARALLEL_ALGORITHMS
+#include <atomic>
+#include <execution>
+#endif
+
+using namespace testing;
+using namespace Dolby::TcUtils;
+
+class TimecodeRangeTests : public Test
+{
+};
+
+// Test iterating a range matches repeated operator++
+TEST_F(TimecodeRangeTests, Iterate)
+{
+    const Timecode begin(Framerate::FPS_2997DF, "00:00:58;00");
+    const Timecode end(Framerate::FPS_2997DF, "00:10:01;00");
+    const TimecodeRange range(begin, end);
+
+    ASSERT_EQ(range.size(), static_cast<size_t>((end - begin).GetValue()));
+    ASSERT_EQ(range.GetDuration(), end - begin);
+    ASSERT_FALSE(range.empty());
+
+    Timecode expected = begin;
+    size_t count      = 0;
+    for (const Timecode timecode : range)
+    {
+        ASSERT_EQ(timecode, expected);
+        ASSERT_EQ(range[count], expected);
+        ++expected;
+        ++count;
+    }
+    ASSERT_EQ(count, range.size());
+    ASSERT_EQ(expected, end);
+    ASSERT_EQ(*(range.end() - 1), Timecode(Framerate::FPS_2997DF, "00:10:00;29"));
+}
+
+// Test random access iterator operations
+TEST_F(TimecodeRangeTests, RandomAccess)
+{
+    const TimecodeRange range(Timecode(Framerate::FPS_25, "10:00:00:00"),
+                              TimecodeDuration(Framerate::FPS_25, "01:00:00:00"));
+    TimecodeRange::Iterator it = range.begin();
+
+    // clang-format off
+    ASSERT_EQ(std::distance(range.begin(), range.end()), 90000);
+    ASSERT_EQ((*(it + 25)).ToString(),        "10:00:01:00");
+    ASSERT_EQ(it[90000 - 1].ToString(),       "10:59:59:24");
+    ASSERT_EQ((*(2 + it)).ToString(),         "10:00:00:02");
+    ASSERT_EQ((*(range.end() - 25)).ToString(), "10:59:59:00");
+    // clang-format on
+
+    it += 10;
+    ASSERT_EQ(it - range.begin(), 10);
+    ASSERT_EQ((*it++).ToString(), "10:00:00:10");
+    ASSERT_EQ((*it--).ToString(), "10:00:00:11");
+    ASSERT_EQ((*--it).ToString(), "10:00:00:09");
+    ASSERT_TRUE(range.begin() < it);
+    ASSERT_TRUE(it <= it);
+    ASSERT_TRUE(range.end() > it);
+    ASSERT_TRUE(it >= range.begin());
+    ASSERT_TRUE(it != range.begin());
+    ASSERT_EQ(it->ToString(), "10:00:00:09");
+    ASSERT_EQ((it + 1)->GetUnitFrames(), 10);
+
+    const Timecode target(Framerate::FPS_25, "10:30:00:12");
+    const TimecodeRange::Iterator found = std::lower_bound(range.begin(), range.end(), target);
+    ASSERT_EQ(*found, target);
+    ASSERT_EQ(found - range.begin(), 30 * 60 * 25 + 12);
+}
+
+// Test finding the frame that contains a sample with a binary search
+TEST_F(TimecodeRangeTests, FrameForSample)
+{
+    const Samplerate samplerate(48000);
+    const TimecodeRange range(Timecode(Framerate::FPS_2997, "00:59:00:00"),
+                              Timecode(Framerate::FPS_2997, "01:01:00:00"));
+    const auto sampleLess = [samplerate](int64_t sample, const Timecode& timecode)
+    { return sample < timecode.ToSamples(samplerate).GetValue(); };
+
+    for (int64_t offset = 0; offset < 3200; offset += 7)
+    {
+        const int64_t sample = range[0].ToSamples(samplerate).GetValue() + 48048 + offset;
+        const auto next      = std::upper_bound(range.begin(), range.end(), sample, sampleLess);
+        const Timecode frame = *(next - 1);
+        ASSERT_EQ(frame, Timecode(Framerate::FPS_2997, Samples(sample), samplerate,
+                                  RoundingMode::TRUNCATE));
+    }
+}
+
+// Test ranges crossing midnight and constant time lookup
+TEST_F(TimecodeRangeTests, Midnight)
+{
+    const Timecode begin(Framerate::FPS_24, "23:59:59:00");
+    const Timecode end(Framerate::FPS_24, "00:00:01:00");
+    const TimecodeRange range(begin, end);
+
+    ASSERT_EQ(range.size(), 48u);
+    ASSERT_EQ(range[23].ToString(), "23:59:59:23");
+    ASSERT_EQ(range[24].ToString(), "00:00:00:00");
+    ASSERT_EQ(range.IndexOf(Timecode(Framerate::FPS_24, "00:00:00:05")), 29);
+    ASSERT_EQ(range.IndexOf(Timecode(Framerate::FPS_24, "00:00:01:00")), -1);
+    ASSERT_EQ(range.Find(Timecode(Framerate::FPS_24, "12:00:00:00")), range.end());
+    ASSERT_EQ(*range.Find(begin), begin);
+    ASSERT_TRUE(range.Contains(Timecode(Framerate::FPS_24, "23:59:59:10")));
+    ASSERT_FALSE(range.Contains(Timecode(Framerate::FPS_24)));
+    ASSERT_TRUE(TimecodeRange(begin, begin).empty());
+
+    const TimecodeRange days(begin, TimecodeDuration(Framerate::FPS_24, 3 * 24 * 3600 * 24));
+    ASSERT_EQ(days.size(), static_cast<size_t>(3 * 24 * 3600 * 24));
+    ASSERT_EQ(days[3 * 24 * 3600 * 24 - 1].ToString(), "23:59:58:23");
+    ASSERT_EQ(days.IndexOf(begin), 0);
+}
+
+// Test ranges that don't wrap at midnight
+TEST_F(TimecodeRangeTests, Continue)
+{
+    const Timecode begin(Framerate::FPS_30, "98:00:00:00", WrapMode::CONTINUE);
+    const Timecode end(Framerate::FPS_30, "99:00:00:00", WrapMode::CONTINUE);
+    const TimecodeRange range(begin, end);
+
+    ASSERT_EQ(range.size(), 108000u);
+    ASSERT_EQ((*range.begin()).ToString(), "98:00:00:00");
+    ASSERT_EQ((*(range.end() - 1)).GetWrapMode(), WrapMode::CONTINUE);
+
+    ASSERT_THROW(TimecodeRange(end, begin), TimecodeRange::InvalidRange);
+    ASSERT_THROW(TimecodeRange(begin, TimecodeDuration(Framerate::FPS_30, -1)),
+                 TimecodeRange::InvalidRange);
+    ASSERT_THROW(TimecodeRange(begin, TimecodeDuration(Framerate::FPS_30, "03:00:00:00")),
+                 Timecode::ValueOutOfRange);
+    ASSERT_NO_THROW(TimecodeRange(begin, TimecodeDuration(Framerate::FPS_30, "02:00:00:00")));
+    ASSERT_THROW(TimecodeRange(begin, Timecode(Framerate::FPS_25, "99:00:00:00")),
+                 std::logic_error);
+    ASSERT_THROW(TimecodeRange(Timecode(Framerate::FPS_30), end), Timecode::ValueOutOfRange);
+}
+
+#ifdef TCUTILS_TEST_PARALLEL_ALGORITHMS
+// Test using the range with parallel algorithms
+TEST_F(TimecodeRangeTests, ParallelForEach)
+{
+    const TimecodeRange range(Timecode(Framerate::FPS_25, "00:00:00:00"),
+                              Timecode(Framerate::FPS_25, "01:00:00:00"));
+    std::atomic<int64_t> sum(0);
+    std::for_each(std::execution::par,
+                  range.begin(),
+                  range.end(),
+                  [&sum](const Timecode& timecode) { sum += timecode.ToFrames().GetValue(); });
+    ASSERT_EQ(sum.load(), int64_t(90000) * 89999 / 2);
+}
+#endif
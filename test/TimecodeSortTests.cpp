@@ -0,0 +1,194 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <random>
+#include <unordered_set>
+#include <vector>
+#include <tcutils/TimecodeSort.h>
+
+using namespace testing;
+using namespace Dolby::TcUtils;
+
+class TimecodeSortTests : public Test
+{
+};
+
+namespace
+{
+    std::vector<Timecode> RandomTimecodes(Framerate framerate, size_t count, WrapMode wrapMode)
+    {
+        const int hours = wrapMode == WrapMode::CONTINUE ? 99 : 23;
+        const Timecode last(framerate, hours, 59, 59, 0, wrapMode);
+        std::uniform_int_distribution<int32_t> frame(0, last.ToFrames().GetValue());
+        std::mt19937 random(39);
+        std::vector<Timecode> timecodes;
+        timecodes.reserve(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            timecodes.emplace_back(framerate, Frames(frame(random)), wrapMode);
+        }
+        return timecodes;
+    }
+}
+
+// Test sorting timecodes in the order of operator<
+TEST_F(TimecodeSortTests, Timecodes)
+{
+    for (Framerate framerate : Framerate::Range())
+    {
+        std::vector<Timecode> timecodes = RandomTimecodes(framerate, 5000, WrapMode::CONTINUE);
+        timecodes[10] = Timecode(framerate);
+        std::vector<Timecode> expected  = timecodes;
+        std::stable_sort(expected.begin(), expected.end());
+
+        TimecodeSort::Sort(timecodes.data(), timecodes.size());
+        ASSERT_EQ(timecodes, expected) << framerate.ToString();
+        ASSERT_FALSE(timecodes[0].IsSet());
+    }
+
+    // custom framerates
+    const Framerate fps240(Rational(240, 1));
+    std::vector<Timecode> timecodes = RandomTimecodes(fps240, 5000, WrapMode::DEFAULT);
+    std::vector<Timecode> expected  = timecodes;
+    std::sort(expected.begin(), expected.end());
+    TimecodeSort::Sort(timecodes.data(), timecodes.size());
+    ASSERT_EQ(timecodes, expected);
+
+    // stable for timecodes that are equal with different wrap modes
+    std::vector<Timecode> wrapped = {
+        Timecode(Framerate::FPS_25, "01:00:00:00", WrapMode::CONTINUE),
+        Timecode(Framerate::FPS_25, "00:00:00:00"),
+        Timecode(Framerate::FPS_25, "01:00:00:00")};
+    TimecodeSort::Sort(wrapped.data(), wrapped.size());
+    ASSERT_EQ(wrapped[1].GetWrapMode(), WrapMode::CONTINUE);
+    ASSERT_EQ(wrapped[2].GetWrapMode(), WrapMode::WRAP_AT_MIDNIGHT);
+
+    TimecodeSort::Sort(static_cast<Timecode*>(nullptr), 0);
+    timecodes[100] = Timecode(Framerate::FPS_25, "01:00:00:00");
+    ASSERT_THROW(TimecodeSort::Sort(timecodes.data(), timecodes.size()), std::logic_error);
+}
+
+// Test sorting timecodes with subframes and with remaining samples; at 24 fps and 44.1 kHz, frames
+// start at half samples and remainders can be negative
+TEST_F(TimecodeSortTests, SubframesAndSamples)
+{
+    const std::pair<Framerate, Samplerate> rates[] = {
+        {Framerate::FPS_2997DF, Samplerate(48000)}, {Framerate::FPS_24, Samplerate(44100)}};
+    for (const auto& rate : rates)
+    {
+        const Framerate framerate   = rate.first;
+        const Samplerate samplerate = rate.second;
+        std::mt19937 random(39);
+        std::uniform_int_distribution<int64_t> sample(0, int64_t(48000) * 3600 * 2);
+        std::vector<TimecodeSubframes> subframes;
+        std::vector<TimecodeSamples> samples;
+        for (int i = 0; i < 5000; i++)
+        {
+            const Samples position(sample(random) / (i % 2 == 0 ? 1 : 2000));
+            subframes.emplace_back(framerate, position, samplerate, 80);
+            samples.emplace_back(framerate, position, samplerate);
+        }
+        // the samples around frame starts
+        for (int32_t frame = 1; frame < 50; frame++)
+        {
+            const int64_t start =
+                Timecode(framerate, Frames(frame)).ToSamples(samplerate).GetValue();
+            for (int64_t offset = -1; offset <= 1; offset++)
+            {
+                samples.emplace_back(framerate, Samples(start + offset), samplerate);
+            }
+        }
+        std::shuffle(samples.begin(), samples.end(), random);
+
+        TimecodeSort::Sort(subframes.data(), subframes.size());
+        TimecodeSort::Sort(samples.data(), samples.size());
+        for (size_t i = 1; i < subframes.size(); i++)
+        {
+            const TimecodeSubframes& a = subframes[i - 1];
+            const TimecodeSubframes& b = subframes[i];
+            ASSERT_TRUE(a.GetTimecode() < b.GetTimecode() ||
+                        (a.GetTimecode() == b.GetTimecode() &&
+                         a.GetSubframesNum() <= b.GetSubframesNum()));
+        }
+        bool negative = false;
+        for (size_t i = 1; i < samples.size(); i++)
+        {
+            ASSERT_LE(samples[i - 1].GetTimecode().ToSamples(samplerate).GetValue() +
+                          samples[i - 1].GetRemainder().GetValue(),
+                      samples[i].GetTimecode().ToSamples(samplerate).GetValue() +
+                          samples[i].GetRemainder().GetValue());
+            negative = negative || samples[i].GetRemainder().GetValue() < 0;
+        }
+        ASSERT_EQ(negative, framerate == Framerate::FPS_24);
+
+        subframes[100] = TimecodeSubframes(framerate, Samples(0), samplerate, 100);
+        ASSERT_THROW(TimecodeSort::Sort(subframes.data(), subframes.size()), std::logic_error);
+        samples[100] = TimecodeSamples(Framerate::FPS_25, Samples(0), samplerate);
+        ASSERT_THROW(TimecodeSort::Sort(samples.data(), samples.size()), std::logic_error);
+    }
+}
+
+// Test that the parallel sort gives the same result as the sort
+TEST_F(TimecodeSortTests, Parallel)
+{
+    std::vector<Timecode> timecodes =
+        RandomTimecodes(Framerate::FPS_50, 1 << 20, WrapMode::CONTINUE);
+    std::vector<Timecode> expected  = timecodes;
+    TimecodeSort::Sort(expected.data(), expected.size());
+    ASSERT_TRUE(std::is_sorted(expected.begin(), expected.end()));
+
+    TimecodeSort::ParallelSort(timecodes.data(), timecodes.size(), 4);
+    ASSERT_EQ(timecodes, expected);
+
+    timecodes[1000] = Timecode(Framerate::FPS_25, "01:00:00:00");
+    ASSERT_THROW(TimecodeSort::ParallelSort(timecodes.data(), timecodes.size()),
+                 std::logic_error);
+}
+
+// Test hashing timecodes in unordered containers
+TEST_F(TimecodeSortTests, Hash)
+{
+    const std::hash<Timecode> hash;
+    ASSERT_EQ(hash(Timecode(Framerate::FPS_25, "01:00:00:00")),
+              hash(Timecode(Framerate::FPS_25, "01:00:00:00", WrapMode::CONTINUE)));
+
+    std::unordered_set<Timecode> set;
+    for (Framerate framerate : {Framerate(Framerate::FPS_2997), Framerate(Framerate::FPS_30)})
+    {
+        for (int frame = 0; frame < 10000; frame++)
+        {
+            set.insert(Timecode(framerate, Frames(frame)));
+        }
+        set.insert(Timecode(framerate));
+    }
+    ASSERT_EQ(set.size(), 20002u);
+    ASSERT_EQ(set.count(Timecode(Framerate::FPS_30, "00:05:33:09")), 1u);
+    ASSERT_EQ(set.count(Timecode(Framerate::FPS_30, "00:05:33:10")), 0u);
+    ASSERT_EQ(set.count(Timecode(Framerate::FPS_2997)), 1u);
+}
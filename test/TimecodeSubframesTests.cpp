@@ -75,6 +75,27 @@ TEST_F(TimecodeSubframesTests, SubframeBasicCases)
     ASSERT_EQ(0, toFrames(midSubframe));
 }
 
+// Test frames that start halfway between two samples, as at 24 fps and 44.1 kHz
+TEST_F(TimecodeSubframesTests, SubframeHalfSampleBoundary)
+{
+    auto toFrames = [](TimecodeSubframes t) { return t.GetTimecode().ToFrames().GetValue(); };
+
+    const Framerate fr(24);
+    const Samplerate sr(44100);
+
+    // frame 1 starts at sample 1837.5: sample 1837 is in frame 1 by its center
+    TimecodeSubframes halfway(fr, Samples(1837), sr, 100);
+    ASSERT_EQ(0, halfway.GetSubframesNum());
+    ASSERT_EQ(1, toFrames(halfway));
+
+    for (int64_t i = 0; i < 44100 * 2; i++)
+    {
+        TimecodeSubframes result(fr, Samples(i), sr, 100);
+        ASSERT_GE(result.GetSubframesNum(), 0);
+        ASSERT_LT(result.GetSubframesNum(), 100);
+    }
+}
+
 TEST_F(TimecodeSubframesTests, SubframeContinuity)
 {
     std::vector<int> denoms{10, 80, 100};
@@ -31,6 +31,7 @@
 #include <gtest/gtest.h>
 #include <iostream>
 #include <sstream>
+#include <vector>
 #include <tcutils/Convert.h>
 #include <tcutils/FrameBoundary.h>
 #include <tcutils/Framerate.h>
@@ -797,6 +798,83 @@ TEST_F(TimecodeTests, ToSamplesSymmetry)
     }
 }
 
+TEST_F(TimecodeTests, ToTicksSymmetry)
+{
+    for (auto framerate : Framerate::values())
+    {
+        Timecode tcPrevReference;
+        Timecode tcReference(framerate, 0, 0, 0, 0);
+        int i = 0;
+        do
+        {
+            // check every frame for the first 100000 frames, after that check every 17th frame,
+            // unless env var TCUTILS_FULL_STRESS_TEST is set to YES.
+            if (FullStressTest::Active() || i < 100000 || (i % 17) == 0)
+            {
+                // the first tick at or after the exact frame start
+                const int64_t frames = tcReference.ToFrames().GetValue();
+                const int64_t fps    = framerate.GetFrameCount();
+                const int64_t expectedTicks =
+                    framerate.IsRatio1001()
+                        ? (frames * 48000 * 1001 + fps * 1000 - 1) / (fps * 1000)
+                        : frames * 48000 / fps;
+                ASSERT_EQ(tcReference.ToTicks<48000>().GetValue(), expectedTicks);
+
+                const Nanoseconds ns = tcReference.ToTicks<1000000000>();
+                ASSERT_EQ(Timecode(framerate, ns, RoundingMode::TRUNCATE), tcReference);
+                ASSERT_EQ(Timecode(framerate, ns, RoundingMode::NEAREST), tcReference);
+                ASSERT_EQ(Timecode(framerate, Nanoseconds(ns.GetValue() + 1000)), tcReference);
+                if (i > 0)
+                {
+                    ASSERT_EQ(Timecode(framerate, Nanoseconds(ns.GetValue() - 1),
+                                       RoundingMode::TRUNCATE),
+                              tcPrevReference);
+                }
+                const auto duration = tcReference.ToDuration<std::chrono::nanoseconds>();
+                ASSERT_EQ(duration.count(), ns.GetValue());
+                ASSERT_EQ(Timecode(framerate, duration, RoundingMode::TRUNCATE), tcReference);
+            }
+            tcPrevReference = tcReference;
+            ++tcReference;
+            i++;
+        } while (tcReference != Timecode(framerate, 0, 0, 0, 0));
+    }
+}
+
+TEST_F(TimecodeTests, FromTicks)
+{
+    using std::chrono::hours;
+    using std::chrono::milliseconds;
+    using std::chrono::seconds;
+
+    const Framerate pal(Framerate::FPS_25);
+    const Framerate ntsc(Framerate::FPS_2997);
+
+    // clang-format off
+    ASSERT_EQ(Timecode(pal, seconds(3600)),               Timecode(pal, "01:00:00:00"));
+    ASSERT_EQ(Timecode(ntsc, milliseconds(1001)),         Timecode(ntsc, "00:00:01:00"));
+    ASSERT_EQ(Timecode(ntsc, milliseconds(1000)),         Timecode(ntsc, "00:00:01:00"));
+    ASSERT_EQ(Timecode(ntsc, milliseconds(982)),          Timecode(ntsc, "00:00:00:29"));
+    ASSERT_EQ(Timecode(ntsc, milliseconds(960)),          Timecode(ntsc, "00:00:00:29"));
+    ASSERT_EQ(Timecode(ntsc, milliseconds(1000), RoundingMode::TRUNCATE),
+              Timecode(ntsc, "00:00:00:29"));
+    ASSERT_EQ(Timecode(ntsc, milliseconds(960), RoundingMode::TRUNCATE),
+              Timecode(ntsc, "00:00:00:28"));
+    // multi-day timelines stay exact
+    ASSERT_EQ(Timecode(Framerate::FPS_120, hours(24 * 200) + milliseconds(500)),
+              Timecode(Framerate::FPS_120, "00:00:00:060"));
+    ASSERT_EQ(Timecode(Framerate::FPS_24, Ticks<48000>(48000)),
+              Timecode(Framerate::FPS_24, "00:00:01:00"));
+    ASSERT_FALSE(Timecode(Framerate::FPS_24, Nanoseconds(-1)).IsSet());
+    ASSERT_THROW(Timecode(Framerate::FPS_24, hours(24 * 365 * 3)), Timecode::ValueOutOfRange);
+    // clang-format on
+
+    ASSERT_EQ(Timecode(Framerate::FPS_2997DF, "00:10:00;00").ToDuration<milliseconds>().count(),
+              600000);
+    ASSERT_EQ(Timecode(Framerate::FPS_2997DF, "01:00:00;00").ToTicks<1000000000>(),
+              Nanoseconds(3599996400000));
+}
+
 TEST_F(TimecodeTests, RoundingModeTruncate)
 {
     const Samplerate sr{48000.0};
@@ -892,3 +970,128 @@ TEST_F(TimecodeTests, FromStringToSamples)
             str1Min);
     }
 }
+
+TEST_F(TimecodeTests, ConvertTo)
+{
+    const Framerate pal(Framerate::FPS_25);
+    const Framerate film(Framerate::FPS_23976);
+    const Framerate df(Framerate::FPS_2997DF);
+    const Framerate ntsc(Framerate::FPS_2997);
+
+    // clang-format off
+    ASSERT_EQ(Timecode(pal, "01:00:00:00").ConvertTo(film, RoundingMode::TRUNCATE),
+              Timecode(film, "00:59:56:09"));
+    ASSERT_EQ(Timecode(pal, "01:00:00:00").ConvertTo(film),   Timecode(film, "00:59:56:10"));
+    ASSERT_EQ(Timecode(df, "00:10:00;00").ConvertTo(ntsc),    Timecode(ntsc, "00:09:59:12"));
+    ASSERT_EQ(Timecode(ntsc, "00:09:59:12").ConvertTo(df),    Timecode(df, "00:10:00;00"));
+    ASSERT_EQ(Timecode(Framerate::FPS_24, "00:00:01:12").ConvertTo(Framerate::FPS_48),
+              Timecode(Framerate::FPS_48, "00:00:01:24"));
+    ASSERT_EQ(Timecode(pal, "23:59:59:24").ConvertTo(film),   Timecode(film, "23:58:33:16"));
+    ASSERT_EQ(Timecode(film, "23:59:59:23").ConvertTo(pal),   Timecode(pal, "00:01:26:09"));
+    ASSERT_EQ(Timecode(film, "23:59:59:23", WrapMode::CONTINUE).ConvertTo(pal),
+              Timecode(pal, "24:01:26:09", WrapMode::CONTINUE));
+    ASSERT_FALSE(Timecode(pal).ConvertTo(film).IsSet());
+    ASSERT_FALSE(Timecode(pal, "01:00:00:00").ConvertTo(Framerate::UNDEFINED).IsSet());
+    // clang-format on
+
+    // matches conversion through seconds, and round-trips through a faster framerate
+    std::vector<Timecode> timecodes;
+    for (auto from : Framerate::values())
+    {
+        for (int32_t frames = 0; frames < 86400 * 24; frames += 1009)
+        {
+            timecodes.push_back(Timecode(from, Frames(frames), WrapMode::CONTINUE));
+        }
+    }
+    for (auto to : Framerate::values())
+    {
+        for (auto mode : {RoundingMode::TRUNCATE, RoundingMode::NEAREST})
+        {
+            std::vector<Timecode> converted(timecodes.size());
+            Timecode::ConvertTo(timecodes.data(), timecodes.size(), to, converted.data(), mode);
+            for (size_t i = 0; i < timecodes.size(); i++)
+            {
+                const Timecode& timecode = timecodes[i];
+                ASSERT_EQ(converted[i], timecode.ConvertTo(to, mode));
+                const double seconds = timecode.ToSeconds().GetValue();
+                const Seconds start = converted[i].ToSeconds();
+                const Seconds end   = Timecode(to, Frames(converted[i].ToFrames().GetValue() + 1),
+                                             WrapMode::CONTINUE)
+                                        .ToSeconds();
+                if (mode == RoundingMode::TRUNCATE && converted[i].ToFrames().GetValue() > 0)
+                {
+                    ASSERT_LE(start.GetValue(), seconds + 1e-9);
+                    ASSERT_GT(end.GetValue(), seconds + 1e-9);
+                }
+                if (mode == RoundingMode::NEAREST &&
+                    to.GetFrameCount() >= 2 * timecode.GetFramerate().GetFrameCount())
+                {
+                    ASSERT_EQ(converted[i].ConvertTo(timecode.GetFramerate(), mode), timecode);
+                }
+            }
+        }
+    }
+}
+
+TEST_F(TimecodeTests, Compare)
+{
+    const Framerate pal(Framerate::FPS_25);
+    const Framerate df(Framerate::FPS_2997DF);
+    const Framerate ntsc(Framerate::FPS_2997);
+
+    // clang-format off
+    ASSERT_EQ(Timecode::Compare(Timecode(pal, "01:00:00:00"), Timecode(pal, "01:00:00:00")), 0);
+    ASSERT_LT(Timecode::Compare(Timecode(pal, "01:00:00:00"), Timecode(pal, "01:00:00:01")), 0);
+    ASSERT_GT(Timecode::Compare(Timecode(pal, "00:00:01:00"),
+                                Timecode(Framerate::FPS_24, "00:00:00:23")), 0);
+    // 00:10:00;00 drop-frame starts at the same time as 00:09:59:12 non-drop
+    ASSERT_LT(Timecode::Compare(Timecode(ntsc, "00:09:59:11"), Timecode(df, "00:10:00;00")), 0);
+    ASSERT_GT(Timecode::Compare(Timecode(ntsc, "00:09:59:13"), Timecode(df, "00:10:00;00")), 0);
+    ASSERT_NE(Timecode::Compare(Timecode(ntsc, "00:09:59:12"), Timecode(df, "00:10:00;00")), 0);
+    ASSERT_EQ(Timecode::Compare(Timecode(ntsc, "00:09:59:12"), Timecode(df, "00:10:00;00")),
+              -Timecode::Compare(Timecode(df, "00:10:00;00"), Timecode(ntsc, "00:09:59:12")));
+    ASSERT_LT(Timecode::Compare(Timecode(pal), Timecode(pal, "00:00:00:00")), 0);
+    ASSERT_EQ(Timecode::Compare(Timecode(pal), Timecode(pal)), 0);
+    // clang-format on
+
+    // sorting events of mixed framerates orders them by time
+    std::vector<Timecode> timecodes;
+    for (auto framerate : Framerate::values())
+    {
+        for (int32_t frames = 0; frames < 100000; frames += 997)
+        {
+            timecodes.push_back(Timecode(framerate, Frames(frames)));
+        }
+    }
+    std::sort(timecodes.begin(), timecodes.end(), Timecode::TimeOrder());
+    for (size_t i = 1; i < timecodes.size(); i++)
+    {
+        ASSERT_LE(timecodes[i - 1].ToSeconds().GetValue(), timecodes[i].ToSeconds().GetValue());
+        ASSERT_LT(Timecode::Compare(timecodes[i - 1], timecodes[i]), 0);
+    }
+}
+
+// Test timecode at custom framerates
+TEST_F(TimecodeTests, CustomFramerate)
+{
+    const Framerate fps72(Rational(72));
+    const Framerate fps47952(Rational(48000, 1001));
+
+    const Timecode timecode72(fps72, "01:00:00:71");
+    ASSERT_EQ(timecode72.ToFrames().GetValue(), 3600 * 72 + 71);
+    ASSERT_EQ(timecode72.ToString(), "01:00:00:71");
+    ASSERT_EQ(Timecode(fps72, Samples(48000), Samplerate(48000)).ToString(), "00:00:01:00");
+    ASSERT_EQ(Timecode(fps72, "00:00:01:00").ToSamples(Samplerate(48000)).GetValue(), 48000);
+    ASSERT_EQ(Timecode(fps72, "00:00:00:01").ToSamples(Samplerate(48000)).GetValue(), 667);
+
+    ASSERT_EQ(Timecode(fps47952, Frames(48)).ToSamples(Samplerate(48000)).GetValue(), 48048);
+    ASSERT_EQ(Timecode(fps47952, Samples(48048), Samplerate(48000)).ToFrames().GetValue(), 48);
+
+    // 23.976 to 47.952 is exactly two frames per frame
+    const Timecode film(Framerate::FPS_23976, "00:10:00:12");
+    ASSERT_EQ(film.ConvertTo(fps47952).ToString(), "00:10:00:24");
+    ASSERT_EQ(film.ConvertTo(fps47952).ConvertTo(Framerate::FPS_23976), film);
+
+    ASSERT_THROW(Timecode(fps72, "00:00:00:72"), Timecode::ValueOutOfRange);
+    ASSERT_TRUE(Timecode::Compare(Timecode(fps72, Frames(72)), Timecode(fps72, Frames(73))) < 0);
+}
@@ -0,0 +1,177 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022-2023, Dolby International AB.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+// and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of
+// conditions and the following disclaimer in the documentation and/or other materials provided with
+// the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be used to
+// endorse or promote products derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
+// WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include <tcutils/TimecodeDuration.h>
+#include <tcutils/VfrTimecodeMap.h>
+
+using namespace testing;
+using namespace Dolby::TcUtils;
+
+class VfrTimecodeMapTests : public Test
+{
+};
+
+namespace
+{
+    // Timestamps at 90 kHz of footage at about 30 fps, with jitter and some dropped frames
+    std::vector<int64_t> JitteredTimestamps(size_t count, unsigned seed)
+    {
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<int64_t> jitter(-600, 600);
+        std::uniform_int_distribution<int> drop(0, 99);
+        std::vector<int64_t> timestamps;
+        int64_t time = 0;
+        while (timestamps.size() < count)
+        {
+            timestamps.push_back(time + (timestamps.empty() ? 0 : jitter(generator)));
+            time += drop(generator) == 0 ? 6000 : 3000;
+        }
+        return timestamps;
+    }
+
+    // The last frame with a timestamp not after the time, by linear search
+    int64_t LastFrameAtOrBefore(const std::vector<int64_t>& timestamps, double time)
+    {
+        int64_t frame = -1;
+        for (size_t i = 0; i < timestamps.size() && static_cast<double>(timestamps[i]) <= time;
+             i++)
+        {
+            frame = static_cast<int64_t>(i);
+        }
+        return frame;
+    }
+}
+
+// Test that constant-rate timestamps map to consecutive timecodes and back
+TEST_F(VfrTimecodeMapTests, ConstantRate)
+{
+    const Timecode start(Framerate::FPS_2997DF, 0, 59, 59, 0);
+    std::vector<int64_t> timestamps;
+    for (int64_t i = 0; i < 5000; i++)
+    {
+        timestamps.push_back(1000000 + i * 3003);
+    }
+    const VfrTimecodeMap map(timestamps, 1, 90000, start);
+    ASSERT_EQ(map.GetFrameCount(), 5000u);
+    ASSERT_FALSE(map.IsView());
+
+    std::vector<Timecode> timecodes(map.GetFrameCount());
+    map.ToTimecodes(timecodes.data(), RoundingMode::TRUNCATE);
+    Timecode expected = start;
+    for (size_t i = 0; i < timecodes.size(); i++, ++expected)
+    {
+        ASSERT_EQ(timecodes[i], expected);
+        ASSERT_EQ(map.ToTimecode(i, RoundingMode::NEAREST), expected);
+        ASSERT_EQ(map.ToFrame(expected), static_cast<int64_t>(i));
+        ASSERT_EQ(map.ToFrame(expected, RoundingMode::NEAREST), static_cast<int64_t>(i));
+    }
+    ASSERT_EQ(map.FindFrame(999999), -1);
+    ASSERT_EQ(map.FindFrame(1000000 + 3003 * 4999 + 100000), 4999);
+}
+
+// Test jittered timestamps against Timecode construction from ticks, and a linear search
+TEST_F(VfrTimecodeMapTests, Jittered)
+{
+    const std::vector<int64_t> timestamps = JitteredTimestamps(20000, 42);
+    for (Framerate framerate : {Framerate(Framerate::FPS_24),
+                                Framerate(Framerate::FPS_2997),
+                                Framerate(Framerate::FPS_2997DF),
+                                Framerate(Framerate::FPS_60)})
+    {
+        const Timecode start(framerate, 0, 0, 0, 0);
+        const VfrTimecodeMap map = VfrTimecodeMap::View(
+            timestamps.data(), timestamps.size(), 1, 90000, start);
+        ASSERT_TRUE(map.IsView());
+        for (size_t i = 0; i < timestamps.size(); i += 7)
+        {
+            const Ticks<90000> ticks(timestamps[i]);
+            ASSERT_EQ(map.ToTimecode(i, RoundingMode::TRUNCATE),
+                      Timecode(framerate, ticks, RoundingMode::TRUNCATE));
+            ASSERT_EQ(map.ToTimecode(i, RoundingMode::NEAREST),
+                      Timecode(framerate, ticks, RoundingMode::NEAREST));
+        }
+
+        const TimecodeDuration step(framerate, 13);
+        for (Timecode timecode = start; timecode.ToFrames().GetValue() < 30000; timecode += step)
+        {
+            const double time = timecode.ToSeconds().GetValue() * 90000.0;
+            const int64_t truncated = LastFrameAtOrBefore(timestamps, time + 1e-6);
+            ASSERT_EQ(map.ToFrame(timecode), truncated) << timecode;
+
+            int64_t nearest = truncated;
+            if (truncated + 1 < static_cast<int64_t>(timestamps.size()) &&
+                static_cast<double>(timestamps[truncated + 1]) - time <=
+                    time - static_cast<double>(timestamps[truncated]) + 1e-6)
+            {
+                nearest = truncated + 1;
+            }
+            ASSERT_EQ(map.ToFrame(timecode, RoundingMode::NEAREST), nearest) << timecode;
+        }
+    }
+}
+
+// Test the wrap mode of the start timecode and invalid tables
+TEST_F(VfrTimecodeMapTests, WrapAndErrors)
+{
+    const std::vector<int64_t> timestamps = {0, 1000, 2000, 3000};
+    const Timecode start(Framerate::FPS_25, 23, 59, 59, 23);
+
+    // 1000 ticks of 1 / 25000 seconds are one frame at 25 fps
+    const VfrTimecodeMap wrapping(timestamps, 1, 25000, start);
+    ASSERT_EQ(wrapping.ToTimecode(2).ToString(), "00:00:00:00");
+    ASSERT_EQ(wrapping.ToFrame(Timecode(Framerate::FPS_25, "00:00:00:01")), 3);
+
+    const VfrTimecodeMap continuing(
+        timestamps, 1, 25000, Timecode(Framerate::FPS_25, 23, 59, 59, 23, WrapMode::CONTINUE));
+    ASSERT_EQ(continuing.ToTimecode(2).ToString(), "24:00:00:00");
+    ASSERT_EQ(continuing.ToFrame(Timecode(Framerate::FPS_25, "00:00:00:01", WrapMode::CONTINUE)),
+              -1);
+    ASSERT_EQ(continuing.ToFrame(
+                  Timecode(Framerate::FPS_25, "00:00:00:01", WrapMode::CONTINUE),
+                  RoundingMode::NEAREST),
+              0);
+
+    const std::vector<int64_t> unsorted = {0, 1000, 1000};
+    ASSERT_THROW(VfrTimecodeMap(unsorted, 1, 25000, start), VfrTimecodeMap::UnsortedTimestamps);
+    // views are checked on request, or where a search visits them
+    const VfrTimecodeMap view = VfrTimecodeMap::View(unsorted.data(), 3, 1, 25000, start);
+    ASSERT_THROW(view.Validate(), VfrTimecodeMap::UnsortedTimestamps);
+    const std::vector<int64_t> swapped = {0, 3000, 2000, 1000, 4000};
+    const VfrTimecodeMap swappedView   = VfrTimecodeMap::View(swapped.data(), 5, 1, 25000, start);
+    ASSERT_THROW(swappedView.FindFrame(2500), VfrTimecodeMap::UnsortedTimestamps);
+    ASSERT_EQ(swappedView.FindFrame(4000), 4);
+    ASSERT_THROW(VfrTimecodeMap::View(timestamps.data(), 0, 1, 25000, start),
+                 VfrTimecodeMap::InvalidParameter);
+    ASSERT_THROW(VfrTimecodeMap({}, 1, 25000, start), VfrTimecodeMap::InvalidParameter);
+    ASSERT_THROW(VfrTimecodeMap(timestamps, 0, 25000, start), VfrTimecodeMap::InvalidParameter);
+    ASSERT_THROW(VfrTimecodeMap(timestamps, 1, 25000, Timecode()),
+                 VfrTimecodeMap::InvalidParameter);
+    ASSERT_THROW(wrapping.ToFrame(Timecode(Framerate::FPS_24, "00:00:00:00")), std::logic_error);
+}
@@ -25,19 +25,46 @@
 // WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY
 // WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <csignal>
+#include <cstdio> // snprintf
+#include <cstdlib> // getenv
+#include <cstring>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
-#include <limits> // digits10
+#include <limits> // digits10, max
+#include <map>
+#include <memory>
+#include <mutex>
 #include <regex>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
 #include <tcutils/Convert.h>
+#include <tcutils/FrameBoundary.h>
 #include <tcutils/Framerate.h>
 #include <tcutils/Timecode.h>
+#include <tcutils/TimecodeExternalSort.h>
+#include <tcutils/TimecodeMerger.h>
 #include <tcutils/TimecodeSubframes.h>
 #include <tcutils/Version.h>
 
+#include "MappedFile.h"
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
 using namespace Dolby::TcUtils;
 
 namespace
@@ -95,250 +122,1487 @@ namespace
         };
 
         Enum formatEnum;
-        std::regex re;
+        // the prefix of the value, and whether the value is an integer or a decimal number
+        const char* prefix;
+        bool integer;
         const char* formatString;
         const char* what;
     };
 
     const TimeFormatInfo timeArgFormatInfo[] = {
-        {TimeFormatInfo::TIMECODE,
-         std::regex("^([0-9][0-9]:[0-9][0-9]:[0-9][0-9][:;][0-9][0-9])$"),
-         "hh:mm:ss:ff",
-         "timecode"},
-        {TimeFormatInfo::T_REAL,
-         std::regex("^t_real=([0-9]+([.][0-9]*)?|[.][0-9]+)$"),
-         "t_real=floating-point",
-         "real-time in seconds"},
-        {TimeFormatInfo::T_DAMF,
-         std::regex("^t_damf=([0-9]+([.][0-9]*)?|[.][0-9]+)$"),
-         "t_damf=floating-point",
-         "DAMF-time in seconds"},
-        {TimeFormatInfo::FRAMES, std::regex("^frames=([0-9]+)$"), "frames=integer", "frame count"},
-        {TimeFormatInfo::SAMPLE,
-         std::regex("^sample=([0-9]+)$"),
-         "sample=integer",
-         "sample position"},
-        {TimeFormatInfo::UNDEFINED, std::regex(""), nullptr, nullptr}};
-
-} // namespace
-
-int main(int argc, char** argv)
-{
-    // Variables to store parsed arguments, with defaults when no argument is
-    // given
-    Framerate framerate("24");
-    Samplerate samplerate(48000.0);
-    RoundingMode roundingMode(RoundingMode::NEAREST);
-
-    std::cout << std::endl;
-    std::cout << "Dolby TcUtils tcutility - version " << Version::GetString() << std::endl;
-    std::cout << "This utility converts a given time into all formats handled by TcUtils."
-              << std::endl
-              << std::endl;
+        {TimeFormatInfo::TIMECODE, "", false, "hh:mm:ss:ff", "timecode"},
+        {TimeFormatInfo::T_REAL, "t_real=", false, "t_real=floating-point", "real-time in seconds"},
+        {TimeFormatInfo::T_DAMF, "t_damf=", false, "t_damf=floating-point", "DAMF-time in seconds"},
+        {TimeFormatInfo::FRAMES, "frames=", true, "frames=integer", "frame count"},
+        {TimeFormatInfo::SAMPLE, "sample=", true, "sample=integer", "sample position"},
+        {TimeFormatInfo::UNDEFINED, "", false, nullptr, nullptr}};
 
-    if (argc < 2 ||
-        (argc == 2 && (std::string(argv[1]) == "--help" || std::string(argv[1]) == "-h")))
+    // Matches [0-9]+ for integers, and [0-9]+([.][0-9]*)?|[.][0-9]+ otherwise, from pos to the end
+    bool IsNumber(const std::string& str, size_t pos, bool integer)
     {
-        // show usage when no arguments are given or -h / --help
-        size_t maxFormatStringLength = 0;
-        for (size_t i = 0; timeArgFormatInfo[i].what != nullptr; i++)
+        bool digits = false;
+        bool point  = false;
+        for (size_t i = pos; i < str.size(); i++)
         {
-            std::string formatString(timeArgFormatInfo[i].formatString);
-            maxFormatStringLength = std::max(maxFormatStringLength, formatString.length());
+            if (str[i] >= '0' && str[i] <= '9')
+            {
+                digits = true;
+            }
+            else if (str[i] == '.' && !integer && !point)
+            {
+                point = true;
+            }
+            else
+            {
+                return false;
+            }
         }
+        return digits;
+    }
 
-        std::cout << "Usage: [time] <framerate> <samplerate> <rounding-mode>" << std::endl
-                  << std::endl;
-        std::cout << "  time is required and can be given in the following formats:" << std::endl
-                  << std::endl;
-
-        for (size_t i = 0; timeArgFormatInfo[i].what != nullptr; i++)
+    // Parse the integer from position pos of str, e.g. the n of --threads=n; false if str has no
+    // integer there or it is above max
+    bool ParseCount(const std::string& str,
+                    size_t pos,
+                    unsigned long long max,
+                    unsigned long long& value)
+    {
+        if (!IsNumber(str, pos, true))
         {
-            std::string formatString(timeArgFormatInfo[i].formatString);
-            std::cout << "    " << formatString
-                      << std::string(maxFormatStringLength + 3 - formatString.length(), ' ')
-                      << timeArgFormatInfo[i].what << std::endl;
+            return false;
         }
-
-        std::cout << std::endl;
-        std::cout << "  framerate, samplerate and rounding-mode are optional" << std::endl
-                  << std::endl;
-        std::cout << "  framerate can be one of the following:" << std::endl << std::endl;
-        for (auto value : Framerate::values())
+        try
         {
-            std::cout << "    " << value.ToString() << (framerate == value ? " (default)" : "")
-                      << std::endl;
+            value = std::stoull(str.substr(pos));
         }
-        std::cout << std::endl << "  samplerate default is " << samplerate.GetValue() << std::endl;
-        std::cout << std::endl
-                  << "  rounding-mode can be " << ToString(RoundingMode(RoundingMode::NEAREST))
-                  << " and " << ToString(RoundingMode(RoundingMode::TRUNCATE)) << ". Default is "
-                  << ToString(roundingMode) << std::endl;
-        std::cout << std::endl;
-
-        // exiting
-        return 0;
+        catch (const std::out_of_range&)
+        {
+            return false;
+        }
+        return value <= max;
     }
 
-    // first argument is the time, to be parsed below
-    std::string timeArg(argv[1]);
+    // Matches [0-9][0-9]:[0-9][0-9]:[0-9][0-9][:;][0-9][0-9]
+    bool IsTimecode(const std::string& str)
+    {
+        if (str.size() != 11 || str[2] != ':' || str[5] != ':' || (str[8] != ':' && str[8] != ';'))
+        {
+            return false;
+        }
+        for (size_t i : {0, 1, 3, 4, 6, 7, 9, 10})
+        {
+            if (str[i] < '0' || str[i] > '9')
+            {
+                return false;
+            }
+        }
+        return true;
+    }
 
-    // parse remaining arguments
-    bool haveFramerate    = false;
-    bool haveSamplerate   = false;
-    bool haveRoundingMode = false;
-    for (int i = 2; i < argc; i++)
+    /**
+     * Find the format of a time argument, storing its value without the prefix. Parses by hand
+     * rather than with std::regex, which is costly to construct and match for every argument.
+     */
+    const TimeFormatInfo& ParseTime(const std::string& arg, std::string& value)
     {
-        std::string arg(argv[i]);
-        try
+        size_t i = 0;
+        for (; timeArgFormatInfo[i].what != nullptr; i++)
         {
-            framerate = Framerate(arg);
-            if (haveFramerate)
+            const TimeFormatInfo& info = timeArgFormatInfo[i];
+            const size_t length        = std::strlen(info.prefix);
+            const bool matches         = info.formatEnum == TimeFormatInfo::TIMECODE
+                                             ? IsTimecode(arg)
+                                             : arg.compare(0, length, info.prefix) == 0 &&
+                                           IsNumber(arg, length, info.integer);
+            if (matches)
             {
-                std::cerr << "Multiple arguments parsed as framerate" << std::endl;
-                return -1;
+                value = arg.substr(length);
+                break;
             }
-            haveFramerate = true;
         }
-        catch (...)
+        return timeArgFormatInfo[i];
+    }
+
+    constexpr int maxPrecision{std::numeric_limits<double>::digits10 + 1};
+
+    /** Framerate, samplerate and rounding-mode of a conversion, with defaults */
+    struct Settings
+    {
+        Framerate framerate{"24"};
+        Samplerate samplerate{48000.0};
+        RoundingMode roundingMode{RoundingMode::NEAREST};
+    };
+
+    /**
+     * Parse framerate, samplerate and rounding-mode arguments, in any order, into settings.
+     * @return false with a message in error when an argument is invalid or given twice.
+     */
+    bool ParseSettings(const std::vector<std::string>& args, Settings& settings, std::string& error)
+    {
+        bool haveFramerate    = false;
+        bool haveSamplerate   = false;
+        bool haveRoundingMode = false;
+        for (const std::string& arg : args)
         {
-            if (arg == ToString(RoundingMode::NEAREST) || arg == ToString(RoundingMode::TRUNCATE))
+            try
             {
-                if (haveRoundingMode)
+                settings.framerate = Framerate(arg);
+                if (haveFramerate)
                 {
-                    std::cerr << "Multiple arguments parsed as rounding-mode" << std::endl;
-                    return -1;
+                    error = "Multiple arguments parsed as framerate";
+                    return false;
                 }
-                roundingMode     = arg == ToString(RoundingMode::NEAREST) ? RoundingMode::NEAREST
-                                                                          : RoundingMode::TRUNCATE;
-                haveRoundingMode = true;
+                haveFramerate = true;
             }
-            else
+            catch (...)
             {
-                const std::regex sampleRateRe("^([0-9]+([.][0-9]*)?|[.][0-9]+)$");
-                if (std::regex_match(arg, sampleRateRe))
+                if (arg == ToString(RoundingMode::NEAREST) ||
+                    arg == ToString(RoundingMode::TRUNCATE))
+                {
+                    if (haveRoundingMode)
+                    {
+                        error = "Multiple arguments parsed as rounding-mode";
+                        return false;
+                    }
+                    settings.roundingMode = arg == ToString(RoundingMode::NEAREST)
+                                                ? RoundingMode::NEAREST
+                                                : RoundingMode::TRUNCATE;
+                    haveRoundingMode      = true;
+                }
+                else if (IsNumber(arg, 0, false))
                 {
                     if (haveSamplerate)
                     {
-                        std::cerr << "Multiple arguments parsed as samplerate" << std::endl;
-                        return -1;
+                        error = "Multiple arguments parsed as samplerate";
+                        return false;
                     }
                     // assume that an integer or numeric value that isn't framerate is the
                     // samplerate
-                    samplerate     = Samplerate(std::stod(arg));
-                    haveSamplerate = true;
+                    settings.samplerate = Samplerate(std::stod(arg));
+                    haveSamplerate      = true;
                 }
                 else
                 {
                     // neither parsable as framerate nor as samplerate nor
                     // nearest|truncate
+                    error = "Invalid argument " + arg;
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /** A time in all formats handled by TcUtils */
+    struct Conversion
+    {
+        Timecode timecode;
+        TimecodeSubframes timecodeSubframes;
+        Samples samples{0};
+        Seconds realSeconds{0.0};
+        DAMFSeconds damfSeconds{0.0};
+        Frames frames{0};
+    };
+
+    /** Convert a time argument value of the given format into all formats. */
+    void ConvertTime(TimeFormatInfo::Enum format,
+                     std::string timeArgValue,
+                     const Settings& settings,
+                     Conversion& c)
+    {
+        const Framerate framerate       = settings.framerate;
+        const Samplerate samplerate     = settings.samplerate;
+        const RoundingMode roundingMode = settings.roundingMode;
+
+        switch (format)
+        {
+            case TimeFormatInfo::TIMECODE:
+                if (framerate.IsDrop())
+                {
+                    timeArgValue[8] = ';';
+                }
+                c.timecode          = Timecode(framerate, timeArgValue);
+                c.realSeconds       = c.timecode.ToSeconds();
+                c.damfSeconds       = c.timecode.ToDAMFSeconds();
+                c.samples           = c.timecode.ToSamples(samplerate);
+                c.timecodeSubframes = TimecodeSubframes(framerate, c.samples, samplerate, 100);
+                c.frames            = c.timecode.ToFrames();
+                break;
+            case TimeFormatInfo::T_DAMF:
+            {
+                c.damfSeconds       = DAMFSeconds(std::stod(timeArgValue));
+                c.realSeconds       = Convert::ToSeconds(framerate, c.damfSeconds);
+                c.samples           = Convert::ToSamples(framerate, c.damfSeconds, samplerate);
+                c.timecode          = Timecode(framerate, c.damfSeconds, roundingMode);
+                c.timecodeSubframes = TimecodeSubframes(framerate, c.samples, samplerate, 100);
+                c.frames            = c.timecode.ToFrames();
+                break;
+            }
+            case TimeFormatInfo::T_REAL:
+            {
+                c.realSeconds       = Seconds(std::stod(timeArgValue));
+                c.damfSeconds       = Convert::ToDAMFSeconds(framerate, c.realSeconds);
+                c.samples           = Convert::ToSamples(c.realSeconds, samplerate);
+                c.timecode          = Timecode(framerate, c.realSeconds, roundingMode);
+                c.timecodeSubframes = TimecodeSubframes(framerate, c.samples, samplerate, 100);
+                c.frames            = c.timecode.ToFrames();
+                break;
+            }
+            case TimeFormatInfo::SAMPLE:
+            {
+                c.samples           = Samples(std::stoi(timeArgValue));
+                c.realSeconds       = Seconds(c.samples.GetValue() / samplerate.GetValue());
+                c.damfSeconds       = Convert::ToDAMFSeconds(framerate, c.samples, samplerate);
+                c.timecode          = Timecode(framerate, c.samples, samplerate, roundingMode);
+                c.timecodeSubframes = TimecodeSubframes(framerate, c.samples, samplerate, 100);
+                c.frames            = c.timecode.ToFrames();
+                break;
+            }
+            case TimeFormatInfo::FRAMES:
+            {
+                c.frames            = Frames(std::stoi(timeArgValue));
+                c.timecode          = Timecode(framerate, c.frames);
+                c.samples           = c.timecode.ToSamples(samplerate);
+                c.realSeconds       = c.timecode.ToSeconds();
+                c.damfSeconds       = c.timecode.ToDAMFSeconds();
+                c.timecodeSubframes = TimecodeSubframes(framerate, c.samples, samplerate, 100);
+                break;
+            }
+            case TimeFormatInfo::UNDEFINED:
+                assert(false);
+                break;
+        }
+    }
+
+    /** Get the time argument value as used in a conversion, e.g. a timecode with its separator. */
+    std::string ToUsedString(TimeFormatInfo::Enum format, const Conversion& c)
+    {
+        switch (format)
+        {
+            case TimeFormatInfo::TIMECODE:
+                return c.timecode.ToString();
+            case TimeFormatInfo::T_DAMF:
+                return ToString(c.damfSeconds.GetValue());
+            case TimeFormatInfo::T_REAL:
+                return ToString(c.realSeconds.GetValue());
+            case TimeFormatInfo::SAMPLE:
+                return std::to_string(c.samples.GetValue());
+            case TimeFormatInfo::FRAMES:
+                return ToString(c.frames.GetValue());
+            case TimeFormatInfo::UNDEFINED:
+                break;
+        }
+        assert(false);
+        return "";
+    }
+
+    /**
+     * Stream of the lines of a text file, keyed by the timecode in the first field of each line,
+     * given as hh:mm:ss:ff at the default framerate or as hh:mm:ss:ff@framerate. Empty lines are
+     * skipped. For sorted streams, a line before the previous one in real-time is an error.
+     */
+    class LineSource : public TimecodeEventSource
+    {
+    public:
+        LineSource(std::istream& stream, const std::string& name, Framerate framerate, bool sorted)
+        : mStream(stream)
+        , mName(name)
+        , mFramerate(framerate)
+        , mSorted(sorted)
+        {
+        }
+
+        bool Next(TimecodeEvent& event) override
+        {
+            static const std::regex lineRe(
+                "^\\s*([0-9][0-9]:[0-9][0-9]:[0-9][0-9][:;][0-9]{2,3})(@([^\\s]+))?(\\s.*)?$");
+            do
+            {
+                if (!std::getline(mStream, event.data))
+                {
+                    return false;
+                }
+                mLine++;
+            } while (event.data.empty());
+
+            std::smatch match;
+            if (!std::regex_match(event.data, match, lineRe))
+            {
+                throw std::runtime_error("Missing timecode on line " + Where());
+            }
+            try
+            {
+                const Framerate framerate =
+                    match[3].matched ? Framerate(match[3].str()) : mFramerate;
+                std::string timecode = match[1].str();
+                if (framerate.IsDrop())
+                {
+                    timecode[8] = ';';
+                }
+                event.timecode = Timecode(framerate, timecode);
+            }
+            catch (...)
+            {
+                throw std::runtime_error("Invalid timecode on line " + Where());
+            }
+            if (mSorted && mPrevious.IsSet() && Timecode::Compare(event.timecode, mPrevious) < 0)
+            {
+                throw std::runtime_error("Line " + Where() + " is out of order; use --sort");
+            }
+            mPrevious = event.timecode;
+            return true;
+        }
+
+    private:
+        std::istream& mStream;
+        std::string mName;
+        Framerate mFramerate;
+        bool mSorted;
+        size_t mLine{0};
+        Timecode mPrevious;
+
+        std::string Where() const
+        {
+            return std::to_string(mLine) + " of " + mName;
+        }
+    };
+
+    /**
+     * Merge sorted files (--merge) or sort files (--sort) of lines keyed by timecode, writing the
+     * lines to stdout in the real-time order of their timecodes.
+     */
+    int MergeOrSortLines(int argc, char** argv)
+    {
+        const bool sort = std::string(argv[1]) == "--sort";
+        if (argc < 4)
+        {
+            std::cerr << "Usage: " << argv[1] << " <framerate>"
+                      << (sort ? " [--memory=<MB>] [--temp=<directory>]" : "") << " <file>..."
+                      << std::endl;
+            return -1;
+        }
+        Framerate framerate("24");
+        try
+        {
+            framerate = Framerate(std::string(argv[2]));
+        }
+        catch (...)
+        {
+            std::cerr << "Invalid framerate " << argv[2] << std::endl;
+            return -1;
+        }
+
+        size_t memoryLimit = 64;
+        const char* temp   = std::getenv("TMPDIR");
+        std::string directory(temp != nullptr ? temp : ".");
+        std::vector<std::unique_ptr<std::ifstream>> files;
+        std::vector<std::unique_ptr<LineSource>> sources;
+        for (int i = 3; i < argc; i++)
+        {
+            const std::string arg(argv[i]);
+            if (sort && arg.compare(0, 9, "--memory=") == 0)
+            {
+                // at least 1 MB, and at most what fits in a size_t in bytes
+                unsigned long long megabytes = 0;
+                if (!ParseCount(arg, 9, std::numeric_limits<size_t>::max() >> 20, megabytes) ||
+                    megabytes == 0)
+                {
                     std::cerr << "Invalid argument " << arg << std::endl;
                     return -1;
                 }
+                memoryLimit = static_cast<size_t>(megabytes);
+            }
+            else if (sort && arg.compare(0, 7, "--temp=") == 0)
+            {
+                directory = arg.substr(7);
+            }
+            else if (arg == "-")
+            {
+                sources.emplace_back(new LineSource(std::cin, "stdin", framerate, !sort));
+            }
+            else
+            {
+                files.emplace_back(new std::ifstream(arg));
+                if (!*files.back())
+                {
+                    std::cerr << "Failed to open " << arg << std::endl;
+                    return -1;
+                }
+                sources.emplace_back(new LineSource(*files.back(), arg, framerate, !sort));
+            }
+        }
+
+        std::ios::sync_with_stdio(false);
+        try
+        {
+            TimecodeEvent event;
+            if (sort)
+            {
+                TimecodeExternalSort sorted(directory, memoryLimit << 20);
+                for (auto& source : sources)
+                {
+                    while (source->Next(event))
+                    {
+                        sorted.Add(std::move(event));
+                    }
+                }
+                while (sorted.Next(event))
+                {
+                    std::cout << event.data << '\n';
+                }
+            }
+            else
+            {
+                std::vector<TimecodeEventSource*> pointers;
+                for (auto& source : sources)
+                {
+                    pointers.push_back(source.get());
+                }
+                TimecodeMerger merger(pointers);
+                while (merger.Next(event))
+                {
+                    std::cout << event.data << '\n';
+                }
             }
         }
+        catch (const std::runtime_error& e)
+        {
+            std::cerr << e.what() << std::endl;
+            return -1;
+        }
+        catch (const TimecodeExternalSort::FileError&)
+        {
+            std::cerr << "Failed to write temporary files to " << directory << std::endl;
+            return -1;
+        }
+        std::cout.flush();
+        return 0;
     }
 
-    // parse the given time value
-    TimeFormatInfo timeFormatInfo{TimeFormatInfo::UNDEFINED, std::regex(""), nullptr, nullptr};
-    std::string timeArgValue;
-    for (size_t i = 0; timeArgFormatInfo[i].what != nullptr; i++)
+    /**
+     * Converts requests of the form [time] <framerate> <samplerate> <rounding-mode>, one per
+     * line, into responses of one line each. The settings parsed from the arguments after the
+     * time are cached by their text, as clients tend to send the same settings with every request.
+     */
+    class Server
     {
-        std::smatch match;
-        if (std::regex_match(timeArg, match, timeArgFormatInfo[i].re))
+    public:
+        void Handle(const std::string& line, std::ostream& out)
         {
-            timeFormatInfo = timeArgFormatInfo[i];
-            timeArgValue   = match[1].str();
+            // split the line into arguments, keying the settings by the arguments after the time
+            std::vector<std::string> args;
+            std::string key;
+            size_t end = 0;
+            for (size_t start; (start = line.find_first_not_of(" \t\r", end)) != line.npos;)
+            {
+                end = std::min(line.find_first_of(" \t\r", start), line.size());
+                args.push_back(line.substr(start, end - start));
+                if (args.size() > 1)
+                {
+                    key += (args.size() > 2 ? " " : "") + args.back();
+                }
+            }
+            const std::string timeArg = args.empty() ? std::string() : args.front();
+
+            auto settings = mSettings.find(key);
+            if (settings == mSettings.end())
+            {
+                if (!args.empty())
+                {
+                    args.erase(args.begin());
+                }
+                Settings parsed;
+                std::string error;
+                if (!ParseSettings(args, parsed, error))
+                {
+                    out << "error " << error << '\n';
+                    return;
+                }
+                if (mSettings.size() == maxCachedSettings)
+                {
+                    mSettings.clear();
+                }
+                settings = mSettings.emplace(key, parsed).first;
+            }
+
+            std::string timeArgValue;
+            const TimeFormatInfo& timeFormatInfo = ParseTime(timeArg, timeArgValue);
+            if (timeFormatInfo.formatEnum == TimeFormatInfo::UNDEFINED)
+            {
+                out << "error Failed to parse the time argument" << '\n';
+                return;
+            }
+            try
+            {
+                ConvertTime(timeFormatInfo.formatEnum, timeArgValue, settings->second, mConversion);
+            }
+            catch (...)
+            {
+                out << "error Failed to convert " << timeArg << '\n';
+                return;
+            }
+            out << "timecode=" << mConversion.timecode.ToString()
+                << " subframes=" << mConversion.timecodeSubframes.ToString(true)
+                << std::setprecision(maxPrecision) << std::fixed
+                << " t_real=" << mConversion.realSeconds.GetValue()
+                << " t_damf=" << mConversion.damfSeconds.GetValue()
+                << " sample=" << mConversion.samples.GetValue()
+                << " frames=" << mConversion.frames.GetValue() << '\n';
         }
-    }
 
-    Timecode timecode;
-    TimecodeSubframes timecodeSubframes;
-    Samples samples{0};
-    Seconds realSeconds{0.0};
-    DAMFSeconds damfSeconds{0.0};
-    Frames frames{0};
-    std::string timeArgValueUsed;
-
-    switch (timeFormatInfo.formatEnum)
-    {
-        case TimeFormatInfo::TIMECODE:
-            if (framerate.IsDrop())
-            {
-                timeArgValue[8] = ';';
-            }
-            timecode          = Timecode(framerate, timeArgValue);
-            timeArgValueUsed  = timecode.ToString();
-            realSeconds       = timecode.ToSeconds();
-            damfSeconds       = timecode.ToDAMFSeconds();
-            samples           = timecode.ToSamples(samplerate);
-            timecodeSubframes = TimecodeSubframes(framerate, samples, samplerate, 100);
-            frames            = timecode.ToFrames();
-            break;
-        case TimeFormatInfo::T_DAMF:
-        {
-            damfSeconds       = DAMFSeconds(std::stod(timeArgValue));
-            timeArgValueUsed  = ToString(damfSeconds.GetValue());
-            realSeconds       = Convert::ToSeconds(framerate, damfSeconds);
-            samples           = Convert::ToSamples(framerate, damfSeconds, samplerate);
-            timecode          = Timecode(framerate, damfSeconds, roundingMode);
-            timecodeSubframes = TimecodeSubframes(framerate, samples, samplerate, 100);
-            frames            = timecode.ToFrames();
-            break;
-        }
-        case TimeFormatInfo::T_REAL:
-        {
-            realSeconds       = Seconds(std::stod(timeArgValue));
-            timeArgValueUsed  = ToString(realSeconds.GetValue());
-            damfSeconds       = Convert::ToDAMFSeconds(framerate, realSeconds);
-            samples           = Convert::ToSamples(realSeconds, samplerate);
-            timecode          = Timecode(framerate, realSeconds, roundingMode);
-            timecodeSubframes = TimecodeSubframes(framerate, samples, samplerate, 100);
-            frames            = timecode.ToFrames();
-            break;
-        }
-        case TimeFormatInfo::SAMPLE:
-        {
-            samples           = Samples(std::stoi(timeArgValue));
-            timeArgValueUsed  = std::to_string(samples.GetValue());
-            realSeconds       = Seconds(samples.GetValue() / samplerate.GetValue());
-            damfSeconds       = Convert::ToDAMFSeconds(framerate, samples, samplerate);
-            timecode          = Timecode(framerate, samples, samplerate, roundingMode);
-            timecodeSubframes = TimecodeSubframes(framerate, samples, samplerate, 100);
-            frames            = timecode.ToFrames();
-            break;
-        }
-        case TimeFormatInfo::FRAMES:
-        {
-            frames            = Frames(std::stoi(timeArgValue));
-            timeArgValueUsed  = ToString(frames.GetValue());
-            timecode          = Timecode(framerate, frames);
-            samples           = timecode.ToSamples(samplerate);
-            realSeconds       = timecode.ToSeconds();
-            damfSeconds       = timecode.ToDAMFSeconds();
-            timecodeSubframes = TimecodeSubframes(framerate, samples, samplerate, 100);
-            break;
-        }
-        case TimeFormatInfo::UNDEFINED:
-            std::cerr << "Failed to parse the time argument" << std::endl;
+    private:
+        static const size_t maxCachedSettings = 256;
+        std::map<std::string, Settings> mSettings;
+        Conversion mConversion;
+    };
+
+#ifndef _WIN32
+    /** Serve the clients of a Unix socket at the given path, one at a time, until killed. */
+    int ServeSocket(const std::string& path)
+    {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(address.sun_path))
+        {
+            std::cerr << "Socket path too long: " << path << std::endl;
+            return -1;
+        }
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+        const int server = socket(AF_UNIX, SOCK_STREAM, 0);
+        unlink(path.c_str());
+        const auto socketAddress = reinterpret_cast<sockaddr*>(&address);
+        if (server < 0 || bind(server, socketAddress, sizeof(address)) != 0 ||
+            listen(server, 16) != 0)
+        {
+            std::cerr << "Failed to listen on " << path << std::endl;
             return -1;
+        }
+        // a client that disconnects early must not end the server
+        std::signal(SIGPIPE, SIG_IGN);
+
+        Server handler;
+        std::ostringstream out;
+        char buffer[1 << 14];
+        for (;;)
+        {
+            const int client = accept(server, nullptr, nullptr);
+            if (client < 0)
+            {
+                continue;
+            }
+            std::string input;
+            ssize_t size;
+            while ((size = read(client, buffer, sizeof(buffer))) > 0)
+            {
+                // answer all complete lines received, in one write
+                input.append(buffer, static_cast<size_t>(size));
+                size_t start = 0;
+                for (size_t end; (end = input.find('\n', start)) != input.npos; start = end + 1)
+                {
+                    handler.Handle(input.substr(start, end - start), out);
+                }
+                input.erase(0, start);
+                const std::string response = out.str();
+                out.str("");
+                size_t written = 0;
+                while (written < response.size())
+                {
+                    const ssize_t count =
+                        write(client, response.data() + written, response.size() - written);
+                    if (count <= 0)
+                    {
+                        break;
+                    }
+                    written += static_cast<size_t>(count);
+                }
+            }
+            close(client);
+        }
     }
+#endif
 
-    constexpr int maxPrecision{std::numeric_limits<double>::digits10 + 1};
+    /**
+     * Serve conversion requests from stdin (--serve) or a Unix socket (--serve=<path>), so that
+     * scripts can run one tcutility process as a coprocess instead of one per conversion.
+     */
+    int Serve(const std::string& arg)
+    {
+        if (arg.size() > 8 && arg.compare(0, 8, "--serve=") == 0)
+        {
+#ifndef _WIN32
+            return ServeSocket(arg.substr(8));
+#else
+            std::cerr << "Unix sockets are not supported on this platform" << std::endl;
+            return -1;
+#endif
+        }
+        if (arg != "--serve")
+        {
+            std::cerr << "Invalid argument " << arg << std::endl;
+            return -1;
+        }
 
-    std::cout << timeFormatInfo.what << " " << timeArgValueUsed;
-    std::cout << " at framerate " << framerate.ToString();
-    std::cout << " and samplerate " << samplerate.GetValue() << std::endl;
-    std::cout << "corresponds with" << std::endl << std::endl;
-    std::cout << " timecode: " << timecode.ToString() << " (" << ToInfoString(roundingMode) << ")"
+        std::ios::sync_with_stdio(false);
+        Server handler;
+        std::string line;
+        while (std::getline(std::cin, line))
+        {
+            handler.Handle(line, std::cout);
+            // flush once all requests received so far are answered
+            if (std::cin.rdbuf()->in_avail() <= 0)
+            {
+                std::cout.flush();
+            }
+        }
+        std::cout.flush();
+        return 0;
+    }
+
+    /** Options of the batch mode, see the usage */
+    struct BatchOptions
+    {
+        size_t column{1};
+        bool header{false};
+        bool json{false};
+        size_t threads{1};
+        // the format of values without a prefix, UNDEFINED to accept only the time argument formats
+        TimeFormatInfo::Enum input{TimeFormatInfo::UNDEFINED};
+        Settings settings;
+    };
+
+    /** A line-aligned part of the input of the batch mode, converted by one thread */
+    struct BatchChunk
+    {
+        BatchChunk(const char* begin, const char* end)
+        : begin(begin)
+        , end(end)
+        {
+        }
+
+        const char* begin;
+        const char* end;
+        std::string output;
+        size_t lines{0};
+        size_t errors{0};
+        // the line of the first value that failed to convert, counted from 1 in the chunk
+        size_t firstError{0};
+        bool done{false};
+    };
+
+    /** Find the value of the given column of a CSV or TSV line, without spaces and quotes. */
+    bool FindColumn(const char*& begin, const char*& end, size_t column)
+    {
+        const auto isSeparator = [](char c) { return c == ',' || c == '\t'; };
+        for (size_t i = 1; i < column; i++)
+        {
+            begin = std::find_if(begin, end, isSeparator);
+            if (begin == end)
+            {
+                return false;
+            }
+            begin++;
+        }
+        end = std::find_if(begin, end, isSeparator);
+        while (begin != end && (*begin == ' ' || *begin == '"'))
+        {
+            begin++;
+        }
+        while (end != begin && (end[-1] == ' ' || end[-1] == '"' || end[-1] == '\r'))
+        {
+            end--;
+        }
+        return true;
+    }
+
+    void AppendJsonString(std::string& out, const std::string& str)
+    {
+        out += '"';
+        for (char c : str)
+        {
+            if (c == '"' || c == '\\')
+            {
+                out += '\\';
+            }
+            out += static_cast<unsigned char>(c) < 0x20 ? '?' : c;
+        }
+        out += '"';
+    }
+
+    /**
+     * Append a value as printf("%.*f", maxPrecision, value) does, with the same digits. The exact
+     * binary fraction of the value is expanded digit by digit in integers and rounded half to
+     * even, which is many times faster than printf; other values fall back to printf.
+     */
+    void AppendNumber(std::string& out, double value)
+    {
+        int exponent          = 0;
+        const double mantissa = std::frexp(std::fabs(value), &exponent);
+        // |value| = significand / 2^shift, with the trailing zero bits of the significand removed
+        auto significand = static_cast<uint64_t>(std::ldexp(mantissa, 53));
+        int shift        = 53 - exponent;
+        while (shift > 0 && significand != 0 && (significand & 1) == 0)
+        {
+            significand >>= 1;
+            shift--;
+        }
+        // the fraction times 10 and the integer part must fit in 64 bits
+        if (!std::isfinite(value) || shift > 59 || exponent > 63)
+        {
+            char buffer[512];
+            std::snprintf(buffer, sizeof(buffer), "%.*f", maxPrecision, value);
+            out += buffer;
+            return;
+        }
+        if (shift < 0)
+        {
+            significand <<= -shift;
+            shift = 0;
+        }
+        const uint64_t mask = (uint64_t(1) << shift) - 1;
+        uint64_t integer    = significand >> shift;
+        uint64_t fraction   = significand & mask;
+        char digits[maxPrecision];
+        for (char& digit : digits)
+        {
+            fraction *= 10;
+            digit    = static_cast<char>('0' + (fraction >> shift));
+            fraction &= mask;
+        }
+        // round the rest half to even, carrying into the integer part
+        const uint64_t half = (mask + 1) / 2;
+        const bool odd      = (digits[maxPrecision - 1] - '0') % 2 == 1;
+        if (shift > 0 && (fraction > half || (fraction == half && odd)))
+        {
+            int i = maxPrecision - 1;
+            for (; i >= 0 && digits[i] == '9'; i--)
+            {
+                digits[i] = '0';
+            }
+            if (i >= 0)
+            {
+                digits[i]++;
+            }
+            else
+            {
+                integer++;
+            }
+        }
+        if (std::signbit(value))
+        {
+            out += '-';
+        }
+        out += std::to_string(integer);
+        out += '.';
+        out.append(digits, maxPrecision);
+    }
+
+    /** Convert the values of a chunk, appending a CSV row or a JSON line per value. */
+    void ConvertChunk(BatchChunk& chunk, const BatchOptions& options)
+    {
+        const TimeFormatInfo* input = nullptr;
+        for (size_t i = 0; timeArgFormatInfo[i].what != nullptr; i++)
+        {
+            if (timeArgFormatInfo[i].formatEnum == options.input)
+            {
+                input = &timeArgFormatInfo[i];
+            }
+        }
+
+        Conversion conversion;
+        std::string value;
+        std::string timeArgValue;
+        // the output is several times larger than the input
+        chunk.output.reserve(static_cast<size_t>(chunk.end - chunk.begin) * 8);
+        for (const char* line = chunk.begin; line != chunk.end;)
+        {
+            const char* lineEnd = std::find(line, chunk.end, '\n');
+            const char* next    = lineEnd == chunk.end ? lineEnd : lineEnd + 1;
+            chunk.lines++;
+            const char* valueBegin = line;
+            const char* valueEnd   = lineEnd;
+            line                   = next;
+            if (valueEnd != valueBegin && valueEnd[-1] == '\r')
+            {
+                valueEnd--;
+            }
+            if (valueBegin == valueEnd)
+            {
+                // empty lines are skipped
+                continue;
+            }
+
+            bool converted = FindColumn(valueBegin, valueEnd, options.column);
+            value.assign(valueBegin, valueEnd);
+            if (converted)
+            {
+                TimeFormatInfo::Enum format = ParseTime(value, timeArgValue).formatEnum;
+                if (format == TimeFormatInfo::UNDEFINED && input != nullptr &&
+                    (input->formatEnum == TimeFormatInfo::TIMECODE
+                         ? IsTimecode(value)
+                         : IsNumber(value, 0, input->integer)))
+                {
+                    format       = input->formatEnum;
+                    timeArgValue = value;
+                }
+                try
+                {
+                    converted = format != TimeFormatInfo::UNDEFINED;
+                    if (converted)
+                    {
+                        ConvertTime(format, timeArgValue, options.settings, conversion);
+                    }
+                }
+                catch (...)
+                {
+                    converted = false;
+                }
+            }
+            if (!converted && chunk.errors++ == 0)
+            {
+                chunk.firstError = chunk.lines;
+            }
+
+            std::string& out = chunk.output;
+            if (options.json)
+            {
+                out += "{\"input\":";
+                AppendJsonString(out, value);
+                if (converted)
+                {
+                    out += ",\"timecode\":\"";
+                    out += conversion.timecode.ToString();
+                    out += "\",\"subframes\":\"";
+                    out += conversion.timecodeSubframes.ToString(true);
+                    out += "\",\"t_real\":";
+                    AppendNumber(out, conversion.realSeconds.GetValue());
+                    out += ",\"t_damf\":";
+                    AppendNumber(out, conversion.damfSeconds.GetValue());
+                    out += ",\"sample\":";
+                    out += std::to_string(conversion.samples.GetValue());
+                    out += ",\"frames\":";
+                    out += std::to_string(conversion.frames.GetValue());
+                }
+                else
+                {
+                    out += ",\"error\":\"Failed to convert\"";
+                }
+                out += "}\n";
+            }
+            else
+            {
+                // the values are quoted when they contain separators or quotes
+                if (value.find_first_of(",\"\t") != std::string::npos)
+                {
+                    out += '"';
+                    for (char c : value)
+                    {
+                        out += c == '"' ? "\"\"" : std::string(1, c);
+                    }
+                    out += '"';
+                }
+                else
+                {
+                    out += value;
+                }
+                if (converted)
+                {
+                    out += ',';
+                    out += conversion.timecode.ToString();
+                    out += ',';
+                    out += conversion.timecodeSubframes.ToString(true);
+                    out += ',';
+                    AppendNumber(out, conversion.realSeconds.GetValue());
+                    out += ',';
+                    AppendNumber(out, conversion.damfSeconds.GetValue());
+                    out += ',';
+                    out += std::to_string(conversion.samples.GetValue());
+                    out += ',';
+                    out += std::to_string(conversion.frames.GetValue());
+                }
+                else
+                {
+                    out += ",,,,,,";
+                }
+                out += '\n';
+            }
+        }
+    }
+
+    /**
+     * Convert a column of times in a CSV or TSV file into all formats (--batch). The file is
+     * memory-mapped and split into line-aligned chunks, which a pool of threads converts while
+     * the main thread writes the converted chunks in the order of the input.
+     */
+    int BatchConvert(int argc, char** argv)
+    {
+        BatchOptions options;
+        options.threads = std::max(1u, std::thread::hardware_concurrency());
+        std::string path;
+        std::vector<std::string> args;
+        for (int i = 2; i < argc; i++)
+        {
+            const std::string arg(argv[i]);
+            if (arg == "--header")
+            {
+                options.header = true;
+            }
+            else if (arg == "--json")
+            {
+                options.json = true;
+            }
+            else if (arg.compare(0, 9, "--column=") == 0 || arg.compare(0, 10, "--threads=") == 0)
+            {
+                const size_t pos         = arg.find('=') + 1;
+                unsigned long long value = 0;
+                if (!ParseCount(arg, pos, std::numeric_limits<size_t>::max(), value))
+                {
+                    std::cerr << "Invalid argument " << arg << std::endl;
+                    return -1;
+                }
+                size_t& option = pos == 9 ? options.column : options.threads;
+                option         = std::max<size_t>(1, static_cast<size_t>(value));
+            }
+            else if (arg.compare(0, 8, "--input=") == 0)
+            {
+                // the formats are named by their prefix without =, or timecode
+                const std::string name = arg.substr(8);
+                for (size_t j = 0; timeArgFormatInfo[j].what != nullptr; j++)
+                {
+                    const TimeFormatInfo& info = timeArgFormatInfo[j];
+                    if (name == "timecode" ? info.formatEnum == TimeFormatInfo::TIMECODE
+                                           : name + "=" == info.prefix)
+                    {
+                        options.input = info.formatEnum;
+                        break;
+                    }
+                }
+                if (options.input == TimeFormatInfo::UNDEFINED)
+                {
+                    std::cerr << "Invalid argument " << arg << std::endl;
+                    return -1;
+                }
+            }
+            else if (path.empty() && arg.compare(0, 2, "--") != 0)
+            {
+                path = arg;
+            }
+            else
+            {
+                args.push_back(arg);
+            }
+        }
+        std::string error;
+        if (path.empty())
+        {
+            std::cerr << "Missing input file" << std::endl;
+            return -1;
+        }
+        if (!ParseSettings(args, options.settings, error))
+        {
+            std::cerr << error << std::endl;
+            return -1;
+        }
+        MappedFile file;
+        if (!file.Open(path))
+        {
+            std::cerr << "Failed to open " << path << std::endl;
+            return -1;
+        }
+
+        // split the input into chunks of whole lines
+        const size_t chunkSize = 1 << 20;
+        const char* begin      = file.data();
+        const char* end        = begin + file.size();
+        size_t skippedLines    = 0;
+        if (options.header && begin != end)
+        {
+            begin        = std::min(std::find(begin, end, '\n') + 1, end);
+            skippedLines = 1;
+        }
+        std::vector<BatchChunk> chunks;
+        while (begin != end)
+        {
+            const char* chunkEnd = begin + std::min(chunkSize, static_cast<size_t>(end - begin));
+            chunkEnd             = std::min(std::find(chunkEnd, end, '\n') + 1, end);
+            chunks.emplace_back(begin, chunkEnd);
+            begin = chunkEnd;
+        }
+
+        // the threads convert at most a few chunks ahead of the output, bounding the memory used
+        std::mutex mutex;
+        std::condition_variable changed;
+        size_t next          = 0;
+        size_t written       = 0;
+        const size_t threads = std::min(options.threads, chunks.size());
+        const size_t ahead   = 4 * threads;
+        std::vector<std::thread> pool;
+        for (size_t i = 0; i < threads; i++)
+        {
+            pool.emplace_back([&]() {
+                std::unique_lock<std::mutex> lock(mutex);
+                for (;;)
+                {
+                    changed.wait(lock, [&]() { return next < written + ahead; });
+                    if (next == chunks.size())
+                    {
+                        return;
+                    }
+                    BatchChunk& chunk = chunks[next++];
+                    lock.unlock();
+                    ConvertChunk(chunk, options);
+                    lock.lock();
+                    chunk.done = true;
+                    changed.notify_all();
+                }
+            });
+        }
+
+        std::ios::sync_with_stdio(false);
+        if (!options.json)
+        {
+            std::cout << "input,timecode,subframes,t_real,t_damf,sample,frames\n";
+        }
+        size_t lines      = skippedLines;
+        size_t errors     = 0;
+        size_t firstError = 0;
+        for (BatchChunk& chunk : chunks)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                changed.wait(lock, [&]() { return chunk.done; });
+            }
+            std::cout.write(chunk.output.data(), static_cast<std::streamsize>(chunk.output.size()));
+            std::string().swap(chunk.output);
+            if (chunk.errors > 0 && errors == 0)
+            {
+                firstError = lines + chunk.firstError;
+            }
+            errors += chunk.errors;
+            lines += chunk.lines;
+            std::lock_guard<std::mutex> lock(mutex);
+            written++;
+            changed.notify_all();
+        }
+        for (std::thread& thread : pool)
+        {
+            thread.join();
+        }
+        std::cout.flush();
+
+        if (errors > 0)
+        {
+            std::cerr << errors << " values failed to convert, the first on line " << firstError
+                      << std::endl;
+            return -1;
+        }
+        return 0;
+    }
+
+    /** The inputs of the bench mode for a framerate and samplerate, spread over a day */
+    struct BenchInputs
+    {
+        Framerate framerate;
+        Samplerate samplerate;
+        std::vector<Timecode> timecodes;
+        std::vector<std::string> strings;
+        std::vector<Samples> samples;
+        std::vector<DAMFSeconds> damfSeconds;
+    };
+
+    /** A workload of the bench mode, returning a checksum so that the work can't be elided */
+    struct BenchOp
+    {
+        const char* name;
+        int64_t (*run)(const BenchInputs& inputs, size_t count);
+    };
+
+    const size_t benchInputCount = 1024;
+
+    const BenchOp benchOps[] = {
+        {"parse",
+         [](const BenchInputs& in, size_t count) {
+             int64_t sum = 0;
+             for (size_t i = 0; i < count; i++)
+             {
+                 sum += Timecode(in.framerate, in.strings[i % benchInputCount]).GetUnitFrames();
+             }
+             return sum;
+         }},
+        {"format",
+         [](const BenchInputs& in, size_t count) {
+             int64_t sum = 0;
+             char str[13];
+             for (size_t i = 0; i < count; i++)
+             {
+                 in.timecodes[i % benchInputCount].ToString(str, sizeof(str));
+                 sum += str[10];
+             }
+             return sum;
+         }},
+        {"samples_to_timecode",
+         [](const BenchInputs& in, size_t count) {
+             int64_t sum = 0;
+             for (size_t i = 0; i < count; i++)
+             {
+                 sum += Timecode(in.framerate,
+                                 in.samples[i % benchInputCount],
+                                 in.samplerate,
+                                 RoundingMode::NEAREST)
+                            .GetUnitFrames();
+             }
+             return sum;
+         }},
+        {"timecode_to_samples",
+         [](const BenchInputs& in, size_t count) {
+             int64_t sum = 0;
+             for (size_t i = 0; i < count; i++)
+             {
+                 sum += in.timecodes[i % benchInputCount].ToSamples(in.samplerate).GetValue();
+             }
+             return sum;
+         }},
+        {"damf",
+         [](const BenchInputs& in, size_t count) {
+             int64_t sum = 0;
+             for (size_t i = 0; i < count; i++)
+             {
+                 const DAMFSeconds damfSeconds = in.damfSeconds[i % benchInputCount];
+                 sum += Convert::ToSamples(in.framerate, damfSeconds, in.samplerate).GetValue();
+             }
+             return sum;
+         }},
+        {"subframes",
+         [](const BenchInputs& in, size_t count) {
+             int64_t sum = 0;
+             for (size_t i = 0; i < count; i++)
+             {
+                 const Samples samples = in.samples[i % benchInputCount];
+                 sum += TimecodeSubframes(in.framerate, samples, in.samplerate, 100)
+                            .GetSubframesNum();
+             }
+             return sum;
+         }},
+        {"boundaries",
+         [](const BenchInputs& in, size_t count) {
+             int64_t sum = 0;
+             for (size_t i = 0; i < count; i++)
+             {
+                 const Samples samples = in.samples[i % benchInputCount];
+                 sum += FrameBoundary::Floor(in.framerate, samples, in.samplerate).GetValue() +
+                        FrameBoundary::Ceiling(in.framerate, samples, in.samplerate).GetValue();
+             }
+             return sum;
+         }},
+        {nullptr, nullptr}};
+
+    BenchInputs MakeBenchInputs(Framerate framerate, Samplerate samplerate)
+    {
+        BenchInputs inputs{framerate, samplerate, {}, {}, {}, {}};
+        const int64_t samplesPerDay = static_cast<int64_t>(samplerate.GetValue()) * 86400;
+        for (size_t i = 0; i < benchInputCount; i++)
+        {
+            // spread over the day, off the frame boundaries
+            const Samples samples((samplesPerDay - 1) / benchInputCount * static_cast<int64_t>(i) +
+                                  static_cast<int64_t>(i % 97));
+            const Timecode timecode(framerate, samples, samplerate, RoundingMode::TRUNCATE);
+            inputs.timecodes.push_back(timecode);
+            inputs.strings.push_back(timecode.ToString());
+            inputs.samples.push_back(samples);
+            inputs.damfSeconds.push_back(timecode.ToDAMFSeconds());
+        }
+        return inputs;
+    }
+
+    double SecondsSince(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    std::atomic<int64_t> benchSink{0};
+
+    /**
+     * Run the standard workload of every operation for every framerate and samplerate, single-
+     * and multi-threaded (--bench), writing a JSON line per measurement.
+     */
+    int Bench(int argc, char** argv)
+    {
+        size_t threads    = std::max(1u, std::thread::hardware_concurrency());
+        double minSeconds = 0.02;
+        std::vector<Framerate> framerates;
+        std::vector<Samplerate> samplerates;
+        for (int i = 2; i < argc; i++)
+        {
+            const std::string arg(argv[i]);
+            try
+            {
+                if (arg.compare(0, 10, "--threads=") == 0 && IsNumber(arg, 10, true))
+                {
+                    threads = std::max<size_t>(1, std::stoul(arg.substr(10)));
+                }
+                else if (arg.compare(0, 7, "--time=") == 0 && IsNumber(arg, 7, true))
+                {
+                    minSeconds = std::max(1.0, std::stod(arg.substr(7))) / 1000;
+                }
+                else if (arg.compare(0, 12, "--framerate=") == 0)
+                {
+                    framerates.push_back(Framerate(arg.substr(12)));
+                }
+                else if (arg.compare(0, 13, "--samplerate=") == 0 && IsNumber(arg, 13, false))
+                {
+                    samplerates.push_back(Samplerate(std::stod(arg.substr(13))));
+                }
+                else
+                {
+                    throw std::invalid_argument(arg);
+                }
+            }
+            catch (...)
+            {
+                std::cerr << "Invalid argument " << arg << std::endl;
+                return -1;
+            }
+        }
+        if (framerates.empty())
+        {
+            for (auto value : Framerate::values())
+            {
+                framerates.push_back(value);
+            }
+        }
+        if (samplerates.empty())
+        {
+            samplerates = {Samplerate(44100.0), Samplerate(48000.0), Samplerate(96000.0)};
+        }
+
+        std::cout << "{\"tcutility\":\"" << Version::GetString() << "\",\"threads\":" << threads
+                  << ",\"cores\":" << std::thread::hardware_concurrency()
+                  << ",\"time_ms\":" << minSeconds * 1000 << "}" << std::endl;
+        for (Framerate framerate : framerates)
+        {
+            for (Samplerate samplerate : samplerates)
+            {
+                const BenchInputs inputs = MakeBenchInputs(framerate, samplerate);
+                for (size_t op = 0; benchOps[op].name != nullptr; op++)
+                {
+                    const BenchOp& benchOp = benchOps[op];
+                    // single-threaded: double the count until a run takes the minimum time
+                    size_t count   = benchInputCount;
+                    double seconds = 0;
+                    for (;;)
+                    {
+                        const auto start = std::chrono::steady_clock::now();
+                        benchSink += benchOp.run(inputs, count);
+                        seconds = SecondsSince(start);
+                        if (seconds >= minSeconds)
+                        {
+                            break;
+                        }
+                        count *= 2;
+                    }
+                    const double singleRate = count / seconds;
+
+                    // multi-threaded: every thread runs the same count, started together
+                    std::atomic<bool> go{false};
+                    std::vector<std::thread> pool;
+                    for (size_t i = 0; i < threads; i++)
+                    {
+                        pool.emplace_back([&]() {
+                            while (!go)
+                            {
+                                std::this_thread::yield();
+                            }
+                            benchSink += benchOp.run(inputs, count);
+                        });
+                    }
+                    const auto start = std::chrono::steady_clock::now();
+                    go               = true;
+                    for (std::thread& thread : pool)
+                    {
+                        thread.join();
+                    }
+                    const double multiRate = count * threads / SecondsSince(start);
+
+                    char line[512];
+                    std::snprintf(line,
+                                  sizeof(line),
+                                  "{\"op\":\"%s\",\"framerate\":\"%s\",\"samplerate\":%.0f,"
+                                  "\"ns_per_op\":%.2f,\"ops_per_s\":%.0f,\"threads\":%zu,"
+                                  "\"ops_per_s_multi\":%.0f,\"ops_per_s_per_core\":%.0f,"
+                                  "\"scaling\":%.3f}",
+                                  benchOp.name,
+                                  framerate.ToString(),
+                                  samplerate.GetValue(),
+                                  1e9 / singleRate,
+                                  singleRate,
+                                  threads,
+                                  multiRate,
+                                  multiRate / threads,
+                                  multiRate / threads / singleRate);
+                    std::cout << line << std::endl;
+                }
+            }
+        }
+        return 0;
+    }
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    // Variables to store parsed arguments, with defaults when no argument is
+    // given
+    Settings settings;
+
+    // line and server modes write only their output to stdout, without the banner
+    if (argc >= 2 && (std::string(argv[1]) == "--merge" || std::string(argv[1]) == "--sort"))
+    {
+        return MergeOrSortLines(argc, argv);
+    }
+    if (argc == 2 && std::string(argv[1]).compare(0, 7, "--serve") == 0)
+    {
+        return Serve(argv[1]);
+    }
+    if (argc >= 2 && std::string(argv[1]) == "--batch")
+    {
+        return BatchConvert(argc, argv);
+    }
+    if (argc >= 2 && std::string(argv[1]) == "--bench")
+    {
+        return Bench(argc, argv);
+    }
+
+    std::cout << std::endl;
+    std::cout << "Dolby TcUtils tcutility - version " << Version::GetString() << std::endl;
+    std::cout << "This utility converts a given time into all formats handled by TcUtils."
+              << std::endl
               << std::endl;
-    std::cout << "           " << timecodeSubframes.ToString(true) << " "
+
+    if (argc < 2 ||
+        (argc == 2 && (std::string(argv[1]) == "--help" || std::string(argv[1]) == "-h")))
+    {
+        // show usage when no arguments are given or -h / --help
+        size_t maxFormatStringLength = 0;
+        for (size_t i = 0; timeArgFormatInfo[i].what != nullptr; i++)
+        {
+            std::string formatString(timeArgFormatInfo[i].formatString);
+            maxFormatStringLength = std::max(maxFormatStringLength, formatString.length());
+        }
+
+        std::cout << "Usage: [time] <framerate> <samplerate> <rounding-mode>" << std::endl
+                  << std::endl;
+        std::cout << "  time is required and can be given in the following formats:" << std::endl
+                  << std::endl;
+
+        for (size_t i = 0; timeArgFormatInfo[i].what != nullptr; i++)
+        {
+            std::string formatString(timeArgFormatInfo[i].formatString);
+            std::cout << "    " << formatString
+                      << std::string(maxFormatStringLength + 3 - formatString.length(), ' ')
+                      << timeArgFormatInfo[i].what << std::endl;
+        }
+
+        std::cout << std::endl;
+        std::cout << "  framerate, samplerate and rounding-mode are optional" << std::endl
+                  << std::endl;
+        std::cout << "  framerate can be one of the following:" << std::endl << std::endl;
+        for (auto value : Framerate::values())
+        {
+            std::cout << "    " << value.ToString()
+                      << (settings.framerate == value ? " (default)" : "") << std::endl;
+        }
+        std::cout << std::endl
+                  << "  samplerate default is " << settings.samplerate.GetValue() << std::endl;
+        std::cout << std::endl
+                  << "  rounding-mode can be " << ToString(RoundingMode(RoundingMode::NEAREST))
+                  << " and " << ToString(RoundingMode(RoundingMode::TRUNCATE)) << ". Default is "
+                  << ToString(settings.roundingMode) << std::endl;
+        std::cout << std::endl;
+        std::cout << "Usage: --merge <framerate> <file>..." << std::endl;
+        std::cout << "       --sort <framerate> [--memory=<MB>] [--temp=<directory>] <file>..."
+                  << std::endl
+                  << std::endl;
+        std::cout << "  merges sorted files or sorts files of lines starting with a timecode"
+                  << std::endl
+                  << "  (hh:mm:ss:ff, or hh:mm:ss:ff@framerate for lines of another framerate)"
+                  << std::endl
+                  << "  into one stream on stdout, ordered by real-time; - reads stdin"
+                  << std::endl;
+        std::cout << std::endl;
+        std::cout << "Usage: --batch [<options>] <file> <framerate> <samplerate> <rounding-mode>"
+                  << std::endl
+                  << std::endl;
+        std::cout << "  converts a column of times in a CSV or TSV file into CSV rows, or into"
+                  << std::endl
+                  << "  JSON lines with --json, in the order of the input, using all cores."
+                  << std::endl
+                  << "  Options:" << std::endl
+                  << std::endl;
+        std::cout << "    --column=<n>      column of the times, counted from 1 (default 1)"
+                  << std::endl
+                  << "    --header          skip the first line" << std::endl
+                  << "    --input=<format>  format of values without a prefix: timecode, t_real,"
+                  << std::endl
+                  << "                      t_damf, frames or sample" << std::endl
+                  << "    --threads=<n>     number of threads (default: number of cores)"
+                  << std::endl;
+        std::cout << std::endl;
+        std::cout << "Usage: --bench [--threads=<n>] [--time=<ms>] [--framerate=<framerate>]..."
+                  << std::endl
+                  << "               [--samplerate=<samplerate>]..." << std::endl
+                  << std::endl;
+        std::cout << "  measures the conversions for all (or the given) framerates and samplerates,"
+                  << std::endl
+                  << "  single-threaded and on all (or n) threads, writing JSON lines" << std::endl;
+        std::cout << std::endl;
+        std::cout << "Usage: --serve[=<socket>]" << std::endl << std::endl;
+        std::cout << "  converts requests [time] <framerate> <samplerate> <rounding-mode>"
+                  << std::endl
+                  << "  read line by line from stdin, or from the clients of a Unix socket,"
+                  << std::endl
+                  << "  answering each with one line of key=value pairs, or error <message>"
+                  << std::endl;
+        std::cout << std::endl;
+
+        // exiting
+        return 0;
+    }
+
+    // first argument is the time, to be parsed below
+    std::string timeArg(argv[1]);
+
+    // parse remaining arguments
+    std::string error;
+    if (!ParseSettings(std::vector<std::string>(argv + 2, argv + argc), settings, error))
+    {
+        std::cerr << error << std::endl;
+        return -1;
+    }
+
+    // parse the given time value
+    std::string timeArgValue;
+    const TimeFormatInfo& timeFormatInfo = ParseTime(timeArg, timeArgValue);
+    if (timeFormatInfo.formatEnum == TimeFormatInfo::UNDEFINED)
+    {
+        std::cerr << "Failed to parse the time argument" << std::endl;
+        return -1;
+    }
+
+    Conversion conversion;
+    ConvertTime(timeFormatInfo.formatEnum, timeArgValue, settings, conversion);
+
+    std::cout << timeFormatInfo.what << " " << ToUsedString(timeFormatInfo.formatEnum, conversion);
+    std::cout << " at framerate " << settings.framerate.ToString();
+    std::cout << " and samplerate " << settings.samplerate.GetValue() << std::endl;
+    std::cout << "corresponds with" << std::endl << std::endl;
+    std::cout << " timecode: " << conversion.timecode.ToString() << " ("
+              << ToInfoString(settings.roundingMode) << ")" << std::endl;
+    std::cout << "           " << conversion.timecodeSubframes.ToString(true) << " "
               << "(subframes)" << std::endl;
     std::cout << std::setprecision(maxPrecision) << std::fixed;
-    std::cout << "   t_real: " << realSeconds.GetValue() << std::endl;
-    std::cout << "   t_damf: " << damfSeconds.GetValue() << std::endl;
-    std::cout << "   sample: " << samples.GetValue() << std::endl;
-    std::cout << "   frames: " << frames.GetValue() << std::endl << std::endl;
+    std::cout << "   t_real: " << conversion.realSeconds.GetValue() << std::endl;
+    std::cout << "   t_damf: " << conversion.damfSeconds.GetValue() << std::endl;
+    std::cout << "   sample: " << conversion.samples.GetValue() << std::endl;
+    std::cout << "   frames: " << conversion.frames.GetValue() << std::endl << std::endl;
 
     return 0;
 }